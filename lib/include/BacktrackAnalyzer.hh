@@ -0,0 +1,57 @@
+/**
+ * @file BacktrackAnalyzer.hh
+ * @brief 有关回退分析的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "DFA.hh"
+
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 回退分析的结果
+ * @details 最长匹配时，词法分析程序在匹配失败后要回退到上一次到达终止状态的位置。
+ * 在终止状态中失败时只需要退回读入的最后一个字节，从起始状态出发还没有经过终止状态时失败则没有匹配，
+ * 只有在经过终止状态之后才能到达的非终止状态中失败时，才需要记录上一次到达终止状态之后读入的字节数
+ */
+struct BacktrackInfo
+{
+    std::vector<bool> finalAccepts; ///< 每个状态是否是最终接受状态，即不可能再匹配更长的字符串的终止状态
+    std::vector<bool> mayBacktrack; ///< 每个状态是否可能需要回退多个字节，即能从终止状态到达的非终止状态
+    int backtrackStateCount = 0;    ///< 可能需要回退多个字节的状态数，为0时DFA完全不需要回退
+
+    /**
+     * @brief 判断DFA是否完全不需要回退
+     * @return 是否完全不需要回退
+     */
+    bool isBacktrackFree() const { return backtrackStateCount == 0; }
+};
+
+/**
+ * @brief 回退分析类
+ * @details 用于找出最小化DFA中不需要记录回退信息的状态，是一个单例类
+ */
+class BacktrackAnalyzer
+{
+private:
+    static BacktrackAnalyzer instance; ///< 单例对象
+
+public:
+    static BacktrackAnalyzer &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 分析DFA的回退
+     * @param dfa 状态从0开始连续编号的DFA
+     * @return 分析结果，按照状态的id索引
+     */
+    BacktrackInfo analyze(const DFA &dfa);
+};
+
+CHLEX_NAMESPACE_END
@@ -0,0 +1,51 @@
+/**
+ * @file ByteClassifier.hh
+ * @brief 有关字节等价类的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "DFA.hh"
+
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 字节等价类
+ * @details 如果两个字节在DFA的每个状态上都转移到同一个状态（或者都没有转移），则它们属于同一个等价类。
+ * 没有任何转移的字节（包括0）都属于等价类0。
+ */
+struct ByteClasses
+{
+    std::vector<int> classOf;                   ///< 每个字节所属的等价类，长度为256
+    std::vector<unsigned char> representatives; ///< 每个等价类中最小的字节
+    int classCount = 0;                         ///< 等价类的数量
+};
+
+/**
+ * @brief 字节等价类划分类
+ * @details 用于计算DFA的字节等价类，是一个单例类
+ */
+class ByteClassifier
+{
+private:
+    static ByteClassifier instance; ///< 单例对象
+
+public:
+    static ByteClassifier &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 计算DFA的字节等价类
+     * @details 依次用每个状态的转移细分当前的划分，等价类按照其中最小的字节排序
+     * @param dfa DFA
+     * @return 字节等价类
+     */
+    ByteClasses classify(const DFA &dfa);
+};
+
+CHLEX_NAMESPACE_END
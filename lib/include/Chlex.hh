@@ -30,6 +30,8 @@ private:
 
     friend class ChlexReader;
     friend class RegExpParser;
+    friend class DFAEditor;
+    friend class DFACombiner;
 
 public:
     /**
@@ -48,16 +50,23 @@ public:
 /**
  * @brief 解析后的Chlex
  * @details 经过解析后的Chlex，包含了所有解析后的正则表达式
- * @note 由RegExpParser生成
+ * @note 由RegExpParser生成。使用 CompileOptions::releaseIntermediates 编译时，生成自动机之后抽象语法树即被释放，
+ * 此时所有正则表达式的 ParsedRegExp::ast 为空
  */
 class ParsedChlex
 {
 private:
-    std::shared_ptr<RawChlex> rawChlex;                 ///< 原始Chlex
-    std::vector<std::unique_ptr<ParsedRegExp>> regExps; ///< 所有解析后的正则表达式
+    std::shared_ptr<RawChlex> rawChlex;                    ///< 原始Chlex
+    std::vector<std::unique_ptr<ParsedRegExp>> regExps;    ///< 所有解析后的正则表达式
+    RENodeArena arena;                                     ///< 所有抽象语法树节点的分配器
+    std::vector<std::shared_ptr<const ParsedChlex>> bases; ///< 部分语法树节点所在的其他Chlex，保证这些节点在此对象析构之前有效
 
     friend class RegExpParser;
+    friend class RegExpOptimizer;
     friend class NFAFactory;
+    friend class DFAEditor;
+    friend class DFACombiner;
+    friend class Compiler;
 
 public:
     /**
@@ -71,21 +80,53 @@ public:
      * @return 所有解析后的正则表达式
      */
     const std::vector<std::unique_ptr<ParsedRegExp>> &getRegExps() const { return regExps; }
+
+    /**
+     * @brief 判断抽象语法树是否仍然存在
+     * @return 所有正则表达式的抽象语法树是否都没有被释放
+     */
+    bool hasAST() const
+    {
+        for (auto &parsedRegExp : regExps)
+        {
+            if (!parsedRegExp->ast)
+                return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief 关键字信息类
+ * @details 用于表示一个没有被编译到NFA中，而是在匹配后通过哈希表识别的关键字
+ */
+struct KeywordInfo
+{
+    std::string lexeme; ///< 关键字的字符串
+    int rule;           ///< 关键字所在的正则表达式的序号
+    int hostRule;       ///< 能匹配该关键字的正则表达式的序号，匹配到它之后再查询关键字
 };
 
 /**
  * @brief 含有NFA的Chlex
  * @details 包含了解析后的Chlex和对应的NFA
- * @note 由NFAFactory生成
+ * @note 由NFAFactory生成。由DerivativeDFAFactory生成的DFAChlex中的NFAChlex不含NFA，
+ * 使用 CompileOptions::releaseIntermediates 编译时，生成DFA之后NFA即被释放
  */
 class NFAChlex
 {
 private:
     std::shared_ptr<ParsedChlex> parsedChlex; ///< 解析后的Chlex
-    std::unique_ptr<NFA> nfa;                 ///< 对应的NFA
+    std::unique_ptr<NFA> nfa;                 ///< 对应的NFA，可能为空
+    std::vector<KeywordInfo> keywords;        ///< 没有被编译到NFA中的关键字
 
     friend class NFAFactory;
+    friend class NFAOptimizer;
     friend class DFAFactory;
+    friend class DerivativeDFAFactory;
+    friend class DFAEditor;
+    friend class DFACombiner;
+    friend class Compiler;
 
 public:
     /**
@@ -94,26 +135,44 @@ public:
      */
     const ParsedChlex &getParsedChlex() const { return *parsedChlex; }
 
+    /**
+     * @brief 判断是否含有NFA
+     * @return 是否含有NFA
+     */
+    bool hasNFA() const { return nfa != nullptr; }
+
     /**
      * @brief 获取对应的NFA
      * @return 对应的NFA
      */
     const NFA &getNFA() const { return *nfa; }
+
+    /**
+     * @brief 获取没有被编译到NFA中的关键字
+     * @return 所有这样的关键字
+     */
+    const std::vector<KeywordInfo> &getKeywords() const { return keywords; }
 };
 
 /**
  * @brief 含有DFA的Chlex
  * @details 包含了含有NFA的Chlex和对应的DFA
- * @note 由DFAFactory生成
+ * @note 由DFAFactory生成。由DFAEditor生成的MinimizedDFAChlex中的DFAChlex不含DFA，
+ * 使用 CompileOptions::releaseIntermediates 编译时，最小化之后DFA即被释放
  */
 class DFAChlex
 {
 private:
     std::shared_ptr<NFAChlex> nfaChlex; ///< 含有NFA的Chlex
-    std::unique_ptr<DFA> dfa;           ///< 对应的DFA
+    std::unique_ptr<DFA> dfa;           ///< 对应的DFA，可能为空
 
     friend class DFAFactory;
+    friend class DerivativeDFAFactory;
     friend class DFAMinimizer;
+    friend class DFAEditor;
+    friend class DFACombiner;
+    friend class DFAPruner;
+    friend class Compiler;
 
 public:
     /**
@@ -122,6 +181,12 @@ public:
      */
     const NFAChlex &getNFAChlex() const { return *nfaChlex; }
 
+    /**
+     * @brief 判断是否含有DFA
+     * @return 是否含有DFA
+     */
+    bool hasDFA() const { return dfa != nullptr; }
+
     /**
      * @brief 获取对应的DFA
      * @return 对应的DFA
@@ -131,7 +196,9 @@ public:
 
 /**
  * @brief 含有最小化DFA的Chlex
- * @details 包含了含有DFA的Chlex和对应的最小化DFA
+ * @details 包含了含有DFA的Chlex和对应的最小化DFA。最小化DFA中没有无用状态，
+ * 状态编号为0到状态数-1，可以直接用id作为下标，起始状态为0。
+ * 状态默认从起始状态开始按广度优先的顺序编号，可以用 StateLayout 重新排列
  * @note 由DFAMinimizer生成
  */
 class MinimizedDFAChlex
@@ -141,6 +208,9 @@ private:
     std::unique_ptr<DFA> minimizedDFA;  ///< 对应的DFA
 
     friend class DFAMinimizer;
+    friend class DFAEditor;
+    friend class DFACombiner;
+    friend class StateLayout;
 
 public:
     /**
@@ -20,7 +20,11 @@ CHLEX_NAMESPACE_BEGIN
  * @details 用于从文件中读取Chlex，是一个单例类
  * Chlex语法：Chlex文件分为若干行，其中第一行为Token声明，其余行为正则表达式声明。
  * 在第一行中，声明Chlex文件中的所有Token，中间用空格分隔。
- * 在其余行中，声明正则表达式，格式为："正则表达式" {代码}。
+ * 在其余行中，声明正则表达式，格式为："正则表达式" 选项 {代码}。
+ * 选项可以省略，多个选项之间用空格分隔。目前支持的选项有：
+ * keyword：此正则表达式是关键字，若它是一个字面量且能被之后的某个正则表达式匹配，则不会被编译到DFA中，而是在匹配后通过完美哈希识别。
+ * nocase：此正则表达式忽略ASCII字母的大小写。大小写折叠在生成自动机时作用于每条字符路径，不会改变状态的数量。
+ * 忽略大小写的正则表达式不会被当作关键字处理。
  */
 class ChlexReader
 {
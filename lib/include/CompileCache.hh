@@ -0,0 +1,113 @@
+/**
+ * @file CompileCache.hh
+ * @brief 有关编译缓存的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Compiler.hh"
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 缓存的查询结果
+ */
+enum class CacheStatus
+{
+    HIT,       ///< 直接使用了缓存的映像
+    REFRESHED, ///< 自动机没有变化，只更新了缓存的映像中的代码和Token
+    MISS,      ///< 没有可用的缓存，重新编译
+};
+
+/**
+ * @brief 编译缓存类
+ * @details 将编译得到的映像（见 LexerImageWriter）保存在目录中。缓存的键只包含会影响自动机的内容：
+ * 每个正则表达式的模式和选项、编译选项以及映像的格式版本，文件名为键的64位哈希值。
+ * 正则表达式匹配后执行的代码和Token不影响自动机，只有它们变化时不需要重新编译，
+ * 只需替换映像中的字符串。映像之后附有完整的键，用于排除哈希冲突。
+ * 读取缓存文件时用 MappedLexer::validate() 检查映像的内容，损坏的缓存文件按照没有缓存处理。
+ * 编译由缓存对象持有的 Compiler 完成，因此同一个缓存对象同一时刻只能由一个线程使用。
+ */
+class CompileCache
+{
+private:
+    std::string directory;                      ///< 缓存所在的目录
+    CacheStatus lastStatus = CacheStatus::MISS; ///< 上一次查询的结果
+    Compiler compiler;                          ///< 缓存未命中时使用的编译器
+
+    /**
+     * @brief 计算缓存的键
+     * @param raw 原始Chlex
+     * @param options 编译选项
+     * @return 规范化的键，所有字段都带有长度，不同的输入不会得到相同的键
+     */
+    static std::string makeKey(const RawChlex &raw, const CompileOptions &options);
+
+    /**
+     * @brief 读取缓存文件中附在映像之后的键
+     * @param path 缓存文件的路径
+     * @param key 读取到的键
+     * @return 是否读取成功
+     */
+    static bool readKey(const std::string &path, std::string &key);
+
+    /**
+     * @brief 将映像和键写入缓存文件
+     * @details 先写入临时文件再重命名，使其他进程和线程不会读到写了一半的文件。
+     * 每次写入都使用不同的临时文件，同时写入同一个键的多个写入者各自完整地替换缓存文件
+     * @param path 缓存文件的路径
+     * @param image 映像
+     * @param key 键
+     */
+    static void store(const std::string &path, const std::string &image, const std::string &key);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param directory 缓存所在的目录，不存在时自动创建
+     */
+    explicit CompileCache(const std::string &directory);
+
+    /**
+     * @brief 获取原始Chlex对应的词法分析器，必要时编译并写入缓存
+     * @param raw 原始Chlex
+     * @param options 编译选项
+     * @return 映射了缓存文件的词法分析器
+     */
+    std::unique_ptr<MappedLexer> load(std::shared_ptr<RawChlex> raw, const CompileOptions &options = CompileOptions());
+
+    /**
+     * @brief 获取Chlex文件对应的词法分析器，必要时编译并写入缓存
+     * @param filename Chlex文件名
+     * @param options 编译选项
+     * @return 映射了缓存文件的词法分析器
+     */
+    std::unique_ptr<MappedLexer> load(const std::string &filename, const CompileOptions &options = CompileOptions());
+
+    /**
+     * @brief 获取上一次查询的结果
+     * @return 上一次查询的结果
+     */
+    CacheStatus getLastStatus() const { return lastStatus; }
+};
+
+/**
+ * @brief 编译缓存异常类
+ * @details 用于表示读写缓存目录过程中的异常
+ */
+struct CompileCacheException : public std::exception
+{
+    std::string message; ///< 异常信息
+
+    /**
+     * @brief 构造函数
+     * @param message 异常信息
+     */
+    CompileCacheException(const std::string &message) : message(message) {}
+};
+
+CHLEX_NAMESPACE_END
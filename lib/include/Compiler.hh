@@ -0,0 +1,132 @@
+/**
+ * @file Compiler.hh
+ * @brief 有关编译器上下文的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "DFAFactory.hh"
+#include "DFAMinimizer.hh"
+#include "LexerImage.hh"
+#include "RegExpParser.hh"
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 编译选项
+ * @details 决定从原始Chlex到最小化DFA的过程中使用哪些阶段，以及生成的映像的格式
+ */
+struct CompileOptions
+{
+    int threadCount = 1;          ///< 线程数，小于等于0时使用硬件支持的线程数。不影响编译结果，因此不参与缓存的键
+    bool optimizeRegExps = false; ///< 是否使用 RegExpOptimizer 规范化正则表达式
+    bool optimizeNFA = false;     ///< 是否使用 NFAOptimizer 化简NFA
+    bool useDerivatives = false;  ///< 是否使用 DerivativeDFAFactory 直接从正则表达式生成DFA，此时不生成NFA
+    bool compressTable = false;   ///< 是否使用默认转移压缩映像中的转移表（见 D2FA ）
+
+    /**
+     * @brief 是否在每个阶段完成后立即释放上一阶段的中间结果
+     * @details 生成自动机后释放抽象语法树，生成DFA后释放NFA，最小化后释放DFA，
+     * 编译过程中同时存在的只有相邻的两个阶段。得到的Chlex只能用于生成词法分析程序和映像，
+     * 不能再用 DFAEditor 编辑，否则抛出 std::invalid_argument。不影响编译结果，因此不参与缓存的键
+     */
+    bool releaseIntermediates = false;
+};
+
+/**
+ * @brief 编译器上下文类
+ * @details 按照编译选项依次调用各个阶段，把原始Chlex编译为最小化DFA、词法分析程序或映像。
+ * 各个阶段的单例类本身不保存任何状态，编译过程中可以重复使用的临时缓冲区都由编译器对象持有，
+ * 因此不同的编译器对象之间不共享可变的状态，可以分别在不同的线程中同时使用。
+ * 同一个编译器对象连续编译多个Chlex时，临时缓冲区的内存被重复使用。
+ * @note 同一个编译器对象同一时刻只能由一个线程使用
+ */
+class Compiler
+{
+private:
+    CompileOptions options;                           ///< 编译选项
+    std::vector<RegExpParserScratch> parserScratches; ///< 每个解析线程的临时缓冲区
+    DFAFactoryScratch subsetScratch;                  ///< 子集构造的临时缓冲区
+    DFAMinimizerScratch minimizerScratch;             ///< 最小化的临时缓冲区
+
+    /**
+     * @brief 释放解析后的Chlex中的抽象语法树
+     * @details 正则表达式、代码和Token仍然保留
+     * @param parsedChlex 解析后的Chlex
+     */
+    static void release(ParsedChlex &parsedChlex);
+
+    /**
+     * @brief 执行从原始Chlex到最小化DFA的各个阶段
+     * @param raw 原始Chlex
+     * @param releaseIntermediates 是否在每个阶段完成后立即释放上一阶段的中间结果
+     * @return 含有最小化DFA的Chlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> compile(std::shared_ptr<RawChlex> raw, bool releaseIntermediates);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param options 编译选项
+     */
+    explicit Compiler(const CompileOptions &options = CompileOptions()) : options(options) {}
+
+    Compiler(const Compiler &) = delete;
+    Compiler &operator=(const Compiler &) = delete;
+
+    /**
+     * @brief 获取编译选项
+     * @return 编译选项
+     */
+    const CompileOptions &getOptions() const { return options; }
+
+    /**
+     * @brief 设置之后的编译使用的编译选项
+     * @param options 编译选项
+     */
+    void setOptions(const CompileOptions &options) { this->options = options; }
+
+    /**
+     * @brief 读取Chlex文件
+     * @param filename Chlex文件名
+     * @return 原始Chlex
+     */
+    std::unique_ptr<RawChlex> read(const std::string &filename);
+
+    /**
+     * @brief 按照编译选项执行从原始Chlex到最小化DFA的各个阶段
+     * @param raw 原始Chlex
+     * @return 含有最小化DFA的Chlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> compile(std::shared_ptr<RawChlex> raw) { return compile(raw, options.releaseIntermediates); }
+
+    /**
+     * @brief 编译并收集映像的内容
+     * @details 编译时总是释放中间结果，按照编译选项压缩转移表
+     * @param raw 原始Chlex
+     * @return 展开的映像内容
+     */
+    LexerImageContent collect(std::shared_ptr<RawChlex> raw);
+
+    /**
+     * @brief 编译为只含有转移表、代码、Token和关键字的词法分析器
+     * @details 编译时总是释放中间结果，返回的词法分析器不引用任何Chlex，
+     * 占用的内存只有映像本身，适合长期持有大量词法分析器的场合
+     * @param raw 原始Chlex
+     * @return 持有映像的词法分析器
+     */
+    std::unique_ptr<MappedLexer> build(std::shared_ptr<RawChlex> raw);
+
+    /**
+     * @brief 编译并生成词法分析程序
+     * @param raw 原始Chlex
+     * @return 词法分析程序
+     */
+    std::unique_ptr<ChlexLexer> generate(std::shared_ptr<RawChlex> raw);
+};
+
+CHLEX_NAMESPACE_END
@@ -0,0 +1,106 @@
+/**
+ * @file D2FA.hh
+ * @brief 有关默认转移压缩（D²FA）的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "chlex_base.hh"
+
+#include <cstdint>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 使用默认转移压缩的转移表
+ * @details 每个状态可以有一个默认状态，只保存与默认状态不同的转移。查询时先在自己的转移中查找，
+ * 找不到则改为在默认状态的转移中查找，直到找到或者到达没有默认状态的状态（此时没有转移）。
+ * 没有默认状态的状态只保存存在的转移；有默认状态的状态在默认状态有转移而自己没有时，保存一个到-1的转移。
+ * 每个状态的转移按照字节等价类排序，连续地保存在 labels 和 targets 中
+ */
+struct D2FA
+{
+    std::vector<std::int32_t> defaults;   ///< 每个状态的默认状态，-1表示没有
+    std::vector<std::uint32_t> rowStarts; ///< 每个状态的第一个转移的位置，长度为状态数+1
+    std::vector<std::uint8_t> labels;     ///< 每个转移的字节等价类
+    std::vector<std::int32_t> targets;    ///< 每个转移到达的状态，-1表示没有转移
+
+    /**
+     * @brief 在压缩的转移表中查询转移
+     * @details 供 D2FA 和直接使用映像中的转移表的 MappedLexer 共用
+     * @param defaults 每个状态的默认状态
+     * @param rowStarts 每个状态的第一个转移的位置
+     * @param labels 每个转移的字节等价类
+     * @param targets 每个转移到达的状态
+     * @param state 状态
+     * @param byClass 字节等价类
+     * @return 到达的状态，没有转移则为-1
+     */
+    static int lookup(const std::int32_t *defaults, const std::uint32_t *rowStarts, const std::uint8_t *labels, const std::int32_t *targets, int state, int byClass)
+    {
+        while (state != -1)
+        {
+            auto end = rowStarts[state + 1];
+            for (auto i = rowStarts[state]; i < end && labels[i] <= byClass; i++)
+            {
+                if (labels[i] == byClass)
+                    return targets[i];
+            }
+            state = defaults[state];
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 获取状态经过一个字节等价类后到达的状态
+     * @param state 状态
+     * @param byClass 字节等价类
+     * @return 到达的状态，没有转移则为-1
+     */
+    int next(int state, int byClass) const { return lookup(defaults.data(), rowStarts.data(), labels.data(), targets.data(), state, byClass); }
+
+    /**
+     * @brief 获取压缩后的转移表占用的字节数
+     * @return 字节数
+     */
+    std::size_t getTableSize() const
+    {
+        return defaults.size() * sizeof(std::int32_t) + rowStarts.size() * sizeof(std::uint32_t) + labels.size() * sizeof(std::uint8_t) + targets.size() * sizeof(std::int32_t);
+    }
+};
+
+/**
+ * @brief D²FA工厂类
+ * @details 用于将完整的转移表压缩为 D2FA ，是一个单例类。
+ *
+ * 两个状态的相似度是它们转移到同一个状态的字节等价类的数量。默认状态按照相似度的最大生成树选择：
+ * 状态较多时不比较所有状态对，而是按照若干组随机选取的等价类上的转移分桶，只比较同一个桶中相邻的状态，
+ * 另外每个状态都与入度最大的若干状态比较。
+ * 之后从每棵树中度数最大的状态开始广度优先地确定每个状态的默认状态，默认状态链的长度超过上限的状态成为新的根。
+ * 使用默认状态不能减少转移数的状态也不使用默认状态。
+ */
+class D2FAFactory
+{
+private:
+    static D2FAFactory instance; ///< 单例对象
+
+public:
+    static D2FAFactory &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 压缩转移表
+     * @param stateCount 状态数
+     * @param classCount 字节等价类数，不超过256
+     * @param transitions 完整的转移表，按照状态和等价类排列，-1表示没有转移
+     * @param maxDepth 查询时最多经过的默认状态数，为0时不使用默认状态，只去掉不存在的转移
+     * @return 压缩后的转移表
+     */
+    D2FA generate(int stateCount, int classCount, const std::vector<std::int32_t> &transitions, int maxDepth = 2);
+};
+
+CHLEX_NAMESPACE_END
@@ -15,9 +15,21 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 CHLEX_NAMESPACE_BEGIN
 
+/**
+ * @brief DFA转移区间类
+ * @details 用于表示一段连续的字节上的同一个转移
+ */
+struct DFARange
+{
+    unsigned char lo; ///< 区间中最小的字节
+    unsigned char hi; ///< 区间中最大的字节
+    int to;           ///< 转移到的状态
+};
+
 /**
  * @brief DFA状态类
  * @details 用于表示DFA中的状态
@@ -26,6 +38,13 @@ struct DFAState
 {
     unsigned int id;           ///< 状态的id，也用作它的名称
     std::map<char, int> paths; ///< 从该状态出发的路径
+
+    /**
+     * @brief 将路径合并为区间
+     * @details 按照无符号字节的顺序，相邻且转移到同一个状态的字节合并为一个区间
+     * @return 按照字节排序的转移区间，没有转移的字节不在任何区间中
+     */
+    std::vector<DFARange> getRanges() const;
 };
 
 /**
@@ -34,7 +53,7 @@ struct DFAState
  */
 struct DFAEndState : public DFAState
 {
-    std::string code; ///< 终止在该状态后执行的代码
+    int rule = -1; ///< 该状态接受的正则表达式的序号，匹配后执行的代码由此在正则表达式中查找
 };
 
 /**
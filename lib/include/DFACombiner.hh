@@ -0,0 +1,116 @@
+/**
+ * @file DFACombiner.hh
+ * @brief 有关DFA的乘积运算的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief DFA乘积运算类型类
+ */
+enum class DFAOperation
+{
+    UNION,        ///< 并，两个DFA都接受时取第一个DFA的正则表达式
+    INTERSECTION, ///< 交，接受的正则表达式取自第一个DFA
+    DIFFERENCE,   ///< 差，第一个DFA接受而第二个DFA不接受的字符串
+};
+
+/**
+ * @brief DFA组合类
+ * @details 用于在不回到正则表达式的情况下组合已经生成的DFA，是一个单例类。
+ * 乘积自动机只在两个DFA的字节等价类的交上构造，每个等价类只计算一次转移；
+ * 构造时不保留死状态和不能到达终止状态的状态，之后再最小化。
+ */
+class DFACombiner
+{
+private:
+    static DFACombiner instance; ///< 单例对象
+
+    /**
+     * @brief 构造两个DFA的乘积自动机
+     * @param a 第一个DFA
+     * @param b 第二个DFA
+     * @param operation 运算类型
+     * @param ruleOffset 求并时第二个DFA中正则表达式的序号要加上的值
+     * @return 未最小化的乘积DFA，其中只有能到达终止状态的状态和起始状态
+     */
+    std::unique_ptr<DFA> buildProduct(const DFA &a, const DFA &b, DFAOperation operation, int ruleOffset);
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static DFACombiner &getInstance() { return instance; }
+
+    /**
+     * @brief 计算两个DFA的乘积
+     * @param a 第一个DFA
+     * @param b 第二个DFA
+     * @param operation 运算类型
+     * @param ruleOffset 求并时第二个DFA中正则表达式的序号要加上的值
+     * @param threadCount 最小化时使用的线程数，小于等于0时使用硬件支持的线程数
+     * @return 最小化的乘积DFA
+     */
+    std::unique_ptr<DFA> combine(const DFA &a, const DFA &b, DFAOperation operation, int ruleOffset = 0, int threadCount = 1);
+
+    /**
+     * @brief 计算两个DFA的并
+     * @param a 第一个DFA，优先级较高
+     * @param b 第二个DFA
+     * @param ruleOffset 第二个DFA中正则表达式的序号要加上的值
+     * @return 最小化的乘积DFA
+     */
+    std::unique_ptr<DFA> unite(const DFA &a, const DFA &b, int ruleOffset) { return combine(a, b, DFAOperation::UNION, ruleOffset); }
+
+    /**
+     * @brief 计算两个DFA的交
+     * @param a 第一个DFA
+     * @param b 第二个DFA
+     * @return 最小化的乘积DFA
+     */
+    std::unique_ptr<DFA> intersect(const DFA &a, const DFA &b) { return combine(a, b, DFAOperation::INTERSECTION); }
+
+    /**
+     * @brief 计算两个DFA的差
+     * @param a 第一个DFA
+     * @param b 第二个DFA
+     * @return 最小化的乘积DFA
+     */
+    std::unique_ptr<DFA> subtract(const DFA &a, const DFA &b) { return combine(a, b, DFAOperation::DIFFERENCE); }
+
+    /**
+     * @brief 合并两个分别编译的Chlex
+     * @details 第二个Chlex的正则表达式排在第一个之后，序号依次增加；Token按照名称合并。
+     * 新的DFAChlex中保存最小化之前的乘积DFA，NFAChlex不含NFA
+     * @param a 第一个含有最小化DFA的Chlex，优先级较高
+     * @param b 第二个含有最小化DFA的Chlex
+     * @param threadCount 最小化时使用的线程数，小于等于0时使用硬件支持的线程数
+     * @return 合并后的含有最小化DFA的Chlex
+     * @note 合并只使用两个最小化DFA，不需要抽象语法树。任意一个Chlex的抽象语法树已经被释放时，
+     * 结果的 ParsedChlex::hasAST() 为false，不能再用 DFAEditor 修改
+     */
+    std::unique_ptr<MinimizedDFAChlex> unite(std::shared_ptr<MinimizedDFAChlex> a, std::shared_ptr<MinimizedDFAChlex> b, int threadCount = 1);
+
+    /**
+     * @brief 按照DFA重新计算关键字的宿主
+     * @details 关键字的宿主是DFA读入关键字后到达的状态接受的正则表达式。
+     * 若该正则表达式的优先级不低于关键字，关键字已经被编译到DFA中或被遮盖，不再保留
+     * @param dfa 最小化DFA
+     * @param keywords 关键字，其中的宿主会被忽略
+     * @return 仍然需要在匹配后识别的关键字
+     */
+    static std::vector<KeywordInfo> rehostKeywords(const DFA &dfa, const std::vector<KeywordInfo> &keywords);
+};
+
+CHLEX_NAMESPACE_END
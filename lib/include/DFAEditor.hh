@@ -0,0 +1,117 @@
+/**
+ * @file DFAEditor.hh
+ * @brief 有关增量修改最小化DFA的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "DerivativeDFAFactory.hh"
+
+#include <functional>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 增量修改类
+ * @details 用于在已有的最小化DFA中添加或删除一个正则表达式，而不重新执行整个编译过程，是一个单例类。
+ *
+ * 新的DFA是原DFA与被修改的正则表达式的导数（见 DerivNodePool）的乘积自动机。乘积状态中，
+ * 被修改的正则表达式的导数为空语言的部分与原DFA完全相同，直接使用原来的状态；
+ * 此外，不能到达接受的正则表达式发生变化的状态的乘积状态也与原来的状态等价，同样被合并回原DFA。
+ * 只有剩下的受影响区域需要重新最小化：先找出其中与原DFA中某个状态等价的状态并合并到该状态，
+ * 再在其余的状态之间按轮次划分，原DFA中的状态作为固定的等价类，不需要重新划分。
+ *
+ * 最小化DFA的每个状态只记录优先级最高的正则表达式，因此删除正则表达式时，
+ * 还需要同时跟踪优先级比它低的正则表达式的导数，才能确定原来被它遮盖的状态接受哪个正则表达式。
+ * 只能到达被删除的正则表达式的状态成为死状态，与到它们的转移一起删除。
+ *
+ * 添加或删除正则表达式可能改变其他关键字的宿主（见 NFAFactory::extractKeywords() ），
+ * 因此每次修改后都按照生成NFA时的规则重新提取关键字：新提取出的关键字同样从DFA中移出，
+ * 失去宿主的关键字加入DFA，它们和被修改的正则表达式一起在乘积中跟踪。
+ * @note 原DFA是最小的时，结果也是最小的，与用NFA重新编译得到的最小化DFA相同
+ */
+class DFAEditor
+{
+private:
+    static DFAEditor instance; ///< 单例对象
+
+    /**
+     * @brief 一次修改的内容
+     */
+    struct Edit
+    {
+        DerivNodePool pool;       ///< 节点池
+        std::vector<int> roots;   ///< 乘积中跟踪的导数的初始值，第一个为所有加入或移出DFA的正则表达式的并
+        std::vector<int> ruleMap; ///< 原来每个正则表达式在新的DFA中的序号，被删除或不再编译到DFA中的为-1
+
+        /**
+         * @brief 计算乘积状态接受的正则表达式
+         * @details 参数依次为原来的状态接受的正则表达式的序号（原来的序号，不是终止状态则为-1）和各个导数，
+         * 返回新的序号，不是终止状态则为-1
+         */
+        std::function<int(int oldRule, const std::vector<int> &derivs)> accept;
+    };
+
+    /**
+     * @brief 执行修改
+     * @param chlex 原来的含有最小化DFA的Chlex
+     * @param edit 修改的内容
+     * @param parsedChlex 修改后的解析后的Chlex
+     * @param keywords 修改后的关键字，其中的序号已经更新，宿主会根据新的DFA重新计算
+     * @return 修改后的含有最小化DFA的Chlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> apply(const MinimizedDFAChlex &chlex, Edit &edit, std::shared_ptr<ParsedChlex> parsedChlex, std::vector<KeywordInfo> keywords);
+
+    /**
+     * @brief 重新提取关键字，找出需要加入或移出DFA的正则表达式并执行修改
+     * @param chlex 原来的含有最小化DFA的Chlex
+     * @param parsedChlex 修改后的解析后的Chlex
+     * @param newIndexOf 原来每个正则表达式的新序号，被删除的为-1
+     * @return 修改后的含有最小化DFA的Chlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> update(const MinimizedDFAChlex &chlex, std::shared_ptr<ParsedChlex> parsedChlex, const std::vector<int> &newIndexOf);
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static DFAEditor &getInstance() { return instance; }
+
+    /**
+     * @brief 添加一个正则表达式
+     * @param chlex 原来的含有最小化DFA的Chlex
+     * @param regExp 新的正则表达式
+     * @param position 新的正则表达式的序号，原来序号大于等于它的正则表达式的序号都加1
+     * @return 修改后的含有最小化DFA的Chlex，其中的DFAChlex不含DFA，NFAChlex不含NFA
+     * @note 原来的Chlex的抽象语法树已经被释放（见 ParsedChlex::hasAST() ）时抛出 std::invalid_argument
+     */
+    std::unique_ptr<MinimizedDFAChlex> addRule(std::shared_ptr<MinimizedDFAChlex> chlex, std::shared_ptr<RegExp> regExp, int position);
+
+    /**
+     * @brief 在末尾添加一个正则表达式
+     * @param chlex 原来的含有最小化DFA的Chlex
+     * @param regExp 新的正则表达式，优先级最低
+     * @return 修改后的含有最小化DFA的Chlex，其中的DFAChlex不含DFA，NFAChlex不含NFA
+     */
+    std::unique_ptr<MinimizedDFAChlex> addRule(std::shared_ptr<MinimizedDFAChlex> chlex, std::shared_ptr<RegExp> regExp)
+    {
+        auto position = chlex->getDFAChlex().getNFAChlex().getParsedChlex().getRegExps().size();
+        return addRule(chlex, regExp, position);
+    }
+
+    /**
+     * @brief 删除一个正则表达式
+     * @param chlex 原来的含有最小化DFA的Chlex
+     * @param rule 被删除的正则表达式的序号，原来序号大于它的正则表达式的序号都减1
+     * @return 修改后的含有最小化DFA的Chlex，其中的DFAChlex不含DFA，NFAChlex不含NFA
+     * @note 原来的Chlex的抽象语法树已经被释放（见 ParsedChlex::hasAST() ）时抛出 std::invalid_argument
+     */
+    std::unique_ptr<MinimizedDFAChlex> removeRule(std::shared_ptr<MinimizedDFAChlex> chlex, int rule);
+};
+
+CHLEX_NAMESPACE_END
@@ -13,6 +13,17 @@
 
 CHLEX_NAMESPACE_BEGIN
 
+/**
+ * @brief 并行子集构造的临时缓冲区
+ * @details 每个工作线程求闭包和move时使用的缓冲区。生成多个DFA时重复使用同一个缓冲区，可以避免每次都重新分配内存
+ */
+struct DFAFactoryScratch
+{
+    std::vector<std::vector<unsigned int>> marks;     ///< 每个线程求闭包时的访问标记，按NFA状态的下标索引
+    std::vector<unsigned int> markGenerations;        ///< 每个线程当前的访问标记，标记等于它的状态已经访问过
+    std::vector<std::vector<std::vector<int>>> moves; ///< 每个线程对每个字符求出的move
+};
+
 /**
  * @brief DFA工厂类
  * @details 用于通过NFA生成DFA，是一个单例类
@@ -54,7 +65,7 @@ private:
      * @param dfaStates DFA中的状态
      * @param nfa 状态集合所在的NFA
      * @return DFA所有终止状态的ID
-     * @note 如果状态集合中有多个终止状态，则只取第一个终止状态的代码
+     * @note 如果状态集合中有多个终止状态，则只取第一个终止状态的正则表达式
      */
     std::set<int> checkEndStates(std::vector<std::shared_ptr<std::set<int>>> &stateSets, std::vector<std::shared_ptr<DFAState>> &dfaStates, const NFA &nfa);
 
@@ -81,6 +92,43 @@ public:
      * @return 生成的DFA
      */
     std::unique_ptr<DFAChlex> generate(std::shared_ptr<NFAChlex> nfaChlex);
+
+    /**
+     * @brief 并行地通过NFA生成DFA
+     * @details 每个工作线程有一个双端队列，从自己队列的尾部取出尚未处理的状态集合，计算它的move和closure，
+     * 自己的队列为空时从其他线程队列的头部窃取。新的状态集合在分片加锁的哈希表中驻留。
+     * 所有状态集合处理完之后，从起始状态开始按字符顺序广度优先地重新编号，因此结果与线程数无关。
+     * @param nfa 用于生成DFA的NFA
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 生成的DFA
+     */
+    std::unique_ptr<DFA> generate(const NFA &nfa, int threadCount);
+
+    /**
+     * @brief 使用给定的临时缓冲区并行地通过NFA生成DFA
+     * @param nfa 用于生成DFA的NFA
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @param scratch 临时缓冲区
+     * @return 生成的DFA，与 generate(const NFA &, int) 的结果相同
+     */
+    std::unique_ptr<DFA> generate(const NFA &nfa, int threadCount, DFAFactoryScratch &scratch);
+
+    /**
+     * @brief 并行地通过Chlex对象生成DFA
+     * @param nfaChlex 用于生成DFA的Chlex对象
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 生成的DFA
+     */
+    std::unique_ptr<DFAChlex> generate(std::shared_ptr<NFAChlex> nfaChlex, int threadCount);
+
+    /**
+     * @brief 使用给定的临时缓冲区并行地通过Chlex对象生成DFA
+     * @param nfaChlex 用于生成DFA的Chlex对象
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @param scratch 临时缓冲区
+     * @return 生成的DFA
+     */
+    std::unique_ptr<DFAChlex> generate(std::shared_ptr<NFAChlex> nfaChlex, int threadCount, DFAFactoryScratch &scratch);
 };
 
 CHLEX_NAMESPACE_END
\ No newline at end of file
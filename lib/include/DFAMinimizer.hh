@@ -39,6 +39,19 @@ struct StateGroup
  */
 using MoveInfo = std::map<char, int>;
 
+/**
+ * @brief 按轮次最小化的临时缓冲区
+ * @details 最小化多个DFA时重复使用同一个缓冲区，可以避免每次都重新分配转移表和每个状态的签名
+ */
+struct DFAMinimizerScratch
+{
+    std::vector<int> moves;                   ///< 每个状态对每个字节等价类的转移
+    std::vector<int> groupOf;                 ///< 每个状态当前所在的组
+    std::vector<int> newGroupOf;              ///< 每个状态在这一轮中所在的组
+    std::vector<std::vector<int>> signatures; ///< 每个状态在这一轮中的签名
+    std::vector<std::size_t> hashes;          ///< 每个状态的签名的哈希值
+};
+
 /**
  * @brief DFA最小化类
  * @details 用于将DFA最小化，是一个单例类
@@ -71,8 +84,9 @@ public:
 
     /**
      * @brief 最小化DFA
+     * @details 先用 DFAPruner 删除无用状态，再反复划分状态组，直到一整轮中没有组被划分
      * @param dfa 要最小化的DFA
-     * @return 最小化后的DFA
+     * @return 最小化后的DFA，其中没有无用状态，状态从0开始连续编号
      */
     std::unique_ptr<DFA> minimize(const DFA &dfa);
 
@@ -82,6 +96,45 @@ public:
      * @return 最小化后的DFAChlex
      */
     std::unique_ptr<MinimizedDFAChlex> minimize(std::shared_ptr<DFAChlex> dfaChlex);
+
+    /**
+     * @brief 使用多个线程按轮次最小化DFA
+     * @details Moore算法：初始时按照接受的规则划分状态，之后每一轮中，
+     * 每个状态的签名是它当前所在的组，以及它对每个字节等价类转移到的状态所在的组。
+     * 各个线程并行地计算签名及其哈希值，再按照签名重新分组，直到组的数量不再变化。
+     * 组按照其中最小的状态的顺序编号，最后从起始状态开始按字符顺序广度优先地编号，因此结果与线程数无关。
+     * 到死状态的转移视为没有转移，因此结果中不含无用状态（见 DFAPruner）。
+     * @param dfa 要最小化的DFA
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 最小化后的DFA，状态从0开始连续编号
+     */
+    std::unique_ptr<DFA> minimize(const DFA &dfa, int threadCount);
+
+    /**
+     * @brief 使用给定的临时缓冲区和多个线程按轮次最小化DFA
+     * @param dfa 要最小化的DFA
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @param scratch 临时缓冲区
+     * @return 最小化后的DFA，与 minimize(const DFA &, int) 的结果相同
+     */
+    std::unique_ptr<DFA> minimize(const DFA &dfa, int threadCount, DFAMinimizerScratch &scratch);
+
+    /**
+     * @brief 使用多个线程按轮次最小化DFAChlex对象
+     * @param dfaChlex 要最小化的DFAChlex
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 最小化后的DFAChlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> minimize(std::shared_ptr<DFAChlex> dfaChlex, int threadCount);
+
+    /**
+     * @brief 使用给定的临时缓冲区和多个线程按轮次最小化DFAChlex对象
+     * @param dfaChlex 要最小化的DFAChlex
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @param scratch 临时缓冲区
+     * @return 最小化后的DFAChlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> minimize(std::shared_ptr<DFAChlex> dfaChlex, int threadCount, DFAMinimizerScratch &scratch);
 };
 
 CHLEX_NAMESPACE_END
\ No newline at end of file
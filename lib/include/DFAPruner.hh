@@ -0,0 +1,56 @@
+/**
+ * @file DFAPruner.hh
+ * @brief 有关删除DFA中无用状态的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief DFA剪枝类
+ * @details 用于删除DFA中的无用状态并将其余的状态连续编号，是一个单例类。
+ * 无用状态是从起始状态不可达的状态，以及不能到达任何终止状态的状态（死状态）。
+ * 到死状态的转移与没有转移等价，因此一并删除。
+ */
+class DFAPruner
+{
+private:
+    static DFAPruner instance; ///< 单例对象
+
+public:
+    static DFAPruner &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 找出DFA中能到达终止状态的状态
+     * @param dfa DFA
+     * @return 每个状态是否能到达终止状态，按照状态的id索引
+     */
+    std::vector<bool> findLiveStates(const DFA &dfa);
+
+    /**
+     * @brief 删除DFA中的无用状态
+     * @details 其余的状态从起始状态开始按字符顺序广度优先地编号为0到状态数-1，
+     * 因此起始状态的id总是0，之后可以直接用id作为下标。起始状态即使是死状态也会保留
+     * @param dfa 要剪枝的DFA
+     * @return 剪枝后的DFA
+     */
+    std::unique_ptr<DFA> prune(const DFA &dfa);
+
+    /**
+     * @brief 删除DFAChlex对象中的DFA的无用状态
+     * @param dfaChlex 要剪枝的DFAChlex
+     * @return 剪枝后的DFAChlex，与原来的DFAChlex共享NFAChlex
+     */
+    std::unique_ptr<DFAChlex> prune(std::shared_ptr<DFAChlex> dfaChlex);
+};
+
+CHLEX_NAMESPACE_END
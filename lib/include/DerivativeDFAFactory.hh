@@ -0,0 +1,326 @@
+/**
+ * @file DerivativeDFAFactory.hh
+ * @brief 有关基于Brzozowski导数的DFA构造的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+#include <bitset>
+#include <unordered_map>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 导数节点类型类
+ * @details 用于表示导数节点的类型
+ */
+enum class DerivNodeType
+{
+    EMPTY,   ///< 空语言
+    EPSILON, ///< 空串
+    CHARSET, ///< 字符集合
+    CONCAT,  ///< 连接
+    OR,      ///< 或
+    STAR,    ///< 星闭包
+};
+
+/**
+ * @brief 导数节点类
+ * @details 经过规范化和驻留的正则表达式节点。结构相同的节点在同一个节点池中只存在一份，
+ * 因此两个节点是否相同只需比较它们的id。
+ */
+struct DerivNode
+{
+    DerivNodeType type;        ///< 节点类型
+    int id;                    ///< 节点在节点池中的id
+    bool nullable;             ///< 节点是否接受空串
+    std::bitset<256> chars;    ///< 字符集合，仅对 DerivNodeType::CHARSET 有效
+    std::vector<int> children; ///< 子节点的id。连接有两个子节点，或有至少两个按id排序的子节点，星闭包有一个子节点
+};
+
+/**
+ * @brief 导数节点池类
+ * @details 负责创建并驻留导数节点。所有节点都通过智能构造函数创建，智能构造函数会对节点进行规范化，
+ * 包括消去空语言和空串、展平嵌套的或运算、合并或运算中的字符集合以及对或运算的子节点排序去重。
+ */
+class DerivNodePool
+{
+private:
+    /**
+     * @brief 节点的键
+     * @details 用于在驻留表中查找结构相同的节点
+     */
+    struct Key
+    {
+        DerivNodeType type;        ///< 节点类型
+        std::bitset<256> chars;    ///< 字符集合
+        std::vector<int> children; ///< 子节点的id
+
+        bool operator==(const Key &other) const
+        {
+            return type == other.type && chars == other.chars && children == other.children;
+        }
+    };
+
+    /**
+     * @brief 节点的键的哈希函数
+     */
+    struct KeyHash
+    {
+        std::size_t operator()(const Key &key) const;
+    };
+
+    std::vector<std::unique_ptr<DerivNode>> nodes;          ///< 所有节点，下标即为节点id
+    std::unordered_map<Key, int, KeyHash> internTable;      ///< 驻留表
+    std::unordered_map<unsigned long long, int> derivCache; ///< 导数的缓存，键为节点id和字符
+
+    int emptyId;   ///< 空语言节点的id
+    int epsilonId; ///< 空串节点的id
+
+    /**
+     * @brief 驻留一个节点
+     * @param key 节点的键
+     * @param nullable 节点是否接受空串
+     * @return 节点的id
+     */
+    int intern(Key key, bool nullable);
+
+public:
+    DerivNodePool(); ///< 构造函数
+
+    /**
+     * @brief 获取节点
+     * @param id 节点id
+     * @return 节点
+     */
+    const DerivNode &get(int id) const { return *nodes[id]; }
+
+    /**
+     * @brief 获取节点数量
+     * @return 节点数量
+     */
+    int size() const { return nodes.size(); }
+
+    /**
+     * @brief 获取空语言节点
+     * @return 空语言节点的id
+     */
+    int makeEmpty() const { return emptyId; }
+
+    /**
+     * @brief 获取空串节点
+     * @return 空串节点的id
+     */
+    int makeEpsilon() const { return epsilonId; }
+
+    /**
+     * @brief 创建字符集合节点
+     * @param chars 字符集合
+     * @return 节点的id
+     * @note 空集合会被化简为空语言
+     */
+    int makeCharSet(const std::bitset<256> &chars);
+
+    /**
+     * @brief 创建连接节点
+     * @param left 左子节点的id
+     * @param right 右子节点的id
+     * @return 节点的id
+     * @note 连接总是被规范化为右结合的形式
+     */
+    int makeConcat(int left, int right);
+
+    /**
+     * @brief 创建或节点
+     * @param left 左子节点的id
+     * @param right 右子节点的id
+     * @return 节点的id
+     */
+    int makeOr(int left, int right);
+
+    /**
+     * @brief 创建多元的或节点
+     * @param alternatives 所有子节点的id
+     * @return 节点的id
+     * @note 没有子节点时返回空语言
+     */
+    int makeOr(const std::vector<int> &alternatives);
+
+    /**
+     * @brief 创建星闭包节点
+     * @param child 子节点的id
+     * @return 节点的id
+     */
+    int makeStar(int child);
+
+    /**
+     * @brief 从正则表达式语法树创建节点
+     * @param ast 语法树根节点
+     * @param foldCase 是否忽略ASCII字母的大小写，若是，所有字符集合都会加入字母的另一种大小写形式
+     * @return 节点的id
+     * @note 有界重复按照Thompson构造估计的状态数超过 NFAFactory::maxRepeatStates 时抛出 DerivativeDFAFactoryException
+     */
+    int fromAST(const RENode &ast, bool foldCase = false);
+
+    /**
+     * @brief 求节点对某个字符的导数
+     * @param id 节点id
+     * @param byChar 字符
+     * @return 导数节点的id
+     * @note 结果会被缓存
+     */
+    int derive(int id, char byChar);
+};
+
+/**
+ * @brief 基于导数的惰性DFA类
+ * @details DFA中的每个状态是所有正则表达式对同一输入的导数组成的元组，元组中只保存不是空语言的导数。
+ * 状态只在第一次被访问时才会计算，一个状态的所有转移在第一次访问其中任何一个时一起计算，因此可以只为实际遇到的输入构造DFA。
+ * 计算转移时，先按照状态中的导数开头可能读入的字符集合把字节划分为导数类，同一个类中的字节得到相同的导数，
+ * 每个类只需要求一次导数。
+ */
+class DerivativeDFA
+{
+private:
+    DerivNodePool pool;                                       ///< 节点池
+    std::vector<std::vector<std::pair<int, int>>> states;     ///< 每个状态对应的导数元组，每项为正则表达式的序号和它的导数，按照序号排序
+    std::map<std::vector<std::pair<int, int>>, int> stateIds; ///< 从导数元组到状态id的映射
+    std::vector<int> stateRules;                              ///< 每个状态接受的正则表达式的序号，-1表示不是终止状态
+    std::vector<std::vector<int>> transitions;                ///< 每个状态对每个字节的转移，-1表示死状态，尚未计算的状态为空
+
+    /**
+     * @brief 获取导数元组对应的状态，必要时创建新状态
+     * @param derivs 导数元组，不含空语言
+     * @return 状态id，若元组为空则返回-1
+     */
+    int getOrCreateState(std::vector<std::pair<int, int>> derivs);
+
+    /**
+     * @brief 按照导数类计算一个状态的所有转移
+     * @param state 状态id
+     */
+    void expand(int state);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param parsedChlex 解析后的Chlex
+     * @param keywords 不编译到DFA中的关键字（见 NFAFactory::extractKeywords() ），包括hostRule为-1的重复关键字
+     * @note 正则表达式中的有界重复过大时抛出 DerivativeDFAFactoryException ，其中带有出错的正则表达式的序号
+     */
+    DerivativeDFA(const ParsedChlex &parsedChlex, const std::vector<KeywordInfo> &keywords = {});
+
+    /**
+     * @brief 获取起始状态
+     * @return 起始状态的id
+     */
+    int getStartState() const { return 0; }
+
+    /**
+     * @brief 获取已经构造出的状态数量
+     * @return 状态数量
+     */
+    int getStateCount() const { return states.size(); }
+
+    /**
+     * @brief 获取状态读入一个字符后到达的状态
+     * @param state 状态id
+     * @param byChar 字符
+     * @return 到达的状态id，-1表示死状态
+     * @note 如果该状态的转移尚未计算，会在此时计算它的所有转移
+     */
+    int next(int state, char byChar);
+
+    /**
+     * @brief 判断状态是否是终止状态
+     * @param state 状态id
+     * @return 是否是终止状态
+     */
+    bool isEndState(int state) const { return stateRules[state] != -1; }
+
+    /**
+     * @brief 获取终止状态接受的正则表达式的序号
+     * @param state 状态id
+     * @return 正则表达式的序号，-1表示不是终止状态
+     * @note 如果有多个正则表达式接受，则取序号最小的一个；匹配后执行的代码按照序号在 RegExp::code 中查找
+     */
+    int getRule(int state) const { return stateRules[state]; }
+
+    /**
+     * @brief 获取节点池
+     * @return 节点池
+     */
+    const DerivNodePool &getPool() const { return pool; }
+
+    /**
+     * @brief 计算所有可达状态，并生成普通的DFA
+     * @return 生成的DFA
+     */
+    std::unique_ptr<DFA> toDFA();
+};
+
+/**
+ * @brief 基于导数的DFA工厂类
+ * @details 用于不经过NFA，直接从正则表达式语法树生成DFA，是一个单例类
+ */
+class DerivativeDFAFactory
+{
+private:
+    static DerivativeDFAFactory instance; ///< 单例对象
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static DerivativeDFAFactory &getInstance() { return instance; }
+
+    /**
+     * @brief 生成惰性DFA
+     * @param parsedChlex 解析后的Chlex
+     * @return 惰性DFA，其中只有起始状态已被构造
+     */
+    std::unique_ptr<DerivativeDFA> generateLazy(const ParsedChlex &parsedChlex);
+
+    /**
+     * @brief 生成DFA
+     * @param parsedChlex 解析后的Chlex
+     * @return 生成的DFA
+     */
+    std::unique_ptr<DFA> generate(const ParsedChlex &parsedChlex);
+
+    /**
+     * @brief 通过Chlex对象生成DFA
+     * @details 与 NFAFactory 相同，满足 NFAFactory::extractKeywords() 的条件的关键字不编译到DFA中，而是放入关键字表
+     * @param parsedChlex 解析后的Chlex
+     * @return 生成的DFA
+     * @note 生成的DFAChlex中的NFAChlex不含NFA
+     */
+    std::unique_ptr<DFAChlex> generate(std::shared_ptr<ParsedChlex> parsedChlex);
+};
+
+/**
+ * @brief 基于导数的DFA工厂异常类
+ * @details 用于表示从正则表达式生成导数节点过程中的异常
+ */
+struct DerivativeDFAFactoryException : public std::exception
+{
+    std::string message; ///< 异常信息
+    int rule;            ///< 出错的正则表达式的序号。-1表示没有序号信息
+
+    /**
+     * @brief 构造函数
+     * @param message 异常信息
+     * @param rule 出错的正则表达式的序号
+     */
+    DerivativeDFAFactoryException(const std::string &message, int rule) : message(message), rule(rule) {}
+};
+
+CHLEX_NAMESPACE_END
@@ -9,10 +9,23 @@
 
 #pragma once
 
+#include "BacktrackAnalyzer.hh"
 #include "Chlex.hh"
 
 CHLEX_NAMESPACE_BEGIN
 
+/**
+ * @brief 动作表类
+ * @details 生成的词法分析程序中，每段不同的动作代码只出现一次。终止状态只记录动作的序号，
+ * 匹配结束后按照动作的序号分派。代码相同的正则表达式共用一个动作，
+ * 能匹配关键字的正则表达式需要先查询关键字，因此总是有自己的动作
+ */
+struct ActionTable
+{
+    std::vector<int> ruleActions; ///< 每个正则表达式的动作的序号，按照正则表达式的序号索引，DFA中不接受的正则表达式为-1
+    std::vector<int> actionRules; ///< 每个动作对应的第一个正则表达式的序号，动作的代码取自该正则表达式
+};
+
 /**
  * @brief 词法分析程序生成器
  * @details 用于生成词法分析程序，是一个单例类
@@ -24,10 +37,30 @@ private:
 
     /**
      * @brief 生成状态转移代码
+     * @details 按照状态的转移区间二分地比较当前字节，而不是为每个字节生成一个case。
+     * 只在可能需要回退多个字节的状态中维护回退的字节数，转移到最终接受状态后直接结束匹配。
+     * 转移到终止状态时记录它的动作，与当前状态的动作相同时不再重复记录
      * @param dfa DFA
+     * @param stateId 状态的id
+     * @param backtrack DFA的回退分析结果
+     * @param actionTable DFA的动作表
      * @return 状态转移代码
      */
-    std::string fromState(const DFA &dfa, int stateId);
+    std::string fromState(const DFA &dfa, int stateId, const BacktrackInfo &backtrack, const ActionTable &actionTable);
+
+    /**
+     * @brief 生成动作表
+     * @param chlex Chlex对象
+     * @return 最小化DFA中所有终止状态的动作表
+     */
+    ActionTable generateActionTable(const MinimizedDFAChlex &chlex);
+
+    /**
+     * @brief 生成关键字的完美哈希表和查询函数
+     * @param keywords 所有没有被编译到DFA中的关键字
+     * @return 关键字表和查询函数的代码，没有关键字时为空
+     */
+    std::string generateKeywordTable(const std::vector<KeywordInfo> &keywords);
 
     /**
      * @brief 生成词法分析程序
@@ -0,0 +1,343 @@
+/**
+ * @file LexerImage.hh
+ * @brief 有关词法分析器二进制映像的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+#include "D2FA.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 词法分析器映像的文件头
+ * @details 映像由文件头和之后的若干段组成，每段的起始位置都按8字节对齐，各段的位置记录在文件头中：
+ * 字节等价类表（uint8_t[256]）、转移表（int32_t[状态数 * 等价类数]，-1表示没有转移）、
+ * 接受表（int32_t[状态数]，每个状态接受的正则表达式的序号，-1表示不是终止状态）、
+ * 正则表达式表（LexerImageString[正则表达式数]，匹配后执行的代码）、Token表（LexerImageString[Token数]）、
+ * 关键字的完美哈希位移值（uint32_t[位移值数]）、关键字表（LexerImageKeyword[关键字数]，按照完美哈希的槽位排列）
+ * 以及所有字符串的内容。
+ * 若 flags 中有 compressedFlag ，转移表使用默认转移压缩（见 D2FA ），转移表段中只有每个转移到达的状态
+ * （int32_t[转移数]），另外还有默认状态表（int32_t[状态数]）、每个状态的第一个转移的位置（uint32_t[状态数+1]）
+ * 和每个转移的字节等价类（uint8_t[转移数]）三段。
+ * 所有整数都按照写入时的机器字节序保存，读取时用 endianTag 判断字节序是否一致。
+ */
+struct LexerImageHeader
+{
+    char magic[8];                   ///< 固定为"CHLEXIMG"
+    std::uint32_t endianTag;         ///< 固定为0x01020304，按照写入时的字节序保存
+    std::uint32_t version;           ///< 格式版本号
+    std::uint32_t stateCount;        ///< 状态数
+    std::uint32_t classCount;        ///< 字节等价类数
+    std::uint32_t startState;        ///< 起始状态
+    std::uint32_t ruleCount;         ///< 正则表达式数
+    std::uint32_t tokenCount;        ///< Token数
+    std::uint32_t keywordSeedCount;  ///< 关键字的完美哈希位移值数
+    std::uint32_t keywordCount;      ///< 关键字数
+    std::uint32_t flags;             ///< 标志
+    std::uint64_t classOffset;       ///< 字节等价类表的位置
+    std::uint64_t transitionOffset;  ///< 转移表的位置
+    std::uint64_t transitionCount;   ///< 压缩的转移表中的转移数，未压缩时为0
+    std::uint64_t defaultOffset;     ///< 默认状态表的位置，未压缩时为0
+    std::uint64_t rowOffset;         ///< 每个状态的第一个转移的位置表的位置，未压缩时为0
+    std::uint64_t labelOffset;       ///< 每个转移的字节等价类表的位置，未压缩时为0
+    std::uint64_t acceptOffset;      ///< 接受表的位置
+    std::uint64_t ruleOffset;        ///< 正则表达式表的位置
+    std::uint64_t tokenOffset;       ///< Token表的位置
+    std::uint64_t keywordSeedOffset; ///< 关键字的完美哈希位移值的位置
+    std::uint64_t keywordOffset;     ///< 关键字表的位置
+    std::uint64_t stringOffset;      ///< 字符串内容的位置
+    std::uint64_t stringSize;        ///< 字符串内容的长度
+    std::uint64_t totalSize;         ///< 整个映像的长度
+
+    static constexpr std::uint32_t currentEndianTag = 0x01020304; ///< 字节序标记
+    static constexpr std::uint32_t currentVersion = 2;            ///< 当前的格式版本号
+    static constexpr std::uint32_t compressedFlag = 1;            ///< 转移表使用默认转移压缩
+};
+
+/**
+ * @brief 映像中的字符串
+ * @details 字符串的内容保存在映像末尾的字符串段中
+ */
+struct LexerImageString
+{
+    std::uint32_t offset; ///< 字符串在字符串段中的位置
+    std::uint32_t length; ///< 字符串的长度
+};
+
+/**
+ * @brief 映像中的关键字
+ * @details 与 KeywordInfo 对应
+ */
+struct LexerImageKeyword
+{
+    LexerImageString lexeme; ///< 关键字的字符串
+    std::int32_t rule;       ///< 关键字所在的正则表达式的序号
+    std::int32_t hostRule;   ///< 能匹配该关键字的正则表达式的序号
+};
+
+/**
+ * @brief 展开的映像内容
+ * @details 与映像中的各段一一对应，但用容器保存，便于生成映像或修改映像中的一部分
+ */
+struct LexerImageContent
+{
+    std::uint32_t stateCount = 0;            ///< 状态数
+    std::uint32_t classCount = 0;            ///< 字节等价类数
+    std::uint32_t startState = 0;            ///< 起始状态
+    std::vector<std::uint8_t> classOf;       ///< 字节等价类表，长度为256
+    std::vector<std::int32_t> transitions;   ///< 转移表，压缩时只有每个转移到达的状态
+    bool compressed = false;                 ///< 转移表是否使用默认转移压缩
+    std::vector<std::int32_t> defaults;      ///< 默认状态表，只用于压缩的转移表
+    std::vector<std::uint32_t> rowStarts;    ///< 每个状态的第一个转移的位置，只用于压缩的转移表
+    std::vector<std::uint8_t> labels;        ///< 每个转移的字节等价类，只用于压缩的转移表
+    std::vector<std::int32_t> accepts;       ///< 接受表
+    std::vector<std::string> ruleCodes;      ///< 每个正则表达式匹配后执行的代码
+    std::vector<std::string> tokens;         ///< 所有Token
+    std::vector<std::uint32_t> keywordSeeds; ///< 关键字的完美哈希位移值
+    std::vector<KeywordInfo> keywords;       ///< 按照完美哈希的槽位排列的关键字
+};
+
+/**
+ * @brief 词法分析器映像生成类
+ * @details 用于将最小化的DFA及其附带的信息写为二进制映像，是一个单例类
+ */
+class LexerImageWriter
+{
+private:
+    static LexerImageWriter instance; ///< 单例对象
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static LexerImageWriter &getInstance() { return instance; }
+
+    /**
+     * @brief 收集映像的内容
+     * @details 状态按照在最小化DFA中的顺序重新编号为0到状态数-1，字节按照 ByteClassifier 的结果压缩为等价类
+     * @param chlex 含有最小化DFA的Chlex
+     * @return 展开的映像内容
+     */
+    LexerImageContent collect(const MinimizedDFAChlex &chlex);
+
+    /**
+     * @brief 使用默认转移压缩映像内容中的转移表
+     * @param content 展开的映像内容，转移表未压缩
+     * @param maxDepth 查询时最多经过的默认状态数
+     */
+    void compress(LexerImageContent &content, int maxDepth = 2);
+
+    /**
+     * @brief 将展开的映像内容写为二进制映像
+     * @param content 展开的映像内容
+     * @return 映像
+     */
+    std::string write(const LexerImageContent &content);
+
+    /**
+     * @brief 生成二进制映像
+     * @param chlex 含有最小化DFA的Chlex
+     * @return 映像
+     */
+    std::string write(const MinimizedDFAChlex &chlex) { return write(collect(chlex)); }
+
+    /**
+     * @brief 生成二进制映像并写入文件
+     * @param chlex 含有最小化DFA的Chlex
+     * @param filename 文件名
+     */
+    void write(const MinimizedDFAChlex &chlex, const std::string &filename);
+};
+
+/**
+ * @brief 内存映射的词法分析器类
+ * @details 直接在映像所在的内存上执行词法分析。从文件加载时只调用一次mmap，
+ * 之后只检查文件头，不会解析映像的内容，也不会分配内存。
+ * 也可以从展开的映像内容构造，此时映像由此对象持有，不再需要生成它的Chlex。
+ * @note 构造时只检查文件头中各段的位置是否越界，各段的内容被认为是由 LexerImageWriter 生成的。
+ * 映像来自不可信的来源时，应当在使用之前调用 validate() 检查各段的内容
+ */
+class MappedLexer
+{
+private:
+    const unsigned char *data = nullptr;         ///< 映像的内容
+    std::size_t size = 0;                        ///< 映像的长度
+    bool mapped = false;                         ///< 映像是否由此对象映射，若是则在析构时解除映射
+    std::vector<std::uint64_t> ownedImage;       ///< 由此对象持有的映像，按8字节对齐，映像由外部持有时为空
+    const LexerImageHeader *header = nullptr;    ///< 文件头
+    const std::uint8_t *classOf = nullptr;       ///< 字节等价类表
+    const std::int32_t *transitions = nullptr;   ///< 转移表
+    const std::int32_t *defaults = nullptr;      ///< 默认状态表，未压缩时为空
+    const std::uint32_t *rowStarts = nullptr;    ///< 每个状态的第一个转移的位置，未压缩时为空
+    const std::uint8_t *labels = nullptr;        ///< 每个转移的字节等价类，未压缩时为空
+    const std::int32_t *accepts = nullptr;       ///< 接受表
+    const LexerImageString *rules = nullptr;     ///< 正则表达式表
+    const LexerImageString *tokens = nullptr;    ///< Token表
+    const std::uint32_t *keywordSeeds = nullptr; ///< 关键字的完美哈希位移值
+    const LexerImageKeyword *keywords = nullptr; ///< 关键字表
+    const char *strings = nullptr;               ///< 字符串内容
+
+    /**
+     * @brief 检查文件头并计算各段的地址
+     */
+    void attach();
+
+    /**
+     * @brief 获取映像中的字符串
+     * @param string 字符串
+     * @return 字符串的内容
+     */
+    std::string_view toStringView(const LexerImageString &string) const
+    {
+        return std::string_view(strings + string.offset, string.length);
+    }
+
+public:
+    /**
+     * @brief 从文件加载映像
+     * @param filename 文件名
+     */
+    explicit MappedLexer(const std::string &filename);
+
+    /**
+     * @brief 使用已经在内存中的映像
+     * @param data 映像的内容，必须按8字节对齐，且在此对象析构之前保持有效
+     * @param size 映像的长度
+     */
+    MappedLexer(const void *data, std::size_t size);
+
+    /**
+     * @brief 从展开的映像内容生成映像并持有
+     * @param content 展开的映像内容
+     */
+    explicit MappedLexer(const LexerImageContent &content);
+
+    ~MappedLexer(); ///< 析构函数，解除映射
+
+    MappedLexer(const MappedLexer &) = delete;
+    MappedLexer &operator=(const MappedLexer &) = delete;
+
+    /**
+     * @brief 获取状态数
+     * @return 状态数
+     */
+    int getStateCount() const { return header->stateCount; }
+
+    /**
+     * @brief 获取起始状态
+     * @return 起始状态
+     */
+    int getStartState() const { return header->startState; }
+
+    /**
+     * @brief 获取映像的长度
+     * @return 文件头中记录的映像的长度，映像之后可能还有其他内容
+     */
+    std::size_t getImageSize() const { return header->totalSize; }
+
+    /**
+     * @brief 检查映像中各段的内容
+     * @details 检查所有的状态、字节等价类、正则表达式的序号和字符串的位置都在范围之内，
+     * 且默认状态不构成环，使得损坏的映像在之后的查询中不会越界访问或陷入死循环。需要遍历整个映像
+     * @note 映像损坏时抛出 LexerImageException
+     */
+    void validate() const;
+
+    /**
+     * @brief 展开映像的内容
+     * @return 展开的映像内容，用 LexerImageWriter::write(const LexerImageContent &) 可以得到相同的映像
+     */
+    LexerImageContent toContent() const;
+
+    /**
+     * @brief 获取状态经过一个字节后到达的状态
+     * @param state 状态
+     * @param byte 字节
+     * @return 到达的状态，没有转移则为-1
+     */
+    int next(int state, unsigned char byte) const
+    {
+        if (defaults != nullptr)
+            return D2FA::lookup(defaults, rowStarts, labels, transitions, state, classOf[byte]);
+        return transitions[static_cast<std::size_t>(state) * header->classCount + classOf[byte]];
+    }
+
+    /**
+     * @brief 获取状态接受的正则表达式
+     * @param state 状态
+     * @return 正则表达式的序号，不是终止状态则为-1
+     */
+    int getAcceptedRule(int state) const { return accepts[state]; }
+
+    /**
+     * @brief 查询关键字
+     * @param lexeme 匹配到的字符串
+     * @param hostRule 匹配该字符串的正则表达式的序号
+     * @return 若字符串是以 hostRule 为宿主的关键字，则为关键字所在的正则表达式的序号，否则为-1
+     */
+    int findKeyword(std::string_view lexeme, int hostRule) const;
+
+    /**
+     * @brief 从输入的开头匹配最长的词法单元
+     * @param input 输入
+     * @param rule 匹配到的正则表达式的序号（已经查询过关键字），没有匹配时为-1
+     * @return 匹配到的长度，没有匹配时为0
+     */
+    std::size_t match(std::string_view input, int &rule) const;
+
+    /**
+     * @brief 获取正则表达式的数量
+     * @return 正则表达式的数量
+     */
+    int getRuleCount() const { return header->ruleCount; }
+
+    /**
+     * @brief 获取正则表达式匹配后执行的代码
+     * @param rule 正则表达式的序号
+     * @return 代码
+     */
+    std::string_view getRuleCode(int rule) const { return toStringView(rules[rule]); }
+
+    /**
+     * @brief 获取Token的数量
+     * @return Token的数量
+     */
+    int getTokenCount() const { return header->tokenCount; }
+
+    /**
+     * @brief 获取Token的名称
+     * @param token Token的序号
+     * @return Token的名称
+     */
+    std::string_view getTokenName(int token) const { return toStringView(tokens[token]); }
+};
+
+/**
+ * @brief 词法分析器映像异常类
+ * @details 用于表示生成或加载映像过程中的异常
+ */
+struct LexerImageException : public std::exception
+{
+    std::string message; ///< 异常信息
+
+    /**
+     * @brief 构造函数
+     * @param message 异常信息
+     */
+    LexerImageException(const std::string &message) : message(message) {}
+};
+
+CHLEX_NAMESPACE_END
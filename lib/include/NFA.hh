@@ -37,7 +37,7 @@ struct NFAState
  */
 struct NFAEndState : public NFAState
 {
-    std::string code; ///< 终止在该状态后执行的代码
+    int rule = -1; ///< 该状态所属的正则表达式的序号，匹配后执行的代码由此在正则表达式中查找
 };
 
 /**
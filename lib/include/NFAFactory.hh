@@ -35,6 +35,23 @@ public:
     }
 };
 
+/**
+ * @brief 字面量前缀树节点类
+ * @details 用于在生成NFA时合并所有字面量正则表达式
+ */
+struct LiteralTrieNode
+{
+    std::map<char, int> children; ///< 子节点在前缀树中的下标
+    int endId = -1;               ///< 若有字面量在此节点结束，则为该节点对应的终止状态的id，否则为-1
+    int rule = -1;                ///< 在此节点结束的字面量所在的正则表达式的序号
+};
+
+/**
+ * @brief 共享子树的NFA片段
+ * @details 键为在抽象语法树中被多次引用的节点，值为它的NFA片段。生成NFA时复制这些片段，而不是重新生成
+ */
+using SharedNFAs = std::map<const RENode *, std::unique_ptr<NFA>>;
+
 /**
  * @brief NFA工厂类
  * @details 用于通过正则表达式生成NFA，是一个单例类
@@ -61,6 +78,32 @@ private:
      */
     std::unique_ptr<NFA> fromChar(char c, IDAllocator &idAllocator);
 
+    /**
+     * @brief 从字符集合生成NFA
+     * @param chars 字符集合
+     * @param idAllocator id分配器
+     * @return 接受集合中任意一个字符的NFA，只有两个状态
+     */
+    std::unique_ptr<NFA> fromCharSet(const std::bitset<256> &chars, IDAllocator &idAllocator);
+
+    /**
+     * @brief 复制NFA片段
+     * @param nfa 要复制的NFA片段
+     * @param idAllocator id分配器
+     * @return 复制得到的NFA片段，状态之间的相对顺序保持不变
+     * @note 输入的NFA必须只有一个终止状态
+     */
+    std::unique_ptr<NFA> clone(const NFA &nfa, IDAllocator &idAllocator);
+
+    /**
+     * @brief 将两个NFA的所有状态转移到另一个NFA中
+     * @param nfa 目标NFA，其状态表会被替换
+     * @param left 第一个NFA
+     * @param right 第二个NFA
+     * @note 较大的状态表被整个移动，较小的状态表中的节点被逐个并入，不会复制或重新分配状态
+     */
+    void mergeStates(NFA &nfa, NFA &left, NFA &right);
+
     /**
      * @brief 从或运算生成NFA
      * @param left 左操作数
@@ -108,15 +151,82 @@ private:
      */
     std::unique_ptr<NFA> fromQuestion(std::unique_ptr<NFA> nfa, IDAllocator &idAllocator);
 
+    /**
+     * @brief 从有界重复生成NFA
+     * @details 操作数只生成一次，其余副本通过 clone() 复制。必须出现的副本依次连接，
+     * 可选的副本按照a(ε|a(ε|a...))的形式嵌套，没有上限时最后一个副本取闭包
+     * @param nfa 操作数
+     * @param min 最少重复次数
+     * @param max 最多重复次数，-1表示没有上限
+     * @param idAllocator id分配器
+     * @return 操作数重复min到max次的NFA
+     * @note 输入的NFA必须只有一个终止状态。生成的状态数超过 maxRepeatStates 时抛出 NFAFactoryException
+     */
+    std::unique_ptr<NFA> fromRepeat(std::unique_ptr<NFA> nfa, int min, int max, IDAllocator &idAllocator);
+
     /**
      * @brief 从正则表达式语法树生成NFA
      * @param ast 语法树根节点
      * @param idAllocator id分配器
+     * @param sharedNFAs 共享子树的NFA片段，遇到其中的节点时直接复制对应的片段
+     * @param foldCase 是否忽略ASCII字母的大小写。若是，每个字母都生成大小写两条路径，状态的数量不变
      * @return 生成的NFA
+     * @note sharedNFAs 必须是用相同的 foldCase 生成的
      */
-    std::unique_ptr<NFA> generate(const RENode &ast, IDAllocator &idAllocator);
+    std::unique_ptr<NFA> generate(const RENode &ast, IDAllocator &idAllocator, const SharedNFAs &sharedNFAs, bool foldCase);
+
+    /**
+     * @brief 为所有正则表达式中被多次引用的子树生成NFA片段
+     * @details 经过 RegExpOptimizer 优化后，结构相同的子树只保留一份，这些子树只需要生成一次NFA片段。
+     * 只有一个字符或一个字符集合的子树不会被记录，因为复制它们并不比重新生成更快
+     * @param roots 所有正则表达式的语法树根节点
+     * @param rules 每个根节点所在的正则表达式的序号
+     * @param foldCase 是否忽略ASCII字母的大小写
+     * @return 共享子树的NFA片段
+     * @note 生成某个片段时抛出的 NFAFactoryException 带有第一个引用该片段的正则表达式的序号
+     */
+    SharedNFAs generateShared(const std::vector<const RENode *> &roots, const std::vector<int> &rules, bool foldCase);
+
+    /**
+     * @brief 判断语法树是否只由字符的连接构成
+     * @param ast 语法树根节点
+     * @param literal 如果是，此变量会被设为语法树表示的字符串
+     * @return 是否只由字符的连接构成
+     */
+    bool toLiteral(const RENode &ast, std::string &literal);
+
+    /**
+     * @brief 从字面量前缀树生成NFA
+     * @param trie 前缀树，下标为0的节点是根节点
+     * @param idAllocator id分配器
+     * @param foldCase 是否忽略ASCII字母的大小写。若是，前缀树中的字母必须是小写的，每条字母路径都会生成大小写两条路径
+     * @return 生成的NFA
+     * @note 生成的NFA不含ε路径，且每个结束字面量的节点都是一个终止状态
+     */
+    std::unique_ptr<NFA> fromLiteralTrie(const std::vector<LiteralTrieNode> &trie, IDAllocator &idAllocator, bool foldCase);
+
+    /**
+     * @brief 找出可以不编译到NFA中的关键字
+     * @details 一个被标记为关键字的字面量正则表达式，如果在它之后有另一个正则表达式能匹配它，
+     * 且在所有其余正则表达式中，这个正则表达式是第一个能匹配它的，则可以先匹配该正则表达式，再查询关键字。
+     * 忽略大小写的正则表达式不会被当作关键字，因为生成的代码按照原样查询关键字。
+     * @param parsedChlex 解析后的Chlex
+     * @param literals 每个正则表达式对应的字面量，不是字面量的为空
+     * @return 所有可以不编译到NFA中的关键字。与之前的关键字重复的关键字也不需要编译，它们的hostRule为-1
+     */
+    std::vector<KeywordInfo> extractKeywords(const ParsedChlex &parsedChlex, const std::vector<std::string> &literals);
+
+    /**
+     * @brief 用id分配器重新为NFA中的所有状态分配id
+     * @param nfa 要重新编号的NFA
+     * @param idAllocator id分配器
+     * @note 状态之间的相对顺序保持不变
+     */
+    void renumber(NFA &nfa, IDAllocator &idAllocator);
 
 public:
+    static const std::size_t maxRepeatStates = 1 << 16; ///< 一个有界重复最多生成的状态数，防止嵌套的重复生成过大的NFA
+
     /**
      * @brief 获取单例对象
      * @return 单例对象
@@ -131,13 +241,62 @@ public:
      */
     std::unique_ptr<NFA> generate(const ParsedRegExp &parsedRegExp, IDAllocator &idAllocator);
 
+    /**
+     * @brief 从正则表达式语法树生成NFA，复制共享子树的NFA片段
+     * @param parsedRegExp 解析后的正则表达式
+     * @param idAllocator id分配器
+     * @param sharedNFAs 共享子树的NFA片段
+     * @return 生成的NFA
+     */
+    std::unique_ptr<NFA> generate(const ParsedRegExp &parsedRegExp, IDAllocator &idAllocator, const SharedNFAs &sharedNFAs);
+
     /**
      * @brief 从解析后的Chlex对象生成NFA
+     * @details 只由字符的连接构成的正则表达式不会单独生成NFA，而是被合并到一棵共享前缀的字面量前缀树中，
+     * 该前缀树是一个没有ε路径的确定片段，再与其余正则表达式的NFA一起连接到新的起始状态上。
+     * 被标记为关键字的正则表达式若满足 extractKeywords() 的条件，则不会被编译到NFA中。
+     * 被多个正则表达式引用的子树（见 RegExpOptimizer）只生成一次NFA片段，之后每次引用时复制该片段。
+     * 忽略大小写的字面量放在另一棵前缀树中，共享子树的NFA片段也按照是否忽略大小写分别生成。
      * @param parsedChlex 解析后的Chlex
      * @return 生成的NFA
-     * @note 此函数中会自动创建一个id分配器
+     * @note 此函数中会自动创建一个id分配器。终止状态的id按照正则表达式的顺序分配，以保持它们的优先级
      */
     std::unique_ptr<NFAChlex> generate(std::shared_ptr<ParsedChlex> parsedChlex);
+
+    /**
+     * @brief 并行地从解析后的Chlex对象生成NFA
+     * @details 每个正则表达式的NFA片段在线程池中用各自的id分配器并行生成，
+     * 之后按照正则表达式的顺序重新编号并合并，因此结果与单线程生成的NFA完全相同。
+     * @param parsedChlex 解析后的Chlex
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 生成的NFA
+     */
+    std::unique_ptr<NFAChlex> generate(std::shared_ptr<ParsedChlex> parsedChlex, int threadCount);
+
+    /**
+     * @brief 找出解析后的Chlex中可以不编译到NFA中的关键字
+     * @details 与生成NFA时使用的规则相同，供不经过NFA修改自动机的类（见 DFAEditor ）使用
+     * @param parsedChlex 解析后的Chlex
+     * @return 所有可以不编译到NFA中的关键字。与之前的关键字重复的关键字也不需要编译，它们的hostRule为-1
+     */
+    std::vector<KeywordInfo> extractKeywords(const ParsedChlex &parsedChlex);
+};
+
+/**
+ * @brief NFA工厂异常类
+ * @details 用于表示NFA生成过程中的异常
+ */
+struct NFAFactoryException : public std::exception
+{
+    std::string message; ///< 异常信息
+    int rule;            ///< 出错的正则表达式的序号。-1表示没有序号信息
+
+    /**
+     * @brief 构造函数
+     * @param message 异常信息
+     * @param rule 出错的正则表达式的序号
+     */
+    NFAFactoryException(const std::string &message, int rule) : message(message), rule(rule) {}
 };
 
 CHLEX_NAMESPACE_END
\ No newline at end of file
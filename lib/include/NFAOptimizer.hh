@@ -0,0 +1,50 @@
+/**
+ * @file NFAOptimizer.hh
+ * @brief 有关NFA化简的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief NFA化简类
+ * @details 用于在生成DFA之前化简NFA，是一个单例类。
+ * 化简包括以下几步：消除ε路径，删除不可达和无法到达终止状态的状态，合并出边完全相同的状态，最后将剩余状态的id重新连续编号。
+ * 化简后的NFA不含ε路径，且终止状态的id按照优先级从0开始排列，
+ * 因此DFAFactory中“取id最小的终止状态”的规则在化简前后得到相同的结果。
+ */
+class NFAOptimizer
+{
+private:
+    static NFAOptimizer instance; ///< 单例对象
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static NFAOptimizer &getInstance() { return instance; }
+
+    /**
+     * @brief 化简NFA
+     * @param nfa 要化简的NFA
+     * @return 化简后的NFA
+     */
+    std::unique_ptr<NFA> optimize(const NFA &nfa);
+
+    /**
+     * @brief 化简NFAChlex对象
+     * @param nfaChlex 要化简的NFAChlex
+     * @return 化简后的NFAChlex，与原对象共享解析后的Chlex
+     */
+    std::unique_ptr<NFAChlex> optimize(std::shared_ptr<NFAChlex> nfaChlex);
+};
+
+CHLEX_NAMESPACE_END
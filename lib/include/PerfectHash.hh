@@ -0,0 +1,89 @@
+/**
+ * @file PerfectHash.hh
+ * @brief 有关最小完美哈希的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "chlex_base.hh"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 最小完美哈希类
+ * @details 将n个互不相同的字符串一一映射到[0, n)中，使用“哈希-位移”方法构造：
+ * 先对字符串求一次64位哈希值，用它选择一个桶，再用该桶的位移值扰动同一个哈希值得到槽位。
+ * 因此查询只需要遍历一次字符串，再做一次比较。
+ * @note 生成的词法分析程序中的查询代码必须与 hash() 和 slotOf() 保持一致
+ */
+struct PerfectHash
+{
+    std::vector<unsigned int> seeds; ///< 每个桶的位移值
+    std::vector<int> slots;          ///< 每个槽位中的字符串在输入中的下标
+
+    /**
+     * @brief 计算字符串的哈希值
+     * @param key 字符串
+     * @return 64位FNV-1a哈希值
+     */
+    static unsigned long long hash(const std::string &key);
+
+    /**
+     * @brief 计算字符串的哈希值
+     * @param key 字符串的首地址
+     * @param length 字符串的长度
+     * @return 64位FNV-1a哈希值，与 hash(const std::string &) 相同
+     */
+    static unsigned long long hash(const char *key, std::size_t length);
+
+    /**
+     * @brief 计算哈希值在给定位移下对应的槽位
+     * @param hash 字符串的哈希值
+     * @param seed 位移值
+     * @param slotCount 槽位数量
+     * @return 槽位
+     */
+    static unsigned long long slotOf(unsigned long long hash, unsigned int seed, unsigned long long slotCount);
+
+    /**
+     * @brief 查询字符串
+     * @param key 字符串
+     * @param keys 构造时使用的所有字符串
+     * @return 字符串在 keys 中的下标，不存在则返回-1
+     */
+    int find(const std::string &key, const std::vector<std::string> &keys) const;
+};
+
+/**
+ * @brief 最小完美哈希工厂类
+ * @details 用于为一组字符串生成最小完美哈希，是一个单例类
+ */
+class PerfectHashFactory
+{
+private:
+    static PerfectHashFactory instance; ///< 单例对象
+
+public:
+    /**
+     * @brief 获取单例对象
+     * @return 单例对象
+     */
+    static PerfectHashFactory &getInstance() { return instance; }
+
+    /**
+     * @brief 生成最小完美哈希
+     * @param keys 所有字符串，必须互不相同
+     * @return 生成的最小完美哈希
+     */
+    PerfectHash generate(const std::vector<std::string> &keys);
+};
+
+CHLEX_NAMESPACE_END
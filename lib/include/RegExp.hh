@@ -11,8 +11,14 @@
 
 #include "chlex_base.hh"
 
+#include <bitset>
+#include <cstddef>
 #include <string>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 CHLEX_NAMESPACE_BEGIN
 
@@ -22,8 +28,10 @@ CHLEX_NAMESPACE_BEGIN
  */
 struct RegExp
 {
-    std::string pattern; ///< 正则表达式的模式
-    std::string code;    ///< 正则表达式匹配后执行的代码
+    std::string pattern;   ///< 正则表达式的模式
+    std::string code;      ///< 正则表达式匹配后执行的代码
+    bool keyword = false;  ///< 是否是关键字，关键字可以在匹配其他正则表达式之后再通过哈希表识别
+    bool caseless = false; ///< 是否忽略ASCII字母的大小写，在生成自动机时把每条字母路径扩展为大小写两条
 };
 
 /**
@@ -33,16 +41,19 @@ struct RegExp
 enum class RENodeType
 {
     CHAR,     ///< 字符
+    CHARSET,  ///< 字符集合，由 RegExpOptimizer 合并多个字符的或运算得到
     OR,       ///< 或
     CONCAT,   ///< 连接
     STAR,     ///< 星闭包
     PLUS,     ///< 正闭包
     QUESTION, ///< 问号闭包
+    REPEAT,   ///< 有界重复，即{m}、{m,}和{m,n}
 };
 
 /**
  * @brief 正则表达式节点类
  * @details 用于表示正则表达式抽象语法树的节点，是所有具体节点的基类
+ * @note 节点由 RENodeArena 分配，子节点用裸指针连接，不会被单独析构，因此节点类型必须是可平凡析构的
  */
 struct RENode
 {
@@ -72,20 +83,64 @@ struct CharNode : public RENode
     CharNode(char value) : RENode(RENodeType::CHAR), value(value) {}
 };
 
+/**
+ * @brief 字符集合节点类
+ * @details 用于表示正则表达式抽象语法树中的字符集合节点，匹配集合中的任意一个字符
+ */
+struct CharSetNode : public RENode
+{
+    std::bitset<256> chars; ///< 集合中的字符，按照unsigned char的值索引
+
+    /**
+     * @brief 构造函数
+     * @param chars 集合中的字符
+     *
+     * @note 节点类型会被自动设为 RENodeType::CHARSET
+     */
+    CharSetNode(const std::bitset<256> &chars) : RENode(RENodeType::CHARSET), chars(chars) {}
+
+    /**
+     * @brief 对字符集合做大小写折叠
+     * @param chars 字符集合
+     * @return 加入了集合中每个ASCII字母的另一种大小写形式的集合
+     */
+    static std::bitset<256> foldCase(const std::bitset<256> &chars);
+};
+
 /**
  * @brief 单目运算符节点类
  * @details 用于表示正则表达式抽象语法树中的单目运算符节点，包括星闭包、正闭包和问号闭包
  */
 struct MonoOpNode : public RENode
 {
-    std::unique_ptr<RENode> child; ///< 子节点
+    RENode *child; ///< 子节点
 
     /**
      * @brief 构造函数
      * @param type 节点类型，必须是 RENodeType::STAR、RENodeType::PLUS 或 RENodeType::QUESTION
      * @param child 子节点
      */
-    MonoOpNode(RENodeType type, std::unique_ptr<RENode> child) : RENode(type), child(std::move(child)) {}
+    MonoOpNode(RENodeType type, RENode *child) : RENode(type), child(child) {}
+};
+
+/**
+ * @brief 重复节点类
+ * @details 用于表示正则表达式抽象语法树中的有界重复，子节点重复min到max次
+ */
+struct RepeatNode : public MonoOpNode
+{
+    int min; ///< 最少重复次数
+    int max; ///< 最多重复次数，-1表示没有上限
+
+    /**
+     * @brief 构造函数
+     * @param child 子节点
+     * @param min 最少重复次数
+     * @param max 最多重复次数，-1表示没有上限
+     *
+     * @note 节点类型会被自动设为 RENodeType::REPEAT
+     */
+    RepeatNode(RENode *child, int min, int max) : MonoOpNode(RENodeType::REPEAT, child), min(min), max(max) {}
 };
 
 /**
@@ -94,8 +149,8 @@ struct MonoOpNode : public RENode
  */
 struct BiOpNode : public RENode
 {
-    std::unique_ptr<RENode> left;  ///< 左子节点
-    std::unique_ptr<RENode> right; ///< 右子节点
+    RENode *left;  ///< 左子节点
+    RENode *right; ///< 右子节点
 
     /**
      * @brief 构造函数
@@ -103,8 +158,56 @@ struct BiOpNode : public RENode
      * @param left 左子节点
      * @param right 右子节点
      */
-    BiOpNode(RENodeType type, std::unique_ptr<RENode> left, std::unique_ptr<RENode> right)
-        : RENode(type), left(std::move(left)), right(std::move(right)) {}
+    BiOpNode(RENodeType type, RENode *left, RENode *right) : RENode(type), left(left), right(right) {}
+};
+
+/**
+ * @brief 正则表达式节点分配器类
+ * @details 以块为单位分配内存，每次分配只移动块内的指针，所有节点在分配器析构时一起释放。
+ * 同一条正则表达式的节点在内存中是连续的，便于之后遍历。
+ */
+class RENodeArena
+{
+private:
+    static const std::size_t blockSize = 16384; ///< 每个块的默认大小
+
+    std::vector<std::unique_ptr<std::byte[]>> blocks; ///< 所有块
+    std::byte *current = nullptr;                     ///< 当前块中下一个可用的位置
+    std::size_t remaining = 0;                        ///< 当前块中剩余的字节数
+
+    /**
+     * @brief 分配一段内存
+     * @param size 字节数
+     * @return 分配得到的内存，按照 std::max_align_t 对齐
+     */
+    void *allocate(std::size_t size);
+
+public:
+    RENodeArena() = default;
+    RENodeArena(const RENodeArena &) = delete;
+    RENodeArena &operator=(const RENodeArena &) = delete;
+    RENodeArena(RENodeArena &&) = default;
+    RENodeArena &operator=(RENodeArena &&) = default;
+
+    /**
+     * @brief 在分配器中构造一个节点
+     * @tparam T 节点类型
+     * @param args 构造函数的参数
+     * @return 构造得到的节点，由分配器持有
+     */
+    template <typename T, typename... Args>
+    T *make(Args &&...args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "RENode must be trivially destructible");
+        return new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 接管另一个分配器中的所有节点
+     * @details 用于合并各个线程分别使用的分配器，之后 other 为空，原来由它分配的节点仍然有效
+     * @param other 另一个分配器
+     */
+    void splice(RENodeArena &other);
 };
 
 /**
@@ -114,15 +217,14 @@ struct BiOpNode : public RENode
 struct ParsedRegExp
 {
     std::shared_ptr<RegExp> regExp; ///< 原始正则表达式
-    std::unique_ptr<RENode> ast;    ///< 抽象语法树
+    RENode *ast;                    ///< 抽象语法树，由所在的 ParsedChlex 的分配器持有，释放后为空
 
     /**
      * @brief 构造函数
      * @param regExp 原始正则表达式
      * @param ast 抽象语法树
      */
-    ParsedRegExp(const std::shared_ptr<RegExp> &regExp, std::unique_ptr<RENode> ast)
-        : regExp(regExp), ast(std::move(ast)) {}
+    ParsedRegExp(const std::shared_ptr<RegExp> &regExp, RENode *ast) : regExp(regExp), ast(ast) {}
 };
 
 CHLEX_NAMESPACE_END
\ No newline at end of file
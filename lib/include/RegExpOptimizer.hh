@@ -0,0 +1,42 @@
+/**
+ * @file RegExpOptimizer.hh
+ * @brief 有关正则表达式抽象语法树优化的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 正则表达式优化器类
+ * @details 用于在生成NFA之前规范化所有正则表达式的抽象语法树，是一个单例类。
+ * 规范化包括：
+ * - 展开嵌套的或运算和连接，重新组成右结合的链；
+ * - 将或运算中的所有字符合并为一个字符集合，并去掉重复的分支；
+ * - 化简嵌套的闭包，例如(a*)*、(a?)*和(a+)*都化简为a*；
+ * - 对所有正则表达式中结构相同的子树只保留一份，使得抽象语法树成为一个有向无环图。
+ * NFAFactory 会为被多次引用的子树只生成一次NFA片段。
+ */
+class RegExpOptimizer
+{
+private:
+    static RegExpOptimizer instance; ///< 单例对象
+
+public:
+    static RegExpOptimizer &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 优化解析后的Chlex对象
+     * @param parsedChlex 解析后的Chlex
+     * @return 优化后的Chlex，其节点由它自己的分配器持有，与原来的Chlex无关
+     */
+    std::unique_ptr<ParsedChlex> optimize(std::shared_ptr<ParsedChlex> parsedChlex);
+};
+
+CHLEX_NAMESPACE_END
@@ -10,17 +10,47 @@
 #pragma once
 
 #include "Chlex.hh"
+#include "Unicode.hh"
 
+#include <bitset>
 #include <vector>
 
 CHLEX_NAMESPACE_BEGIN
 
+/**
+ * @brief 正则表达式解析器的临时缓冲区
+ * @details 解析时使用的各个栈。解析多个正则表达式时重复使用同一个缓冲区，可以避免每次解析都重新分配内存
+ */
+struct RegExpParserScratch
+{
+    /**
+     * @brief 括号帧
+     * @details 记录一个尚未闭合的'('，以及它之前的运算符栈和节点栈的大小
+     */
+    struct Frame
+    {
+        int opBase;   ///< '('之前运算符栈的大小
+        int nodeBase; ///< '('之前节点栈的大小
+        int pos;      ///< '('的位置
+    };
+
+    std::vector<char> opStack;       ///< 运算符栈
+    std::vector<RENode *> nodeStack; ///< 节点栈
+    std::vector<Frame> frames;       ///< 尚未闭合的括号
+};
+
 /**
  * @brief 正则表达式解析器类
  * @details 此类是一个单例类，用于将正则表达式解析为抽象语法树。
- * 其正则表达式支持以下运算符：|，+，*，?，()，[]，-，.。
- * 在解析过程中，()，[]，-和.会被展开，所以它们不会出现在抽象语法树中。
- * 另外，正则表达式支持以下转义字符：\\，\"，\d，\s，\xhh
+ * 其正则表达式支持以下运算符：|，+，*，?，{m}，{m,}，{m,n}，()，[]，-，.。
+ * 在解析过程中，()会被展开，[]，-和.会被转换为字符集合，所以它们不会出现在抽象语法树中。
+ * 不构成合法重复次数的'{'按照字符本身处理，重复次数不能超过 maxRepeatCount 。
+ * 另外，正则表达式支持以下转义字符：\\，\"，\d，\s，\xhh，以及用于匹配运算符本身的\|，\*，\+，\?，\(，\)，\[，\]，\-，\.，\{，\}
+ *
+ * 正则表达式按照UTF-8处理：\xhh表示一个原始字节，\u{h...}表示一个码位，\p{类别}和\P{类别}表示Unicode通用类别及其补集，
+ * []中的非ASCII字符被解码为码位，码位也可以作为-的端点。所有码位最终都被编译为匹配其UTF-8编码的字节序列，见 Utf8Compiler
+ *
+ * 解析过程不使用递归，括号的嵌套层数只受内存限制
  */
 class RegExpParser
 {
@@ -28,84 +58,181 @@ private:
     static RegExpParser instance; ///< 单例对象
 
     /**
-     * @brief 从某个位置开始解析正则表达式
+     * @brief 解析正则表达式
      *
      * @param re 正则表达式
-     * @param pos 开始解析的位置
-     * @param inBrace 是否在()中
-     * @param inBracket 是否在[]中
-     * @param endPos 解析结束后，此变量会被设为解析结束的位置
+     * @param arena 节点的分配器
+     * @param scratch 临时缓冲区
      *
      * @return 解析得到的节点
      */
-    std::unique_ptr<RENode> parseFrom(const std::string &re, int pos, int &endPos, bool inBrace, bool inBracket);
+    RENode *parseFrom(const std::string &re, RENodeArena &arena, RegExpParserScratch &scratch);
 
     /**
-     * @brief 清空运算符栈和节点栈，将其中的内容组装为一个节点，然后压入节点栈
+     * @brief 清空运算符栈和节点栈中属于当前括号的部分，将其中的内容组装为一个节点，然后压入节点栈
      *
      * @param opStack 运算符栈
      * @param nodeStack 节点栈
+     * @param opBase 当前括号之前运算符栈的大小
+     * @param nodeBase 当前括号之前节点栈的大小
+     * @param arena 节点的分配器
+     */
+    void popStacks(std::vector<char> &opStack, std::vector<RENode *> &nodeStack, int opBase, int nodeBase, RENodeArena &arena);
+
+    /**
+     * @brief 解析一个转义字符
+     *
+     * @param re 正则表达式
+     * @param pos '\'的位置
+     * @param bytes 转义字符表示的字节会被加入此集合
+     * @param codePoints 转义字符表示的码位（'\u'和'\p'）会被加入此集合
+     *
+     * @return 转义字符的最后一个字符的位置
+     */
+    int parseEscape(const std::string &re, int pos, std::bitset<256> &bytes, CodePointSet &codePoints);
+
+    /**
+     * @brief 解析重复次数
+     *
+     * @param re 正则表达式
+     * @param pos '{'的位置
+     * @param min 最少重复次数
+     * @param max 最多重复次数，-1表示没有上限
+     *
+     * @return '}'的位置。若'{'之后不是合法的重复次数，则返回-1，此时'{'应按照字符本身处理
      */
-    void popStacks(std::vector<char> &opStack, std::vector<std::unique_ptr<RENode>> &nodeStack);
+    int parseRepeat(const std::string &re, int pos, int &min, int &max);
 
     /**
-     * @brief 通过'.'构造一个节点
+     * @brief 将正则表达式中的一个UTF-8字符解码为码位
      *
-     * @return 一个由所有字符通过或运算符连接而成的节点
+     * @param re 正则表达式
+     * @param pos UTF-8字符的首字节的位置
+     * @param codePoint 解码得到的码位
+     *
+     * @return UTF-8字符的最后一个字节的位置
      */
-    std::unique_ptr<RENode> makeFromDot();
+    int parseUtf8(const std::string &re, int pos, unsigned int &codePoint);
 
     /**
-     * @brief 通过'-'构造一个节点
+     * @brief 解析[]中的内容
+     *
+     * @param re 正则表达式
+     * @param pos '['的位置
+     * @param bytes []表示的字节会被加入此集合
+     * @param codePoints []表示的码位会被加入此集合
+     *
+     * @return ']'的位置
+     */
+    int parseBracket(const std::string &re, int pos, std::bitset<256> &bytes, CodePointSet &codePoints);
+
+    /**
+     * @brief 获取十六进制数字的值
+     *
+     * @param c 字符
+     *
+     * @return 数字的值，不是十六进制数字则返回-1
+     */
+    int hexValue(char c);
+
+    /**
+     * @brief 通过字节集合和码位集合构造一个节点
+     *
+     * @param bytes 字节集合
+     * @param codePoints 码位集合，其中的非ASCII码位由 Utf8Compiler 编译为UTF-8字节序列
+     * @param arena 节点的分配器
+     *
+     * @return 只有一个字节时为字符节点，只有字节时为字符集合节点，否则为 Utf8Compiler 生成的节点
+     */
+    RENode *makeFromChars(const std::bitset<256> &bytes, const CodePointSet &codePoints, RENodeArena &arena);
+
+    /**
+     * @brief 通过'.'构造一个字符集合
+     *
+     * @return 除0以外的所有ASCII字符
+     */
+    std::bitset<256> makeFromDot();
+
+    /**
+     * @brief 通过'-'构造一个字符集合
      *
      * @param from 起始字符
      * @param to 终止字符
      *
-     * @return 一个由 @ref from 和 @ref to 之间所有字符通过或运算符连接而成的节点
+     * @return @ref from 和 @ref to 之间的所有字符
      */
-    std::unique_ptr<RENode> makeFromRange(char from, char to);
+    std::bitset<256> makeFromRange(char from, char to);
 
     /**
-     * @brief 通过'\d'构造一个节点
+     * @brief 通过'\d'构造一个字符集合
      *
-     * @return 一个由所有数字字符通过或运算符连接而成的节点
+     * @return 所有数字字符
      */
-    std::unique_ptr<RENode> makeFromDigits();
+    std::bitset<256> makeFromDigits();
 
     /**
-     * @brief 通过'\s'构造一个节点
+     * @brief 通过'\s'构造一个字符集合
      *
-     * @return 一个由所有空白字符通过或运算符连接而成的节点
+     * @return 所有空白字符
      */
-    std::unique_ptr<RENode> makeFromEmpty();
+    std::bitset<256> makeFromEmpty();
 
 public:
+    static const int maxRepeatCount = 1000; ///< {m,n}中m和n的上限，更大的重复次数会被拒绝
+
     /**
      * @brief 获取单例对象
      * @return 单例对象
      */
     static RegExpParser &getInstance() { return instance; }
 
+    /**
+     * @brief 使用给定的临时缓冲区解析正则表达式
+     * @param re 正则表达式
+     * @param arena 节点的分配器，解析得到的节点由它持有
+     * @param scratch 临时缓冲区
+     * @return 解析得到的抽象语法树
+     */
+    RENode *parse(const std::string &re, RENodeArena &arena, RegExpParserScratch &scratch)
+    {
+        return parseFrom(re, arena, scratch);
+    }
+
     /**
      * @brief 解析正则表达式
      * @param re 正则表达式
+     * @param arena 节点的分配器，解析得到的节点由它持有
      * @return 解析得到的抽象语法树
      */
-    std::unique_ptr<RENode> parse(const std::string &re)
+    RENode *parse(const std::string &re, RENodeArena &arena)
+    {
+        RegExpParserScratch scratch;
+        return parseFrom(re, arena, scratch);
+    }
+
+    /**
+     * @brief 使用给定的临时缓冲区解析正则表达式对象
+     * @param regExp 正则表达式
+     * @param arena 节点的分配器，解析得到的节点由它持有
+     * @param scratch 临时缓冲区
+     * @return 解析得到的结果
+     */
+    std::unique_ptr<ParsedRegExp> parse(std::shared_ptr<RegExp> regExp, RENodeArena &arena, RegExpParserScratch &scratch)
     {
-        int _;
-        return parseFrom(re, 0, _, false, false);
+        auto ast = parseFrom(regExp->pattern, arena, scratch);
+        return std::make_unique<ParsedRegExp>(regExp, ast);
     }
 
     /**
      * @brief 解析正则表达式对象
      * @param regExp 正则表达式
+     * @param arena 节点的分配器，解析得到的节点由它持有
      * @return 解析得到的结果
      */
-    std::unique_ptr<ParsedRegExp> parse(std::shared_ptr<RegExp> regExp)
+    std::unique_ptr<ParsedRegExp> parse(std::shared_ptr<RegExp> regExp, RENodeArena &arena)
     {
-        auto ast = parse(regExp->pattern);
-        return std::make_unique<ParsedRegExp>(regExp, std::move(ast));
+        RegExpParserScratch scratch;
+        return parse(regExp, arena, scratch);
     }
 
     /**
@@ -114,6 +241,23 @@ public:
      * @return 解析得到的结果
      */
     std::unique_ptr<ParsedChlex> parse(std::shared_ptr<RawChlex> raw);
+
+    /**
+     * @brief 并行解析Chlex对象
+     * @param raw 原始Chlex
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @return 解析得到的结果，与 parse(std::shared_ptr<RawChlex>) 的结果相同
+     */
+    std::unique_ptr<ParsedChlex> parse(std::shared_ptr<RawChlex> raw, int threadCount);
+
+    /**
+     * @brief 使用给定的临时缓冲区并行解析Chlex对象
+     * @param raw 原始Chlex
+     * @param threadCount 线程数，小于等于0时使用硬件支持的线程数
+     * @param scratches 每个线程的临时缓冲区，不足线程数时自动补足
+     * @return 解析得到的结果，与 parse(std::shared_ptr<RawChlex>) 的结果相同
+     */
+    std::unique_ptr<ParsedChlex> parse(std::shared_ptr<RawChlex> raw, int threadCount, std::vector<RegExpParserScratch> &scratches);
 };
 
 /**
@@ -0,0 +1,98 @@
+/**
+ * @file StateLayout.hh
+ * @brief 有关DFA状态排列的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "Chlex.hh"
+
+#include <cstdint>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 状态排列顺序类
+ */
+enum class StateOrder
+{
+    BREADTH_FIRST, ///< 从起始状态开始按字符顺序广度优先
+    HOTNESS,       ///< 按照样本输入上每个状态被访问的次数从多到少，次数相同时按广度优先的顺序
+};
+
+/**
+ * @brief 状态排列类
+ * @details 用于在生成词法分析程序之前重新为最小化DFA的状态编号，是一个单例类。
+ * 状态的id决定了它在转移表中的行和生成的代码中case的位置，
+ * 经常访问的状态（起始状态、标识符和空白的循环等）编号相邻时，它们的转移在转移表中相邻，
+ * 可以共享缓存行。无论使用哪种顺序，起始状态的id总是0
+ */
+class StateLayout
+{
+private:
+    static StateLayout instance; ///< 单例对象
+
+    /**
+     * @brief 计算广度优先的顺序
+     * @param dfa 状态从0开始连续编号的DFA
+     * @return 按顺序排列的状态id
+     */
+    std::vector<int> breadthFirstOrder(const DFA &dfa);
+
+    /**
+     * @brief 按照新的编号复制DFA
+     * @param dfa 状态从0开始连续编号的DFA
+     * @param order 按新编号排列的状态id
+     * @return 重新编号后的DFA
+     */
+    std::unique_ptr<DFA> renumber(const DFA &dfa, const std::vector<int> &order);
+
+public:
+    static StateLayout &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 统计样本输入上每个状态被访问的次数
+     * @details 按照最长匹配的规则在DFA上运行样本输入，每读入一个字节就为当前状态计数一次，
+     * 即统计每个状态的转移被查询的次数。无法匹配的字节被跳过
+     * @param dfa 状态从0开始连续编号的DFA
+     * @param sample 样本输入
+     * @return 每个状态被访问的次数，按照状态的id索引
+     */
+    std::vector<std::uint64_t> profile(const DFA &dfa, const std::string &sample);
+
+    /**
+     * @brief 重新排列DFA的状态
+     * @param dfa 状态从0开始连续编号的DFA
+     * @param order 排列顺序
+     * @param weights 每个状态被访问的次数，按照状态的id索引，见 profile 。只用于 StateOrder::HOTNESS
+     * @return 重新编号后的DFA
+     */
+    std::unique_ptr<DFA> layout(const DFA &dfa, StateOrder order, const std::vector<std::uint64_t> &weights = {});
+
+    /**
+     * @brief 重新排列含有最小化DFA的Chlex中的状态
+     * @param chlex 含有最小化DFA的Chlex
+     * @param order 排列顺序
+     * @param weights 每个状态被访问的次数，按照状态的id索引，见 profile 。只用于 StateOrder::HOTNESS
+     * @return 重新编号后的含有最小化DFA的Chlex，与原来的Chlex共享DFAChlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> layout(std::shared_ptr<MinimizedDFAChlex> chlex, StateOrder order, const std::vector<std::uint64_t> &weights = {});
+
+    /**
+     * @brief 按照样本输入上的访问次数重新排列含有最小化DFA的Chlex中的状态
+     * @param chlex 含有最小化DFA的Chlex
+     * @param sample 样本输入
+     * @return 重新编号后的含有最小化DFA的Chlex，与原来的Chlex共享DFAChlex
+     */
+    std::unique_ptr<MinimizedDFAChlex> layout(std::shared_ptr<MinimizedDFAChlex> chlex, const std::string &sample)
+    {
+        return layout(chlex, StateOrder::HOTNESS, profile(chlex->getMinimizedDFA(), sample));
+    }
+};
+
+CHLEX_NAMESPACE_END
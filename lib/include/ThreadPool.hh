@@ -0,0 +1,77 @@
+/**
+ * @file ThreadPool.hh
+ * @brief 有关线程池的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "chlex_base.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief 线程池类
+ * @details 用于并行执行一批相互独立的任务。调用 run() 的线程也会参与执行任务，
+ * 因此线程数为1的线程池不会创建任何额外的线程。
+ */
+class ThreadPool
+{
+private:
+    std::vector<std::thread> workers;                   ///< 工作线程
+    std::mutex mutex;                                   ///< 保护以下各个变量的互斥锁
+    std::condition_variable wakeCondition;              ///< 通知工作线程有新的一批任务
+    std::condition_variable doneCondition;              ///< 通知调用者工作线程已经完成
+    const std::function<void(int, int)> *job = nullptr; ///< 当前这批任务
+    int taskCount = 0;                                  ///< 当前这批任务的数量
+    std::atomic<int> nextTask{0};                       ///< 下一个要执行的任务
+    int runningWorkers = 0;                             ///< 仍在执行当前这批任务的工作线程数量
+    unsigned int generation = 0;                        ///< 任务批次的编号，用于唤醒工作线程
+    bool stopping = false;                              ///< 线程池是否正在析构
+    std::exception_ptr error;                           ///< 任务抛出的第一个异常
+
+    /**
+     * @brief 执行当前这批任务，直到所有任务都被领取
+     * @param thread 执行任务的线程的序号
+     */
+    void work(int thread);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param threadCount 线程数，包括调用 run() 的线程。小于等于0时使用硬件支持的线程数
+     */
+    explicit ThreadPool(int threadCount);
+
+    ~ThreadPool(); ///< 析构函数，等待所有工作线程退出
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief 获取线程数
+     * @return 线程数，包括调用 run() 的线程
+     */
+    int getThreadCount() const { return workers.size() + 1; }
+
+    /**
+     * @brief 并行执行一批任务，并等待它们全部完成
+     * @param taskCount 任务数量
+     * @param function 任务函数，参数依次为任务的序号和执行任务的线程的序号（0到线程数-1）
+     * @note 如果有任务抛出异常，在所有任务结束后重新抛出第一个异常
+     */
+    void run(int taskCount, const std::function<void(int task, int thread)> &function);
+};
+
+CHLEX_NAMESPACE_END
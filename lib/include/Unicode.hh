@@ -0,0 +1,161 @@
+/**
+ * @file Unicode.hh
+ * @brief 有关Unicode字符集合及其UTF-8编码的各个类的声明
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#pragma once
+
+#include "RegExp.hh"
+
+#include <bitset>
+#include <map>
+#include <string>
+#include <vector>
+
+CHLEX_NAMESPACE_BEGIN
+
+/**
+ * @brief Unicode通用类别
+ */
+enum class UnicodeCategory : unsigned char
+{
+    Lu, Ll, Lt, Lm, Lo,         ///< 字母
+    Mn, Mc, Me,                 ///< 标记
+    Nd, Nl, No,                 ///< 数字
+    Pc, Pd, Ps, Pe, Pi, Pf, Po, ///< 标点
+    Sm, Sc, Sk, So,             ///< 符号
+    Zs, Zl, Zp,                 ///< 分隔符
+    Cc, Cf, Cs, Co, Cn,         ///< 其他
+};
+
+/**
+ * @brief 属于同一个通用类别的一段连续码位
+ */
+struct UnicodeCategoryRange
+{
+    unsigned int from;        ///< 起始码位
+    unsigned int to;          ///< 终止码位（包含）
+    UnicodeCategory category; ///< 通用类别
+};
+
+extern const UnicodeCategoryRange unicodeCategoryRanges[]; ///< 所有已分配码位的通用类别，按码位排序，定义在UnicodeTables.cc中
+extern const int unicodeCategoryRangeCount;                ///< unicodeCategoryRanges的长度
+
+/**
+ * @brief 码位范围
+ */
+struct CodePointRange
+{
+    unsigned int from; ///< 起始码位
+    unsigned int to;   ///< 终止码位（包含）
+};
+
+/**
+ * @brief 码位集合类
+ * @details 用有序、互不相交且互不相邻的范围表示的Unicode码位集合。集合中不会含有0和代理码位（U+D800到U+DFFF）
+ */
+class CodePointSet
+{
+private:
+    std::vector<CodePointRange> ranges; ///< 集合中的所有范围
+
+public:
+    static constexpr unsigned int maxCodePoint = 0x10FFFF; ///< 最大的码位
+
+    /**
+     * @brief 向集合中加入一个范围
+     * @param from 起始码位
+     * @param to 终止码位（包含）
+     * @note 范围中的0和代理码位会被忽略
+     */
+    void add(unsigned int from, unsigned int to);
+
+    /**
+     * @brief 向集合中加入另一个集合中的所有码位
+     * @param other 另一个集合
+     */
+    void add(const CodePointSet &other);
+
+    /**
+     * @brief 求集合的补集
+     * @return 所有不在集合中的码位，不含0和代理码位
+     */
+    CodePointSet complement() const;
+
+    /**
+     * @brief 获取集合中的所有范围
+     * @return 有序、互不相交且互不相邻的范围
+     */
+    const std::vector<CodePointRange> &getRanges() const { return ranges; }
+
+    /**
+     * @brief 判断集合是否为空
+     * @return 是否为空
+     */
+    bool empty() const { return ranges.empty(); }
+
+    /**
+     * @brief 获取Unicode通用类别对应的码位集合
+     * @param name 类别名，可以是两个字母的类别（如"Lu"），也可以是一个字母的大类（如"L"）
+     * @param result 类别中的码位会被加入此集合
+     * @return 类别名是否有效
+     */
+    static bool fromCategory(const std::string &name, CodePointSet &result);
+};
+
+/**
+ * @brief UTF-8编译器类
+ * @details 用于将码位集合编译为匹配其UTF-8编码的字节序列的抽象语法树，是一个单例类。
+ * 每个码位范围先按照编码长度和续字节的边界拆分，使得拆分后的每一段都可以表示为一串字节范围，
+ * 例如U+0800到U+FFFF被拆分为[E0][A0-BF][80-BF]、[E1-EC][80-BF][80-BF]等。
+ * 之后，所有字节序列合并为一棵按照字节确定的前缀树：每个节点中，之后剩余部分相同的字节合并为一个字符集合，
+ * 剩余部分相同的节点共享同一个子树。生成的片段中每个字节只有一条路径，子集构造时不会产生多余的状态，
+ * 生成的词法分析程序也直接匹配原始字节，不需要解码。
+ */
+class Utf8Compiler
+{
+private:
+    static Utf8Compiler instance; ///< 单例对象
+
+    /**
+     * @brief 拆分编码长度相同的一段码位
+     * @param from 起始码位
+     * @param to 终止码位（包含）
+     * @param sequences 拆分得到的字节范围序列会被加入此数组，每个字节范围用(起始字节, 终止字节)表示
+     */
+    void split(unsigned int from, unsigned int to, std::vector<std::vector<std::pair<int, int>>> &sequences);
+
+    /**
+     * @brief 将前缀树中的一个节点编译为抽象语法树
+     * @param suffixes 到达该节点之后剩余的字节范围序列，已排序且没有重复
+     * @param nodes 已经编译的节点，剩余部分相同的节点只编译一次
+     * @param arena 节点的分配器
+     * @return 匹配剩余部分的节点，剩余部分只有空序列时为空指针
+     */
+    RENode *compileSuffixes(const std::vector<std::vector<std::pair<int, int>>> &suffixes, std::map<std::vector<std::vector<std::pair<int, int>>>, RENode *> &nodes, RENodeArena &arena);
+
+public:
+    static Utf8Compiler &getInstance() { return instance; } ///< 获取单例对象
+
+    /**
+     * @brief 将码位集合拆分为字节范围序列
+     * @param codePoints 码位集合
+     * @return 字节范围序列，它们匹配的字节串恰好是集合中所有码位的UTF-8编码
+     */
+    std::vector<std::vector<std::pair<int, int>>> split(const CodePointSet &codePoints);
+
+    /**
+     * @brief 将码位集合和单独的字节编译为抽象语法树
+     * @param codePoints 码位集合
+     * @param bytes 额外匹配的单个字节，例如由'\xhh'得到的字节
+     * @param arena 节点的分配器
+     * @return 匹配集合中任意一个码位的UTF-8编码或者任意一个额外字节的节点
+     */
+    RENode *compile(const CodePointSet &codePoints, const std::bitset<256> &bytes, RENodeArena &arena);
+};
+
+CHLEX_NAMESPACE_END
@@ -0,0 +1,61 @@
+/**
+ * @file BacktrackAnalyzer.cc
+ * @brief BacktrackAnalyzer.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "BacktrackAnalyzer.hh"
+
+using namespace chlex;
+
+BacktrackAnalyzer BacktrackAnalyzer::instance;
+
+BacktrackInfo BacktrackAnalyzer::analyze(const DFA &dfa)
+{
+    auto &states = dfa.getStates();
+    auto &endStates = dfa.getEndStates();
+    int stateCount = states.size();
+
+    BacktrackInfo info;
+    info.finalAccepts.assign(stateCount, false);
+    info.mayBacktrack.assign(stateCount, false);
+
+    // 从终止状态出发，只经过非终止状态能到达的状态都可能需要回退
+    std::vector<int> stack;
+    for (auto &i : endStates)
+    {
+        for (auto &path : states.at(i.first)->paths)
+        {
+            auto to = path.second;
+            if (endStates.find(to) == endStates.end() && !info.mayBacktrack[to])
+            {
+                info.mayBacktrack[to] = true;
+                stack.push_back(to);
+            }
+        }
+    }
+    while (!stack.empty())
+    {
+        auto state = stack.back();
+        stack.pop_back();
+        info.backtrackStateCount++;
+        for (auto &path : states.at(state)->paths)
+        {
+            auto to = path.second;
+            if (endStates.find(to) == endStates.end() && !info.mayBacktrack[to])
+            {
+                info.mayBacktrack[to] = true;
+                stack.push_back(to);
+            }
+        }
+    }
+
+    // 剪枝后的DFA中每个状态都能到达终止状态，没有转移的终止状态之后不可能再有更长的匹配
+    for (auto &i : endStates)
+        info.finalAccepts[i.first] = states.at(i.first)->paths.empty();
+
+    return info;
+}
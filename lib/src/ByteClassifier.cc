@@ -0,0 +1,64 @@
+/**
+ * @file ByteClassifier.cc
+ * @brief ByteClassifier.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "ByteClassifier.hh"
+
+#include <map>
+
+using namespace chlex;
+
+ByteClassifier ByteClassifier::instance;
+
+ByteClasses ByteClassifier::classify(const DFA &dfa)
+{
+    // 初始时所有字节都在同一个等价类中
+    std::vector<int> classOf(256, 0);
+    int classCount = 1;
+
+    for (auto &i : dfa.getStates())
+    {
+        auto &paths = i.second->paths;
+        if (paths.empty())
+            continue;
+
+        // 按照(原等价类, 目标状态)重新划分
+        std::map<std::pair<int, int>, int> newClasses;
+        std::vector<int> newClassOf(256);
+        for (int byChar = 0; byChar < 256; byChar++)
+        {
+            auto it = paths.find(static_cast<char>(byChar));
+            auto to = it == paths.end() ? -1 : it->second;
+            auto result = newClasses.insert({{classOf[byChar], to}, static_cast<int>(newClasses.size())});
+            newClassOf[byChar] = result.first->second;
+        }
+
+        if (newClasses.size() != classCount)
+        {
+            classOf = std::move(newClassOf);
+            classCount = newClasses.size();
+        }
+    }
+
+    // 按照每个等价类中最小的字节重新编号，使字节0所在的等价类为0
+    ByteClasses result;
+    result.classOf.assign(256, -1);
+    std::vector<int> renumber(classCount, -1);
+    for (int byChar = 0; byChar < 256; byChar++)
+    {
+        auto &newClass = renumber[classOf[byChar]];
+        if (newClass == -1)
+        {
+            newClass = result.classCount++;
+            result.representatives.push_back(byChar);
+        }
+        result.classOf[byChar] = newClass;
+    }
+
+    return result;
+}
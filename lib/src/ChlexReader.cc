@@ -101,6 +101,30 @@ std::unique_ptr<RawChlex> ChlexReader::read(std::istream &in)
         regExp->pattern = line.substr(patternLeftIndex + 1, patternRightIndex - patternLeftIndex - 1);
         regExp->code = line.substr(codeLeftIndex + 1, codeRightIndex - codeLeftIndex - 1);
 
+        // 读取模式和代码之间的选项
+        std::string option;
+        auto options = line.substr(patternRightIndex + 1, codeLeftIndex - patternRightIndex - 1) + ' ';
+        for (auto c : options)
+        {
+            if (c != ' ' && c != '\t')
+            {
+                option.push_back(c);
+                continue;
+            }
+
+            if (option.empty())
+                continue;
+
+            if (option == "keyword")
+                regExp->keyword = true;
+            else if (option == "nocase")
+                regExp->caseless = true;
+            else
+                throw ChlexReaderException("Unknown option '" + option + "'", lineNum);
+
+            option.clear();
+        }
+
         rawChlex->regExps.push_back(std::move(regExp));
     }
 
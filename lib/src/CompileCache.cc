@@ -0,0 +1,157 @@
+/**
+ * @file CompileCache.cc
+ * @brief CompileCache.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "CompileCache.hh"
+
+#include "PerfectHash.hh"
+
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace chlex;
+
+/**
+ * @brief 在键的末尾追加一个带长度的字段
+ * @param key 键
+ * @param field 字段
+ */
+static void appendField(std::string &key, const std::string &field)
+{
+    key += std::to_string(field.size()) + ':' + field + ';';
+}
+
+CompileCache::CompileCache(const std::string &directory) : directory(directory)
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error)
+        throw CompileCacheException("Cannot create cache directory");
+}
+
+std::string CompileCache::makeKey(const RawChlex &raw, const CompileOptions &options)
+{
+    std::string key = "chlex-cache;";
+    appendField(key, std::to_string(LexerImageHeader::currentVersion));
+    appendField(key, std::string() + (options.optimizeRegExps ? 'r' : '-') + (options.optimizeNFA ? 'n' : '-') + (options.useDerivatives ? 'd' : '-') + (options.compressTable ? 'c' : '-'));
+
+    appendField(key, std::to_string(raw.getRegExps().size()));
+    for (auto &regExp : raw.getRegExps())
+    {
+        appendField(key, regExp->pattern);
+        appendField(key, std::string() + (regExp->keyword ? 'k' : '-') + (regExp->caseless ? 'i' : '-'));
+    }
+
+    return key;
+}
+
+bool CompileCache::readKey(const std::string &path, std::string &key)
+{
+    // 文件末尾依次是键和键的长度
+    std::ifstream in(path, std::ios::binary);
+    std::uint64_t length;
+    if (!in.seekg(-static_cast<std::streamoff>(sizeof(length)), std::ios::end) || !in.read(reinterpret_cast<char *>(&length), sizeof(length)))
+        return false;
+
+    auto keyEnd = static_cast<std::uint64_t>(in.tellg()) - sizeof(length);
+    if (length > keyEnd)
+        return false;
+
+    key.resize(length);
+    return in.seekg(keyEnd - length) && in.read(&key[0], length);
+}
+
+void CompileCache::store(const std::string &path, const std::string &image, const std::string &key)
+{
+    // 同一进程中的多个缓存对象可能同时写入同一个键，因此临时文件名除了进程号还带有进程内递增的序号
+    static std::atomic<unsigned long long> storeCount{0};
+    auto tempPath = path + ".tmp" + std::to_string(getpid()) + "-" + std::to_string(storeCount++);
+    {
+        std::ofstream out(tempPath, std::ios::binary);
+        std::uint64_t length = key.size();
+        out.write(image.data(), image.size());
+        out.write(key.data(), key.size());
+        out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        if (!out)
+        {
+            out.close();
+            std::remove(tempPath.c_str());
+            throw CompileCacheException("Cannot write cache file");
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        throw CompileCacheException("Cannot write cache file");
+    }
+}
+
+std::unique_ptr<MappedLexer> CompileCache::load(std::shared_ptr<RawChlex> raw, const CompileOptions &options)
+{
+    auto key = makeKey(*raw, options);
+    auto hash = PerfectHash::hash(key);
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.chleximg", static_cast<unsigned long long>(hash));
+    auto path = (std::filesystem::path(directory) / name).string();
+
+    std::string storedKey;
+    if (readKey(path, storedKey) && storedKey == key)
+    {
+        try
+        {
+            // 缓存文件可能在写入之后被损坏，使用之前检查一次映像的内容
+            auto lexer = std::make_unique<MappedLexer>(path);
+            lexer->validate();
+
+            bool same = lexer->getRuleCount() == raw->getRegExps().size() && lexer->getTokenCount() == raw->getTokens().size();
+            for (int i = 0; same && i < raw->getRegExps().size(); i++)
+                same = lexer->getRuleCode(i) == raw->getRegExps()[i]->code;
+            for (int i = 0; same && i < raw->getTokens().size(); i++)
+                same = lexer->getTokenName(i) == raw->getTokens()[i];
+
+            if (same)
+            {
+                lastStatus = CacheStatus::HIT;
+                return lexer;
+            }
+
+            // 自动机没有变化，只替换代码和Token
+            auto content = lexer->toContent();
+            lexer.reset();
+            content.ruleCodes.clear();
+            for (auto &regExp : raw->getRegExps())
+                content.ruleCodes.push_back(regExp->code);
+            content.tokens = raw->getTokens();
+
+            store(path, LexerImageWriter::getInstance().write(content), key);
+            lastStatus = CacheStatus::REFRESHED;
+            return std::make_unique<MappedLexer>(path);
+        }
+        catch (const LexerImageException &)
+        {
+            // 缓存文件已经损坏，按照没有缓存处理
+        }
+    }
+
+    compiler.setOptions(options);
+    store(path, LexerImageWriter::getInstance().write(compiler.collect(raw)), key);
+    lastStatus = CacheStatus::MISS;
+    return std::make_unique<MappedLexer>(path);
+}
+
+std::unique_ptr<MappedLexer> CompileCache::load(const std::string &filename, const CompileOptions &options)
+{
+    std::shared_ptr<RawChlex> raw = compiler.read(filename);
+    return load(raw, options);
+}
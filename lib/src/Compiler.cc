@@ -0,0 +1,81 @@
+/**
+ * @file Compiler.cc
+ * @brief Compiler.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "Compiler.hh"
+
+#include "ChlexReader.hh"
+#include "DerivativeDFAFactory.hh"
+#include "LexerFactory.hh"
+#include "NFAFactory.hh"
+#include "NFAOptimizer.hh"
+#include "RegExpOptimizer.hh"
+
+using namespace chlex;
+
+void Compiler::release(ParsedChlex &parsedChlex)
+{
+    for (auto &parsedRegExp : parsedChlex.regExps)
+        parsedRegExp->ast = nullptr;
+    parsedChlex.arena = RENodeArena();
+    parsedChlex.bases.clear();
+}
+
+std::unique_ptr<RawChlex> Compiler::read(const std::string &filename)
+{
+    return ChlexReader::getInstance().read(filename);
+}
+
+std::unique_ptr<MinimizedDFAChlex> Compiler::compile(std::shared_ptr<RawChlex> raw, bool releaseIntermediates)
+{
+    std::shared_ptr<ParsedChlex> parsedChlex = RegExpParser::getInstance().parse(raw, options.threadCount, parserScratches);
+    if (options.optimizeRegExps)
+        parsedChlex = RegExpOptimizer::getInstance().optimize(parsedChlex);
+
+    std::shared_ptr<DFAChlex> dfaChlex;
+    if (options.useDerivatives)
+    {
+        dfaChlex = DerivativeDFAFactory::getInstance().generate(parsedChlex);
+        if (releaseIntermediates)
+            release(*parsedChlex);
+    }
+    else
+    {
+        std::shared_ptr<NFAChlex> nfaChlex = NFAFactory::getInstance().generate(parsedChlex, options.threadCount);
+        if (releaseIntermediates)
+            release(*parsedChlex);
+        if (options.optimizeNFA)
+            nfaChlex = NFAOptimizer::getInstance().optimize(nfaChlex);
+        dfaChlex = DFAFactory::getInstance().generate(nfaChlex, options.threadCount, subsetScratch);
+        if (releaseIntermediates)
+            nfaChlex->nfa.reset();
+    }
+
+    auto minimized = DFAMinimizer::getInstance().minimize(dfaChlex, options.threadCount, minimizerScratch);
+    if (releaseIntermediates)
+        dfaChlex->dfa.reset();
+    return minimized;
+}
+
+LexerImageContent Compiler::collect(std::shared_ptr<RawChlex> raw)
+{
+    auto content = LexerImageWriter::getInstance().collect(*compile(raw, true));
+    if (options.compressTable)
+        LexerImageWriter::getInstance().compress(content);
+    return content;
+}
+
+std::unique_ptr<MappedLexer> Compiler::build(std::shared_ptr<RawChlex> raw)
+{
+    return std::make_unique<MappedLexer>(collect(raw));
+}
+
+std::unique_ptr<ChlexLexer> Compiler::generate(std::shared_ptr<RawChlex> raw)
+{
+    return LexerFactory::getInstance().generate(compile(raw));
+}
@@ -0,0 +1,208 @@
+/**
+ * @file D2FA.cc
+ * @brief D2FA.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "D2FA.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+using namespace chlex;
+
+D2FAFactory D2FAFactory::instance;
+
+D2FA D2FAFactory::generate(int stateCount, int classCount, const std::vector<std::int32_t> &transitions, int maxDepth)
+{
+    auto row = [&](int state) { return transitions.data() + static_cast<std::size_t>(state) * classCount; };
+    auto similarity = [&](int a, int b) {
+        auto rowA = row(a);
+        auto rowB = row(b);
+        int result = 0;
+        for (int c = 0; c < classCount; c++)
+            result += rowA[c] != -1 && rowA[c] == rowB[c];
+        return result;
+    };
+
+    // 候选的状态对及其相似度
+    std::vector<std::tuple<int, int, int>> edges;
+    auto addEdge = [&](int a, int b) {
+        auto weight = similarity(a, b);
+        if (weight > 0)
+            edges.emplace_back(weight, std::min(a, b), std::max(a, b));
+    };
+
+    if (maxDepth > 0 && static_cast<long long>(stateCount) * stateCount <= 65536)
+    {
+        for (int a = 0; a < stateCount; a++)
+            for (int b = a + 1; b < stateCount; b++)
+                addEdge(a, b);
+    }
+    else if (maxDepth > 0)
+    {
+        // 每组等价类上转移相同的状态分到同一个桶中，只比较桶中相邻的状态
+        const int bandCount = 16;
+        const int bandSize = std::min(classCount, 4);
+        const int window = 4;
+        std::uint64_t random = 0x9E3779B97F4A7C15ULL;
+        for (int band = 0; band < bandCount; band++)
+        {
+            std::vector<int> classes;
+            for (int i = 0; i < bandSize; i++)
+            {
+                random = random * 6364136223846793005ULL + 1442695040888963407ULL;
+                classes.push_back(static_cast<int>((random >> 33) % classCount));
+            }
+
+            std::unordered_map<std::uint64_t, std::vector<int>> buckets;
+            for (int state = 0; state < stateCount; state++)
+            {
+                std::uint64_t key = 14695981039346656037ULL;
+                for (auto c : classes)
+                    key = (key ^ static_cast<std::uint32_t>(row(state)[c])) * 1099511628211ULL;
+                buckets[key].push_back(state);
+            }
+
+            for (auto &bucket : buckets)
+            {
+                auto &states = bucket.second;
+                for (int i = 0; i < states.size(); i++)
+                    for (int j = i + 1; j < states.size() && j <= i + window; j++)
+                        addEdge(states[i], states[j]);
+            }
+        }
+
+        // 入度最大的几个状态（如标识符的循环）往往与大量状态相似，每个状态都与它们比较
+        const int hubCount = 16;
+        std::vector<int> inDegree(stateCount, 0);
+        for (auto to : transitions)
+        {
+            if (to != -1)
+                inDegree[to]++;
+        }
+        std::vector<int> hubs(stateCount);
+        std::iota(hubs.begin(), hubs.end(), 0);
+        auto hubEnd = hubs.begin() + std::min(stateCount, hubCount);
+        std::partial_sort(hubs.begin(), hubEnd, hubs.end(), [&](int a, int b) { return inDegree[a] > inDegree[b] || (inDegree[a] == inDegree[b] && a < b); });
+        for (auto hub = hubs.begin(); hub != hubEnd; hub++)
+        {
+            for (int state = 0; state < stateCount; state++)
+            {
+                if (state != *hub)
+                    addEdge(state, *hub);
+            }
+        }
+
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    }
+
+    // 按照相似度从大到小生成最大生成森林
+    std::sort(edges.begin(), edges.end(), [](const std::tuple<int, int, int> &a, const std::tuple<int, int, int> &b) {
+        if (std::get<0>(a) != std::get<0>(b))
+            return std::get<0>(a) > std::get<0>(b);
+        return std::make_pair(std::get<1>(a), std::get<2>(a)) < std::make_pair(std::get<1>(b), std::get<2>(b));
+    });
+
+    std::vector<int> parent(stateCount);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int state) {
+        while (parent[state] != state)
+        {
+            parent[state] = parent[parent[state]];
+            state = parent[state];
+        }
+        return state;
+    };
+
+    std::vector<std::vector<int>> tree(stateCount);
+    for (auto &edge : edges)
+    {
+        auto a = std::get<1>(edge);
+        auto b = std::get<2>(edge);
+        auto rootA = find(a);
+        auto rootB = find(b);
+        if (rootA == rootB)
+            continue;
+        parent[rootA] = rootB;
+        tree[a].push_back(b);
+        tree[b].push_back(a);
+    }
+
+    // 从每棵树中度数最大的状态开始广度优先地确定默认状态，限制默认状态链的长度
+    std::vector<int> order(stateCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return tree[a].size() > tree[b].size(); });
+
+    std::vector<std::int32_t> defaults(stateCount, -1);
+    std::vector<int> depth(stateCount, -1);
+    for (auto root : order)
+    {
+        if (depth[root] != -1)
+            continue;
+
+        depth[root] = 0;
+        std::vector<int> queue{root};
+        for (int i = 0; i < queue.size(); i++)
+        {
+            auto state = queue[i];
+            for (auto child : tree[state])
+            {
+                if (depth[child] != -1)
+                    continue;
+
+                if (depth[state] < maxDepth)
+                {
+                    defaults[child] = state;
+                    depth[child] = depth[state] + 1;
+                }
+                else
+                    depth[child] = 0;
+                queue.push_back(child);
+            }
+        }
+    }
+
+    D2FA result;
+    result.rowStarts.push_back(0);
+    for (int state = 0; state < stateCount; state++)
+    {
+        auto stateRow = row(state);
+        auto defaultState = defaults[state];
+
+        // 使用默认状态需要保存的转移不比不使用时少，就不使用默认状态
+        if (defaultState != -1)
+        {
+            auto defaultRow = row(defaultState);
+            int present = 0;
+            int differences = 0;
+            for (int c = 0; c < classCount; c++)
+            {
+                present += stateRow[c] != -1;
+                differences += stateRow[c] != defaultRow[c];
+            }
+            if (differences >= present)
+                defaultState = -1;
+        }
+
+        result.defaults.push_back(defaultState);
+        for (int c = 0; c < classCount; c++)
+        {
+            auto inherited = defaultState == -1 ? -1 : row(defaultState)[c];
+            if (stateRow[c] != inherited)
+            {
+                result.labels.push_back(c);
+                result.targets.push_back(stateRow[c]);
+            }
+        }
+        result.rowStarts.push_back(result.labels.size());
+    }
+
+    return result;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file DFA.cc
+ * @brief DFA.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "DFA.hh"
+
+using namespace chlex;
+
+std::vector<DFARange> DFAState::getRanges() const
+{
+    // paths按照有符号的char排序，先取0到127，再取128到255
+    std::vector<DFARange> ranges;
+    auto append = [&](const std::pair<const char, int> &path) {
+        auto byte = static_cast<unsigned char>(path.first);
+        if (!ranges.empty() && ranges.back().hi + 1 == byte && ranges.back().to == path.second)
+            ranges.back().hi = byte;
+        else
+            ranges.push_back({byte, byte, path.second});
+    };
+
+    auto middle = paths.lower_bound(0);
+    for (auto it = middle; it != paths.end(); it++)
+        append(*it);
+    for (auto it = paths.begin(); it != middle; it++)
+        append(*it);
+    return ranges;
+}
@@ -0,0 +1,285 @@
+/**
+ * @file DFACombiner.cc
+ * @brief DFACombiner.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "DFACombiner.hh"
+
+#include "ByteClassifier.hh"
+#include "DFAMinimizer.hh"
+
+#include <algorithm>
+#include <map>
+#include <queue>
+
+using namespace chlex;
+
+DFACombiner DFACombiner::instance;
+
+std::unique_ptr<DFA> DFACombiner::buildProduct(const DFA &a, const DFA &b, DFAOperation operation, int ruleOffset)
+{
+    // 两个DFA的字节等价类的交，每个交只需要用其中一个字节计算转移
+    auto classesA = ByteClassifier::getInstance().classify(a);
+    auto classesB = ByteClassifier::getInstance().classify(b);
+    std::map<std::pair<int, int>, int> jointClasses;
+    std::vector<int> classOf(256);
+    std::vector<char> representatives;
+    for (int byChar = 1; byChar < 256; byChar++)
+    {
+        auto result = jointClasses.insert({{classesA.classOf[byChar], classesB.classOf[byChar]}, static_cast<int>(representatives.size())});
+        if (result.second)
+            representatives.push_back(static_cast<char>(byChar));
+        classOf[byChar] = result.first->second;
+    }
+
+    auto endStateOf = [](const DFA &dfa, int state) -> const DFAEndState * {
+        if (state == -1)
+            return nullptr;
+        auto it = dfa.getEndStates().find(state);
+        return it == dfa.getEndStates().end() ? nullptr : &it->second.get();
+    };
+
+    // 乘积状态中-1表示该DFA已经进入死状态
+    std::vector<std::pair<int, int>> states;
+    std::map<std::pair<int, int>, int> stateIds;
+    std::vector<std::vector<int>> transitions;
+    auto getOrCreate = [&](int stateA, int stateB) {
+        bool alive = operation == DFAOperation::UNION ? stateA != -1 || stateB != -1 : operation == DFAOperation::INTERSECTION ? stateA != -1 && stateB != -1 : stateA != -1;
+        if (!alive)
+            return -1;
+
+        auto result = stateIds.insert({{stateA, stateB}, static_cast<int>(states.size())});
+        if (result.second)
+        {
+            states.push_back({stateA, stateB});
+            transitions.emplace_back(representatives.size(), -1);
+        }
+        return result.first->second;
+    };
+
+    auto next = [](const DFA &dfa, int state, char byChar) {
+        if (state == -1)
+            return -1;
+        auto &paths = dfa.getStates().at(state)->paths;
+        auto it = paths.find(byChar);
+        return it == paths.end() ? -1 : it->second;
+    };
+
+    getOrCreate(a.getStartState().id, b.getStartState().id);
+    for (int i = 0; i < states.size(); i++)
+    {
+        for (int c = 0; c < representatives.size(); c++)
+        {
+            auto stateA = next(a, states[i].first, representatives[c]);
+            auto stateB = next(b, states[i].second, representatives[c]);
+            auto to = getOrCreate(stateA, stateB);
+            transitions[i][c] = to;
+        }
+    }
+
+    // 计算每个乘积状态接受的正则表达式
+    std::vector<const DFAEndState *> accepts(states.size(), nullptr);
+    std::vector<int> rules(states.size(), -1);
+    for (int i = 0; i < states.size(); i++)
+    {
+        auto endA = endStateOf(a, states[i].first);
+        auto endB = endStateOf(b, states[i].second);
+        switch (operation)
+        {
+        case DFAOperation::UNION:
+            if (endA != nullptr)
+            {
+                accepts[i] = endA;
+                rules[i] = endA->rule;
+            }
+            else if (endB != nullptr)
+            {
+                accepts[i] = endB;
+                rules[i] = endB->rule + ruleOffset;
+            }
+            break;
+        case DFAOperation::INTERSECTION:
+            if (endA != nullptr && endB != nullptr)
+            {
+                accepts[i] = endA;
+                rules[i] = endA->rule;
+            }
+            break;
+        case DFAOperation::DIFFERENCE:
+            if (endA != nullptr && endB == nullptr)
+            {
+                accepts[i] = endA;
+                rules[i] = endA->rule;
+            }
+            break;
+        }
+    }
+
+    // 只保留能到达终止状态的状态，起始状态总是保留
+    std::vector<std::vector<int>> predecessors(states.size());
+    for (int i = 0; i < states.size(); i++)
+    {
+        for (auto to : transitions[i])
+        {
+            if (to != -1)
+                predecessors[to].push_back(i);
+        }
+    }
+
+    std::vector<bool> useful(states.size(), false);
+    std::queue<int> usefulQueue;
+    for (int i = 0; i < states.size(); i++)
+    {
+        if (accepts[i] != nullptr)
+        {
+            useful[i] = true;
+            usefulQueue.push(i);
+        }
+    }
+    while (!usefulQueue.empty())
+    {
+        auto i = usefulQueue.front();
+        usefulQueue.pop();
+        for (auto predecessor : predecessors[i])
+        {
+            if (!useful[predecessor])
+            {
+                useful[predecessor] = true;
+                usefulQueue.push(predecessor);
+            }
+        }
+    }
+    useful[0] = true;
+
+    std::vector<int> newIds(states.size(), -1);
+    int stateCount = 0;
+    for (int i = 0; i < states.size(); i++)
+    {
+        if (useful[i])
+            newIds[i] = stateCount++;
+    }
+
+    std::vector<std::unique_ptr<DFAState>> dfaStates;
+    for (int i = 0; i < states.size(); i++)
+    {
+        if (!useful[i])
+            continue;
+
+        std::unique_ptr<DFAState> dfaState;
+        if (accepts[i] != nullptr)
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = rules[i];
+            dfaState = std::move(endState);
+        }
+        else
+            dfaState = std::make_unique<DFAState>();
+
+        dfaState->id = newIds[i];
+        for (int byChar = 1; byChar < 256; byChar++)
+        {
+            auto to = transitions[i][classOf[byChar]];
+            if (to != -1 && useful[to])
+                dfaState->paths[static_cast<char>(byChar)] = newIds[to];
+        }
+        dfaStates.push_back(std::move(dfaState));
+    }
+
+    auto product = std::make_unique<DFA>(*dfaStates[0]);
+    for (int i = 0; i < states.size(); i++)
+    {
+        if (!useful[i])
+            continue;
+        auto &dfaState = dfaStates[newIds[i]];
+        if (accepts[i] != nullptr)
+            product->getEndStates().insert({newIds[i], static_cast<DFAEndState &>(*dfaState)});
+        product->getStates().insert({newIds[i], std::move(dfaState)});
+    }
+
+    return product;
+}
+
+std::unique_ptr<DFA> DFACombiner::combine(const DFA &a, const DFA &b, DFAOperation operation, int ruleOffset, int threadCount)
+{
+    auto product = buildProduct(a, b, operation, ruleOffset);
+    return DFAMinimizer::getInstance().minimize(*product, threadCount);
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFACombiner::unite(std::shared_ptr<MinimizedDFAChlex> a, std::shared_ptr<MinimizedDFAChlex> b, int threadCount)
+{
+    auto &nfaChlexA = *a->dfaChlex->nfaChlex;
+    auto &nfaChlexB = *b->dfaChlex->nfaChlex;
+    auto &parsedA = nfaChlexA.parsedChlex;
+    auto &parsedB = nfaChlexB.parsedChlex;
+    int ruleOffset = parsedA->regExps.size();
+
+    auto rawChlex = std::make_shared<RawChlex>();
+    rawChlex->tokens = parsedA->rawChlex->tokens;
+    for (auto &token : parsedB->rawChlex->tokens)
+    {
+        if (std::find(rawChlex->tokens.begin(), rawChlex->tokens.end(), token) == rawChlex->tokens.end())
+            rawChlex->tokens.push_back(token);
+    }
+    rawChlex->regExps = parsedA->rawChlex->regExps;
+    rawChlex->regExps.insert(rawChlex->regExps.end(), parsedB->rawChlex->regExps.begin(), parsedB->rawChlex->regExps.end());
+
+    // 语法树节点仍由原来的两个Chlex持有
+    auto parsedChlex = std::make_shared<ParsedChlex>();
+    parsedChlex->rawChlex = rawChlex;
+    parsedChlex->bases = {parsedA, parsedB};
+    for (auto parsed : {parsedA.get(), parsedB.get()})
+    {
+        for (auto &parsedRegExp : parsed->regExps)
+            parsedChlex->regExps.push_back(std::make_unique<ParsedRegExp>(parsedRegExp->regExp, parsedRegExp->ast));
+    }
+
+    auto nfaChlex = std::make_shared<NFAChlex>();
+    nfaChlex->parsedChlex = parsedChlex;
+
+    auto dfaChlex = std::make_shared<DFAChlex>();
+    dfaChlex->nfaChlex = nfaChlex;
+    dfaChlex->dfa = buildProduct(a->getMinimizedDFA(), b->getMinimizedDFA(), DFAOperation::UNION, ruleOffset);
+
+    std::vector<KeywordInfo> keywords = nfaChlexA.keywords;
+    for (auto keyword : nfaChlexB.keywords)
+    {
+        keyword.rule += ruleOffset;
+        keywords.push_back(keyword);
+    }
+    nfaChlex->keywords = rehostKeywords(*dfaChlex->dfa, keywords);
+
+    return DFAMinimizer::getInstance().minimize(dfaChlex, threadCount);
+}
+
+std::vector<KeywordInfo> DFACombiner::rehostKeywords(const DFA &dfa, const std::vector<KeywordInfo> &keywords)
+{
+    std::vector<KeywordInfo> result;
+    for (auto keyword : keywords)
+    {
+        const DFAState *state = &dfa.getStartState();
+        for (auto byChar : keyword.lexeme)
+        {
+            auto it = state->paths.find(byChar);
+            if (it == state->paths.end())
+            {
+                state = nullptr;
+                break;
+            }
+            state = dfa.getStates().at(it->second).get();
+        }
+        if (state == nullptr)
+            continue;
+
+        auto it = dfa.getEndStates().find(state->id);
+        if (it != dfa.getEndStates().end() && it->second.get().rule > keyword.rule)
+        {
+            keyword.hostRule = it->second.get().rule;
+            result.push_back(keyword);
+        }
+    }
+    return result;
+}
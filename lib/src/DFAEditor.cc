@@ -0,0 +1,649 @@
+/**
+ * @file DFAEditor.cc
+ * @brief DFAEditor.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "DFAEditor.hh"
+
+#include "DFACombiner.hh"
+#include "NFAFactory.hh"
+#include "RegExpParser.hh"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+using namespace chlex;
+
+DFAEditor DFAEditor::instance;
+
+/**
+ * @brief 在按照字符排序的转移中查找某个字符上的转移
+ * @param paths 按照字符排序的转移
+ * @param byChar 字符
+ * @return 到达的状态，没有转移则为-1
+ */
+static int findPath(const std::vector<std::pair<char, int>> &paths, char byChar)
+{
+    auto it = std::lower_bound(paths.begin(), paths.end(), byChar, [](const std::pair<char, int> &path, char byChar) { return path.first < byChar; });
+    return it != paths.end() && it->first == byChar ? it->second : -1;
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAEditor::apply(const MinimizedDFAChlex &chlex, Edit &edit, std::shared_ptr<ParsedChlex> parsedChlex, std::vector<KeywordInfo> keywords)
+{
+    auto &dfa = chlex.getMinimizedDFA();
+    auto &pool = edit.pool;
+    auto empty = pool.makeEmpty();
+
+    // 原DFA的状态按照id的顺序重新编号为0到n-1
+    std::vector<int> indexOf(dfa.getStates().rbegin()->first + 1, -1);
+    int n = 0;
+    for (auto &i : dfa.getStates())
+        indexOf[i.first] = n++;
+
+    std::vector<std::vector<std::pair<char, int>>> oldPaths(n);
+    std::vector<int> oldRules(n, -1);
+    std::vector<int> oldAccepts(n, -1);
+    for (auto &i : dfa.getStates())
+    {
+        auto &statePaths = oldPaths[indexOf[i.first]];
+        statePaths.reserve(i.second->paths.size());
+        for (auto &path : i.second->paths)
+            statePaths.push_back({path.first, indexOf[path.second]});
+    }
+    for (auto &i : dfa.getEndStates())
+    {
+        auto index = indexOf[i.first];
+        oldRules[index] = i.second.get().rule;
+        oldAccepts[index] = edit.ruleMap[oldRules[index]];
+    }
+
+    // 乘积状态的编号从n开始，-1表示死状态
+    struct ProductState
+    {
+        int origin;                              ///< 对应的原DFA中的状态，-1表示死状态
+        std::vector<int> derivs;                 ///< 跟踪的导数，第一个不是空语言
+        int rule;                                ///< 接受的正则表达式的新序号
+        std::vector<std::pair<char, int>> paths; ///< 所有转移
+    };
+
+    std::vector<ProductState> products;
+    std::map<std::pair<int, std::vector<int>>, int> productIds;
+    auto getOrCreate = [&](int origin, std::vector<int> derivs) {
+        auto result = productIds.insert({{origin, derivs}, n + static_cast<int>(products.size())});
+        if (result.second)
+        {
+            auto rule = edit.accept(origin == -1 ? -1 : oldRules[origin], derivs);
+            products.push_back(ProductState{origin, std::move(derivs), rule, {}});
+        }
+        return result.first->second;
+    };
+
+    auto start = indexOf[dfa.getStartState().id];
+    if (edit.roots[0] != empty)
+        start = getOrCreate(start, edit.roots);
+    for (int i = 0; i < products.size(); i++)
+    {
+        for (int byte = 1; byte < 256; byte++)
+        {
+            auto byChar = static_cast<char>(byte);
+            auto origin = products[i].origin == -1 ? -1 : findPath(oldPaths[products[i].origin], byChar);
+
+            // 被修改的正则表达式已经不可能匹配时，之后与原DFA完全相同，其余的导数也不需要再计算
+            auto to = origin;
+            auto first = pool.derive(products[i].derivs[0], byChar);
+            if (first != empty)
+            {
+                std::vector<int> derivs{first};
+                for (int j = 1; j < products[i].derivs.size(); j++)
+                    derivs.push_back(pool.derive(products[i].derivs[j], byChar));
+                to = getOrCreate(origin, std::move(derivs));
+            }
+
+            if (to != -1)
+                products[i].paths.push_back({byChar, to});
+        }
+    }
+    int m = products.size();
+
+    // 只有能到达接受的正则表达式发生变化的状态的乘积状态才受影响，其余的与原来的状态等价
+    std::vector<std::vector<int>> predecessors(m);
+    std::vector<bool> affected(m, false);
+    std::queue<int> affectedQueue;
+    for (int i = 0; i < m; i++)
+    {
+        for (auto &path : products[i].paths)
+        {
+            if (path.second >= n)
+                predecessors[path.second - n].push_back(i);
+        }
+
+        auto origin = products[i].origin;
+        bool removed = origin != -1 && oldRules[origin] != -1 && oldAccepts[origin] == -1;
+        if (removed || products[i].rule != (origin == -1 ? -1 : oldAccepts[origin]))
+        {
+            affected[i] = true;
+            affectedQueue.push(i);
+        }
+    }
+    while (!affectedQueue.empty())
+    {
+        auto i = affectedQueue.front();
+        affectedQueue.pop();
+        for (auto predecessor : predecessors[i])
+        {
+            if (!affected[predecessor])
+            {
+                affected[predecessor] = true;
+                affectedQueue.push(predecessor);
+            }
+        }
+    }
+
+    auto resolve = [&](int node) {
+        if (node < n || affected[node - n])
+            return node;
+        return products[node - n].origin;
+    };
+
+    // 受影响状态的转移，与原DFA中的转移一样按照字符排序
+    std::vector<std::vector<std::pair<char, int>>> paths(m);
+    for (int i = 0; i < m; i++)
+    {
+        if (!affected[i])
+            continue;
+        for (auto &path : products[i].paths)
+        {
+            auto to = resolve(path.second);
+            if (to != -1)
+                paths[i].push_back({path.first, to});
+        }
+        std::sort(paths[i].begin(), paths[i].end());
+    }
+
+    // 删除正则表达式后，部分受影响状态可能不再能到达终止状态，删除这些死状态及到它们的转移。
+    // 原DFA中没有死状态，因此能转移到原DFA的状态的受影响状态都不是死状态。起始状态总是保留
+    {
+        std::vector<std::vector<int>> affectedPredecessors(m);
+        std::vector<bool> live(m, false);
+        std::queue<int> liveQueue;
+        for (int i = 0; i < m; i++)
+        {
+            if (!affected[i])
+                continue;
+
+            bool isLive = products[i].rule != -1;
+            for (auto &path : paths[i])
+            {
+                if (path.second < n)
+                    isLive = true;
+                else
+                    affectedPredecessors[path.second - n].push_back(i);
+            }
+            if (isLive)
+            {
+                live[i] = true;
+                liveQueue.push(i);
+            }
+        }
+        while (!liveQueue.empty())
+        {
+            auto i = liveQueue.front();
+            liveQueue.pop();
+            for (auto predecessor : affectedPredecessors[i])
+            {
+                if (!live[predecessor])
+                {
+                    live[predecessor] = true;
+                    liveQueue.push(predecessor);
+                }
+            }
+        }
+
+        for (int i = 0; i < m; i++)
+        {
+            if (!affected[i])
+                continue;
+            auto end = std::remove_if(paths[i].begin(), paths[i].end(), [&](const std::pair<char, int> &path) { return path.second >= n && !live[path.second - n]; });
+            paths[i].erase(end, paths[i].end());
+            if (!live[i] && i + n != start)
+                affected[i] = false;
+        }
+    }
+
+    // 原DFA中每个状态的前驱，按照字符和前驱排序
+    std::vector<int> predecessorStart(n + 1, 0);
+    for (auto &statePaths : oldPaths)
+    {
+        for (auto &path : statePaths)
+            predecessorStart[path.second + 1]++;
+    }
+    for (int i = 0; i < n; i++)
+        predecessorStart[i + 1] += predecessorStart[i];
+
+    // 先按照字符分桶，再按顺序放入各个状态的前驱中，就不需要再排序
+    std::vector<std::pair<char, int>> oldPredecessors(predecessorStart[n]);
+    {
+        std::vector<std::vector<std::pair<int, int>>> byChar(256);
+        for (int i = 0; i < n; i++)
+        {
+            for (auto &path : oldPaths[i])
+                byChar[static_cast<unsigned char>(path.first) ^ 0x80].push_back({i, path.second});
+        }
+
+        auto next = predecessorStart;
+        for (int c = 0; c < 256; c++)
+        {
+            for (auto &path : byChar[c])
+                oldPredecessors[next[path.second]++] = {static_cast<char>(c ^ 0x80), path.first};
+        }
+    }
+
+    // 能到达接受被删除的正则表达式的状态的原状态的行为已经改变，不能与受影响状态合并
+    std::vector<bool> stale(n, false);
+    std::queue<int> staleQueue;
+    for (int i = 0; i < n; i++)
+    {
+        if (oldRules[i] != -1 && oldAccepts[i] == -1)
+        {
+            stale[i] = true;
+            staleQueue.push(i);
+        }
+    }
+    while (!staleQueue.empty())
+    {
+        auto i = staleQueue.front();
+        staleQueue.pop();
+        for (int j = predecessorStart[i]; j < predecessorStart[i + 1]; j++)
+        {
+            auto predecessor = oldPredecessors[j].second;
+            if (!stale[predecessor])
+            {
+                stale[predecessor] = true;
+                staleQueue.push(predecessor);
+            }
+        }
+    }
+
+    // 找出与原DFA中的状态等价的受影响状态。先按照接受的正则表达式、有转移的字符和到原DFA的转移筛选候选，
+    // 再不断删除转移到的状态不再等价的候选，直到不再变化
+    std::vector<std::vector<int>> candidates(m);
+    {
+        auto shapeOf = [](int rule, const std::vector<std::pair<char, int>> &targets) {
+            std::vector<int> shape{rule};
+            for (auto &path : targets)
+                shape.push_back(path.first);
+            return shape;
+        };
+
+        // 所有转移都到达受影响状态时才需要按照形状查找候选，此时才建立形状表
+        std::map<std::vector<int>, std::vector<int>> shapes;
+        bool shapesBuilt = false;
+
+        auto consider = [&](int i, int candidate) {
+            if (stale[candidate] || oldAccepts[candidate] != products[i].rule || oldPaths[candidate].size() != paths[i].size())
+                return;
+            for (int j = 0; j < paths[i].size(); j++)
+            {
+                auto &path = paths[i][j];
+                auto &oldPath = oldPaths[candidate][j];
+                if (oldPath.first != path.first || (path.second < n && oldPath.second != path.second))
+                    return;
+            }
+            candidates[i].push_back(candidate);
+        };
+
+        for (int i = 0; i < m; i++)
+        {
+            if (!affected[i])
+                continue;
+
+            // 有到原DFA的转移时，候选只能是同一字符上转移到同一状态的状态
+            auto oldPath = std::find_if(paths[i].begin(), paths[i].end(), [&](const std::pair<char, int> &path) { return path.second < n; });
+            if (oldPath != paths[i].end())
+            {
+                auto begin = oldPredecessors.begin() + predecessorStart[oldPath->second];
+                auto end = oldPredecessors.begin() + predecessorStart[oldPath->second + 1];
+                auto range = std::equal_range(begin, end, std::make_pair(oldPath->first, 0), [](const std::pair<char, int> &a, const std::pair<char, int> &b) { return a.first < b.first; });
+                for (auto it = range.first; it != range.second; it++)
+                    consider(i, it->second);
+                continue;
+            }
+
+            if (!shapesBuilt)
+            {
+                for (int j = 0; j < n; j++)
+                {
+                    if (!stale[j])
+                        shapes[shapeOf(oldAccepts[j], oldPaths[j])].push_back(j);
+                }
+                shapesBuilt = true;
+            }
+            auto it = shapes.find(shapeOf(products[i].rule, paths[i]));
+            if (it != shapes.end())
+            {
+                for (auto candidate : it->second)
+                    consider(i, candidate);
+            }
+        }
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int i = 0; i < m; i++)
+        {
+            auto &current = candidates[i];
+            auto end = std::remove_if(current.begin(), current.end(), [&](int candidate) {
+                for (int j = 0; j < paths[i].size(); j++)
+                {
+                    auto to = paths[i][j].second;
+                    if (to < n)
+                        continue;
+                    auto &next = candidates[to - n];
+                    if (!std::binary_search(next.begin(), next.end(), oldPaths[candidate][j].second))
+                        return true;
+                }
+                return false;
+            });
+            if (end != current.end())
+            {
+                current.erase(end, current.end());
+                changed = true;
+            }
+        }
+    }
+
+    // 剩下的受影响状态不与原DFA中的任何状态等价，在它们之中按轮次划分
+    std::vector<int> groupOf(m, -1);
+    int groupCount = 0;
+    {
+        std::map<int, int> initialGroups;
+        for (int i = 0; i < m; i++)
+        {
+            if (affected[i] && candidates[i].empty())
+                groupOf[i] = initialGroups.insert({products[i].rule, initialGroups.size()}).first->second;
+        }
+        groupCount = initialGroups.size();
+    }
+
+    // 原DFA中的状态为0到n-1，受影响区域中的组为n以后
+    auto finalOf = [&](int node) {
+        if (node < n)
+            return node;
+        if (!candidates[node - n].empty())
+            return candidates[node - n].front();
+        return n + groupOf[node - n];
+    };
+
+    while (true)
+    {
+        std::map<std::vector<int>, int> signatures;
+        std::vector<int> newGroupOf(m, -1);
+        for (int i = 0; i < m; i++)
+        {
+            if (groupOf[i] == -1)
+                continue;
+
+            std::vector<int> signature{groupOf[i]};
+            for (auto &path : paths[i])
+            {
+                signature.push_back(path.first);
+                signature.push_back(finalOf(path.second));
+            }
+            newGroupOf[i] = signatures.insert({std::move(signature), signatures.size()}).first->second;
+        }
+
+        groupOf = std::move(newGroupOf);
+        if (signatures.size() == groupCount)
+            break;
+        groupCount = signatures.size();
+    }
+
+    std::vector<int> representatives(groupCount, -1);
+    for (int i = 0; i < m; i++)
+    {
+        if (groupOf[i] != -1 && representatives[groupOf[i]] == -1)
+            representatives[groupOf[i]] = i;
+    }
+
+    // 按照广度优先的顺序为可达的状态重新编号
+    std::vector<int> newIds(n + groupCount, -1);
+    std::vector<int> order;
+    auto visit = [&](int node) {
+        if (newIds[node] == -1)
+        {
+            newIds[node] = order.size();
+            order.push_back(node);
+        }
+        return newIds[node];
+    };
+
+    auto ruleOf = [&](int node) { return node < n ? oldAccepts[node] : products[representatives[node - n]].rule; };
+
+    visit(finalOf(resolve(start)));
+    std::vector<std::unique_ptr<DFAState>> dfaStates;
+    for (int i = 0; i < order.size(); i++)
+    {
+        auto node = order[i];
+        auto rule = ruleOf(node);
+
+        std::unique_ptr<DFAState> dfaState;
+        if (rule != -1)
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = rule;
+            dfaState = std::move(endState);
+        }
+        else
+            dfaState = std::make_unique<DFAState>();
+
+        dfaState->id = i;
+        for (auto &path : node < n ? oldPaths[node] : paths[representatives[node - n]])
+            dfaState->paths.emplace_hint(dfaState->paths.end(), path.first, visit(finalOf(path.second)));
+        dfaStates.push_back(std::move(dfaState));
+    }
+
+    auto minimizedDFA = std::make_unique<DFA>(*dfaStates[0]);
+    for (auto &dfaState : dfaStates)
+    {
+        auto id = dfaState->id;
+        if (ruleOf(order[id]) != -1)
+            minimizedDFA->getEndStates().insert({id, static_cast<DFAEndState &>(*dfaState)});
+        minimizedDFA->getStates().insert({id, std::move(dfaState)});
+    }
+
+    // 重新计算关键字的宿主
+    auto nfaChlex = std::make_shared<NFAChlex>();
+    nfaChlex->parsedChlex = parsedChlex;
+    nfaChlex->keywords = DFACombiner::rehostKeywords(*minimizedDFA, keywords);
+
+    // 修改只在最小化DFA上进行，因此DFAChlex中不含DFA
+    auto dfaChlex = std::make_shared<DFAChlex>();
+    dfaChlex->nfaChlex = nfaChlex;
+
+    auto result = std::make_unique<MinimizedDFAChlex>();
+    result->dfaChlex = dfaChlex;
+    result->minimizedDFA = std::move(minimizedDFA);
+    return result;
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAEditor::update(const MinimizedDFAChlex &chlex, std::shared_ptr<ParsedChlex> parsedChlex, const std::vector<int> &newIndexOf)
+{
+    auto &oldNFAChlex = chlex.getDFAChlex().getNFAChlex();
+    auto &oldRegExps = oldNFAChlex.getParsedChlex().getRegExps();
+    auto &regExps = parsedChlex->getRegExps();
+    int oldCount = oldRegExps.size();
+    int count = regExps.size();
+
+    std::vector<int> oldIndexOf(count, -1);
+    for (int i = 0; i < oldCount; i++)
+    {
+        if (newIndexOf[i] != -1)
+            oldIndexOf[newIndexOf[i]] = i;
+    }
+
+    Edit edit;
+    auto &pool = edit.pool;
+    std::vector<int> nodes(count, -1);
+    auto nodeOf = [&](int i) {
+        if (nodes[i] == -1)
+            nodes[i] = pool.fromAST(*regExps[i]->ast, regExps[i]->regExp->caseless);
+        return nodes[i];
+    };
+
+    // 新的正则表达式的语法树还没有检查过，先生成它们的导数，使过大的有界重复总是报告为 DerivativeDFAFactoryException
+    for (int i = 0; i < count; i++)
+    {
+        if (oldIndexOf[i] != -1)
+            continue;
+        try
+        {
+            nodeOf(i);
+        }
+        catch (DerivativeDFAFactoryException &e)
+        {
+            e.rule = i;
+            throw;
+        }
+    }
+
+    // 按照生成NFA时的规则重新提取关键字，不在关键字表中的正则表达式都编译到DFA中
+    std::vector<bool> oldExtracted(oldCount, false);
+    for (auto &keyword : oldNFAChlex.getKeywords())
+        oldExtracted[keyword.rule] = true;
+
+    std::vector<bool> compiled(count, true);
+    std::vector<KeywordInfo> keywords;
+    for (auto &keyword : NFAFactory::getInstance().extractKeywords(*parsedChlex))
+    {
+        compiled[keyword.rule] = false;
+        if (keyword.hostRule != -1)
+            keywords.push_back(keyword);
+    }
+
+    for (int i = 0; i < oldCount; i++)
+        edit.ruleMap.push_back(newIndexOf[i] != -1 && compiled[newIndexOf[i]] ? newIndexOf[i] : -1);
+
+    // 移出DFA的是被删除或不再需要编译的正则表达式，加入DFA的是新的或失去宿主的正则表达式
+    std::vector<int> removed, added;
+    for (int i = 0; i < oldCount; i++)
+    {
+        if (!oldExtracted[i] && edit.ruleMap[i] == -1)
+            removed.push_back(i);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (compiled[i] && (oldIndexOf[i] == -1 || oldExtracted[oldIndexOf[i]]))
+            added.push_back(i);
+    }
+
+    // 移出DFA的正则表达式遮盖的只可能是优先级比它们低的正则表达式
+    std::vector<int> shadowedRules;
+    if (!removed.empty())
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (compiled[i] && oldIndexOf[i] > removed.front() && !oldExtracted[oldIndexOf[i]])
+                shadowedRules.push_back(i);
+        }
+    }
+
+    std::vector<int> changed;
+    for (auto i : removed)
+        changed.push_back(newIndexOf[i] != -1 ? nodeOf(newIndexOf[i]) : pool.fromAST(*oldRegExps[i]->ast, oldRegExps[i]->regExp->caseless));
+    for (auto i : added)
+        changed.push_back(nodeOf(i));
+    edit.roots.push_back(pool.makeOr(changed));
+    for (auto i : added)
+        edit.roots.push_back(nodeOf(i));
+    for (auto i : shadowedRules)
+        edit.roots.push_back(nodeOf(i));
+
+    edit.accept = [&](int oldRule, const std::vector<int> &derivs) {
+        auto rule = oldRule == -1 ? -1 : edit.ruleMap[oldRule];
+        if (oldRule != -1 && rule == -1)
+        {
+            for (int i = 0; i < shadowedRules.size(); i++)
+            {
+                if (pool.get(derivs[i + 1 + added.size()]).nullable)
+                {
+                    rule = shadowedRules[i];
+                    break;
+                }
+            }
+        }
+        for (int i = 0; i < added.size(); i++)
+        {
+            if (pool.get(derivs[i + 1]).nullable && (rule == -1 || added[i] < rule))
+                rule = added[i];
+        }
+        return rule;
+    };
+
+    return apply(chlex, edit, parsedChlex, std::move(keywords));
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAEditor::addRule(std::shared_ptr<MinimizedDFAChlex> chlex, std::shared_ptr<RegExp> regExp, int position)
+{
+    auto &oldParsedChlex = chlex->dfaChlex->nfaChlex->parsedChlex;
+    int ruleCount = oldParsedChlex->regExps.size();
+    if (position < 0 || position > ruleCount)
+        throw std::out_of_range("Rule index out of range");
+    if (!oldParsedChlex->hasAST())
+        throw std::invalid_argument("Abstract syntax trees have been released");
+
+    auto rawChlex = std::make_shared<RawChlex>();
+    rawChlex->tokens = oldParsedChlex->rawChlex->tokens;
+    rawChlex->regExps = oldParsedChlex->rawChlex->regExps;
+    rawChlex->regExps.insert(rawChlex->regExps.begin() + position, regExp);
+
+    // 原来的语法树节点仍由原来的Chlex持有
+    auto parsedChlex = std::make_shared<ParsedChlex>();
+    parsedChlex->rawChlex = rawChlex;
+    parsedChlex->bases.push_back(oldParsedChlex);
+    for (auto &parsedRegExp : oldParsedChlex->regExps)
+        parsedChlex->regExps.push_back(std::make_unique<ParsedRegExp>(parsedRegExp->regExp, parsedRegExp->ast));
+    parsedChlex->regExps.insert(parsedChlex->regExps.begin() + position, RegExpParser::getInstance().parse(regExp, parsedChlex->arena));
+
+    std::vector<int> newIndexOf;
+    for (int i = 0; i < ruleCount; i++)
+        newIndexOf.push_back(i < position ? i : i + 1);
+
+    return update(*chlex, parsedChlex, newIndexOf);
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAEditor::removeRule(std::shared_ptr<MinimizedDFAChlex> chlex, int rule)
+{
+    auto &oldParsedChlex = chlex->dfaChlex->nfaChlex->parsedChlex;
+    int ruleCount = oldParsedChlex->regExps.size();
+    if (rule < 0 || rule >= ruleCount)
+        throw std::out_of_range("Rule index out of range");
+    if (!oldParsedChlex->hasAST())
+        throw std::invalid_argument("Abstract syntax trees have been released");
+
+    auto rawChlex = std::make_shared<RawChlex>();
+    rawChlex->tokens = oldParsedChlex->rawChlex->tokens;
+    rawChlex->regExps = oldParsedChlex->rawChlex->regExps;
+    rawChlex->regExps.erase(rawChlex->regExps.begin() + rule);
+
+    auto parsedChlex = std::make_shared<ParsedChlex>();
+    parsedChlex->rawChlex = rawChlex;
+    parsedChlex->bases.push_back(oldParsedChlex);
+    for (int i = 0; i < ruleCount; i++)
+    {
+        if (i != rule)
+            parsedChlex->regExps.push_back(std::make_unique<ParsedRegExp>(oldParsedChlex->regExps[i]->regExp, oldParsedChlex->regExps[i]->ast));
+    }
+
+    std::vector<int> newIndexOf;
+    for (int i = 0; i < ruleCount; i++)
+        newIndexOf.push_back(i < rule ? i : i == rule ? -1 : i - 1);
+
+    return update(*chlex, parsedChlex, newIndexOf);
+}
@@ -9,7 +9,14 @@
 
 #include "DFAFactory.hh"
 
+#include "ThreadPool.hh"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <queue>
+#include <unordered_map>
 
 using namespace chlex;
 
@@ -86,7 +93,8 @@ std::set<int> DFAFactory::checkEndStates(std::vector<std::shared_ptr<std::set<in
                 // 创建shared_ptr时传入一个假的deleter，用于允许其指向的内容向unique_ptr转移
                 std::shared_ptr<DFAEndState> dfaEndState(new DFAEndState(), [](DFAEndState *p) {});
                 dfaEndState->id = dfaState->id;
-                dfaEndState->code = nfa.getEndStates().at(state).get().code;
+                dfaEndState->paths = dfaState->paths;
+                dfaEndState->rule = nfa.getEndStates().at(state).get().rule;
                 dfaStates[i] = dfaEndState;
 
                 // 由于原来的dfaState也具有假的deleter，因此需要手动释放
@@ -130,7 +138,7 @@ std::unique_ptr<DFA> DFAFactory::generate(const NFA &nfa)
         auto dfaState = dfaStateQueue.front();
         dfaStateQueue.pop();
 
-        for (char byChar = 1; byChar < 128; byChar++)
+        for (int byChar = 1; byChar < 256; byChar++)
         {
             auto nextStateSet = std::make_shared<std::set<int>>(move(*stateSet, byChar, nfa));
             if (nextStateSet->empty())
@@ -142,7 +150,7 @@ std::unique_ptr<DFA> DFAFactory::generate(const NFA &nfa)
                                          // 否则，该变量的值为-1
             for (int i = 0; i < stateSets.size(); i++)
             {
-                if (isEqual(*stateSet, *nextStateSet))
+                if (isEqual(*stateSets[i], *nextStateSet))
                 {
                     isExistingStateSet = dfaStates[i]->id;
                     break;
@@ -174,9 +182,10 @@ std::unique_ptr<DFA> DFAFactory::generate(const NFA &nfa)
     for (int i = 0; i < dfaStates.size(); i++)
     {
         std::unique_ptr<DFAState> dfaState(dfaStates[i].get());
-        dfa->getStates().insert({dfaState->id, std::move(dfaState)});
-        if (endStates.find(dfaState->id) != endStates.end())
-            dfa->getEndStates().insert({dfaState->id, (DFAEndState &)*dfaState});
+        auto id = dfaState->id;
+        if (endStates.find(id) != endStates.end())
+            dfa->getEndStates().insert({id, (DFAEndState &)*dfaState});
+        dfa->getStates().insert({id, std::move(dfaState)});
     }
 
     return dfa;
@@ -189,4 +198,364 @@ std::unique_ptr<DFAChlex> DFAFactory::generate(std::shared_ptr<NFAChlex> nfaChle
     dfaChlex->dfa = std::move(dfa);
     dfaChlex->nfaChlex = nfaChlex;
     return dfaChlex;
-}
\ No newline at end of file
+}
+
+namespace
+{
+    /**
+     * @brief 并行子集构造中的状态集合记录
+     */
+    struct SubsetRecord
+    {
+        std::vector<int> stateSet;               ///< 按下标排序的NFA状态集合
+        int tempId;                              ///< 临时id，由创建顺序决定，与线程调度有关
+        std::vector<std::pair<char, int>> paths; ///< 按字符排序的转移，目标为临时id
+    };
+
+    /**
+     * @brief 状态集合的哈希函数
+     */
+    struct StateSetHash
+    {
+        std::size_t operator()(const std::vector<int> &stateSet) const
+        {
+            std::size_t result = stateSet.size();
+            for (auto state : stateSet)
+                result = result * 1000003 ^ state;
+            return result;
+        }
+    };
+
+    /**
+     * @brief 分片加锁的状态集合驻留表
+     */
+    class SubsetTable
+    {
+    private:
+        static const int shardCount = 64; ///< 分片数量
+
+        /**
+         * @brief 驻留表的分片
+         */
+        struct Shard
+        {
+            std::mutex mutex;                                                      ///< 保护该分片的互斥锁
+            std::unordered_map<std::vector<int>, SubsetRecord *, StateSetHash> ids; ///< 从状态集合到记录的映射
+            std::vector<std::unique_ptr<SubsetRecord>> records;                    ///< 该分片中的所有记录
+        };
+
+        Shard shards[shardCount];   ///< 所有分片
+        std::atomic<int> nextId{0}; ///< 下一个临时id
+
+    public:
+        /**
+         * @brief 驻留状态集合
+         * @param stateSet 状态集合
+         * @return 对应的记录，以及该记录是否是新创建的
+         */
+        std::pair<SubsetRecord *, bool> intern(std::vector<int> &&stateSet)
+        {
+            auto &shard = shards[StateSetHash()(stateSet) % shardCount];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto it = shard.ids.find(stateSet);
+            if (it != shard.ids.end())
+                return {it->second, false};
+
+            auto record = std::make_unique<SubsetRecord>();
+            record->stateSet = stateSet;
+            record->tempId = nextId++;
+            auto result = record.get();
+            shard.ids.insert({std::move(stateSet), result});
+            shard.records.push_back(std::move(record));
+            return {result, true};
+        }
+
+        /**
+         * @brief 获取所有记录
+         * @return 按临时id排列的所有记录
+         * @note 只能在所有线程结束之后调用
+         */
+        std::vector<SubsetRecord *> getRecords()
+        {
+            std::vector<SubsetRecord *> result(nextId);
+            for (auto &shard : shards)
+                for (auto &record : shard.records)
+                    result[record->tempId] = record.get();
+            return result;
+        }
+    };
+
+    /**
+     * @brief 工作线程的双端队列
+     */
+    struct WorkQueue
+    {
+        std::mutex mutex;                  ///< 保护队列的互斥锁
+        std::deque<SubsetRecord *> records; ///< 尚未处理的记录
+    };
+}
+
+std::unique_ptr<DFA> DFAFactory::generate(const NFA &nfa, int threadCount)
+{
+    DFAFactoryScratch scratch;
+    return generate(nfa, threadCount, scratch);
+}
+
+std::unique_ptr<DFA> DFAFactory::generate(const NFA &nfa, int threadCount, DFAFactoryScratch &scratch)
+{
+    // 将NFA转换为用下标表示的紧凑形式，下标顺序与id顺序相同
+    std::vector<const NFAState *> nfaStates;
+    std::map<int, int> indexOf;
+    for (auto &i : nfa.getStates())
+    {
+        indexOf[i.first] = nfaStates.size();
+        nfaStates.push_back(i.second.get());
+    }
+
+    int nfaStateCount = nfaStates.size();
+    std::vector<std::vector<int>> epsilonPaths(nfaStateCount);
+    std::vector<std::vector<std::pair<char, int>>> charPaths(nfaStateCount);
+    for (int i = 0; i < nfaStateCount; i++)
+    {
+        for (auto &path : nfaStates[i]->paths)
+        {
+            auto to = indexOf.at(path->to.id);
+            if (path->byChar == 0)
+                epsilonPaths[i].push_back(to);
+            else
+                charPaths[i].push_back({path->byChar, to});
+        }
+    }
+
+    ThreadPool threadPool(threadCount);
+    int workerCount = threadPool.getThreadCount();
+
+    SubsetTable table;
+    std::vector<WorkQueue> queues(workerCount);
+    std::atomic<int> pending{0};           // 已创建但尚未处理完的记录数量
+    std::atomic<int> queued{0};            // 仍在队列中的记录数量
+    std::atomic<int> sleeping{0};          // 正在等待新记录的线程数量
+    std::atomic<bool> aborted{false};      // 是否有线程抛出了异常
+    std::mutex idleMutex;                  // 保护等待新记录的线程
+    std::condition_variable idleCondition; // 队列中出现新记录、所有记录处理完毕或有线程抛出异常时通知
+
+    // 每个线程的临时缓冲区。访问标记只会增大，因此之前留下的标记都小于新的标记，不需要清空
+    auto &marks = scratch.marks;
+    auto &markGenerations = scratch.markGenerations;
+    marks.resize(std::max<std::size_t>(marks.size(), workerCount));
+    markGenerations.resize(marks.size(), 0);
+    scratch.moves.resize(marks.size());
+    for (int worker = 0; worker < workerCount; worker++)
+    {
+        if (marks[worker].size() < nfaStateCount)
+            marks[worker].resize(nfaStateCount, 0);
+        scratch.moves[worker].resize(256);
+    }
+
+    auto closure = [&](std::vector<int> &stateSet, int worker) {
+        auto &mark = marks[worker];
+        auto generation = ++markGenerations[worker];
+        if (generation == 0)
+        {
+            std::fill(mark.begin(), mark.end(), 0);
+            generation = markGenerations[worker] = 1;
+        }
+        for (auto state : stateSet)
+            mark[state] = generation;
+
+        for (int i = 0; i < stateSet.size(); i++)
+        {
+            for (auto to : epsilonPaths[stateSet[i]])
+            {
+                if (mark[to] != generation)
+                {
+                    mark[to] = generation;
+                    stateSet.push_back(to);
+                }
+            }
+        }
+
+        std::sort(stateSet.begin(), stateSet.end());
+    };
+
+    std::vector<int> startStateSet{indexOf.at(nfa.getStartState().id)};
+    closure(startStateSet, 0);
+    auto startRecord = table.intern(std::move(startStateSet)).first;
+    pending = 1;
+    queued = 1;
+    queues[0].records.push_back(startRecord);
+
+    // 唤醒等待的线程。只有确实有线程在等待时才加锁
+    auto wake = [&](bool all) {
+        if (sleeping == 0 && !all)
+            return;
+        std::lock_guard<std::mutex> lock(idleMutex);
+        if (all)
+            idleCondition.notify_all();
+        else
+            idleCondition.notify_one();
+    };
+
+    threadPool.run(workerCount, [&](int worker, int) {
+        auto &moves = scratch.moves[worker];
+        try
+        {
+            while (!aborted)
+            {
+                // 先从自己队列的尾部取，再从其他队列的头部窃取
+                SubsetRecord *record = nullptr;
+                for (int i = 0; i < workerCount && record == nullptr; i++)
+                {
+                    auto &queue = queues[(worker + i) % workerCount];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (queue.records.empty())
+                        continue;
+
+                    if (i == 0)
+                    {
+                        record = queue.records.back();
+                        queue.records.pop_back();
+                    }
+                    else
+                    {
+                        record = queue.records.front();
+                        queue.records.pop_front();
+                    }
+                    queued--;
+                }
+
+                // 没有可以处理的记录时等待，而不是空转
+                if (record == nullptr)
+                {
+                    std::unique_lock<std::mutex> lock(idleMutex);
+                    sleeping++;
+                    idleCondition.wait(lock, [&]() { return queued > 0 || pending == 0 || aborted; });
+                    sleeping--;
+                    if (pending == 0)
+                        return;
+                    continue;
+                }
+
+                // 一次遍历求出对所有字符的move
+                for (auto &move : moves)
+                    move.clear();
+                for (auto state : record->stateSet)
+                    for (auto &path : charPaths[state])
+                        moves[static_cast<unsigned char>(path.first)].push_back(path.second);
+
+                for (int byChar = 1; byChar < 256; byChar++)
+                {
+                    auto &move = moves[byChar];
+                    if (move.empty())
+                        continue;
+
+                    std::sort(move.begin(), move.end());
+                    move.erase(std::unique(move.begin(), move.end()), move.end());
+
+                    std::vector<int> nextStateSet = move;
+                    closure(nextStateSet, worker);
+
+                    auto result = table.intern(std::move(nextStateSet));
+                    record->paths.push_back({static_cast<char>(byChar), result.first->tempId});
+
+                    if (result.second)
+                    {
+                        pending++;
+                        {
+                            std::lock_guard<std::mutex> lock(queues[worker].mutex);
+                            queues[worker].records.push_back(result.first);
+                        }
+                        queued++;
+                        wake(false);
+                    }
+                }
+
+                if (--pending == 0)
+                    wake(true);
+            }
+        }
+        catch (...)
+        {
+            // 其余线程等待的记录永远不会处理完，因此通知它们停止，异常由线程池重新抛出
+            aborted = true;
+            wake(true);
+            throw;
+        }
+    });
+
+    // 从起始状态开始广度优先地重新编号，使结果与线程调度无关
+    auto records = table.getRecords();
+    std::vector<int> newIdOf(records.size(), -1);
+    std::vector<SubsetRecord *> order{startRecord};
+    newIdOf[startRecord->tempId] = 0;
+    for (int i = 0; i < order.size(); i++)
+    {
+        for (auto &path : order[i]->paths)
+        {
+            if (newIdOf[path.second] == -1)
+            {
+                newIdOf[path.second] = order.size();
+                order.push_back(records[path.second]);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<DFAState>> dfaStates;
+    std::vector<bool> isEndState;
+    for (int i = 0; i < order.size(); i++)
+    {
+        // 如果状态集合中有多个终止状态，则取id最小的一个
+        const NFAEndState *nfaEndState = nullptr;
+        for (auto state : order[i]->stateSet)
+        {
+            auto it = nfa.getEndStates().find(nfaStates[state]->id);
+            if (it != nfa.getEndStates().end())
+            {
+                nfaEndState = &it->second.get();
+                break;
+            }
+        }
+
+        std::unique_ptr<DFAState> dfaState;
+        if (nfaEndState != nullptr)
+        {
+            auto dfaEndState = std::make_unique<DFAEndState>();
+            dfaEndState->rule = nfaEndState->rule;
+            dfaState = std::move(dfaEndState);
+        }
+        else
+            dfaState = std::make_unique<DFAState>();
+
+        dfaState->id = i;
+        for (auto &path : order[i]->paths)
+            dfaState->paths[path.first] = newIdOf[path.second];
+
+        isEndState.push_back(nfaEndState != nullptr);
+        dfaStates.push_back(std::move(dfaState));
+    }
+
+    auto dfa = std::make_unique<DFA>(*dfaStates[0]);
+    for (int i = 0; i < dfaStates.size(); i++)
+    {
+        if (isEndState[i])
+            dfa->getEndStates().insert({i, static_cast<DFAEndState &>(*dfaStates[i])});
+        dfa->getStates().insert({i, std::move(dfaStates[i])});
+    }
+
+    return dfa;
+}
+
+std::unique_ptr<DFAChlex> DFAFactory::generate(std::shared_ptr<NFAChlex> nfaChlex, int threadCount)
+{
+    DFAFactoryScratch scratch;
+    return generate(nfaChlex, threadCount, scratch);
+}
+
+std::unique_ptr<DFAChlex> DFAFactory::generate(std::shared_ptr<NFAChlex> nfaChlex, int threadCount, DFAFactoryScratch &scratch)
+{
+    auto dfaChlex = std::make_unique<DFAChlex>();
+    dfaChlex->dfa = generate(nfaChlex->getNFA(), threadCount, scratch);
+    dfaChlex->nfaChlex = nfaChlex;
+    return dfaChlex;
+}
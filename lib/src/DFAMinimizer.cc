@@ -9,7 +9,12 @@
 
 #include "DFAMinimizer.hh"
 
+#include "ByteClassifier.hh"
+#include "DFAPruner.hh"
+#include "ThreadPool.hh"
+
 #include <queue>
+#include <unordered_map>
 
 using namespace chlex;
 
@@ -36,24 +41,16 @@ std::set<int> DFAMinimizer::handleEndStates(std::set<std::shared_ptr<StateGroup>
     std::set<int> endStates;
     for (auto &group : groupSet)
     {
-        for (auto &stateId : group->states)
+        // 初始划分保证同一组中的状态要么都是终态，要么都不是
+        auto &state = dfa.getStates().at(group->states[0]);
+        if (dfa.getEndStates().find(state->id) != dfa.getEndStates().end())
         {
-            auto &state = dfa.getStates().at(stateId);
-            if (dfa.getEndStates().find(state->id) != dfa.getEndStates().end())
-            {
-                endStates.insert(group->groupId);
-                auto endState = std::make_unique<DFAEndState>();
-                endState->id = group->groupId;
-                for (auto &path : state->paths)
-                {
-                    auto &byChar = path.first;
-                    auto &to = path.second;
-                    endState->paths.insert({byChar, to});
-                }
-                endState->code = static_cast<DFAEndState &>(*state).code;
-                newStates[group->groupId] = std::move(endState);
-                break;
-            }
+            endStates.insert(group->groupId);
+            auto endState = std::make_unique<DFAEndState>();
+            endState->id = group->groupId;
+            endState->paths = std::move(newStates[group->groupId]->paths);
+            endState->rule = static_cast<DFAEndState &>(*state).rule;
+            newStates[group->groupId] = std::move(endState);
         }
     }
     return endStates;
@@ -61,135 +58,131 @@ std::set<int> DFAMinimizer::handleEndStates(std::set<std::shared_ptr<StateGroup>
 
 std::unique_ptr<DFA> DFAMinimizer::minimize(const DFA &dfa)
 {
+    // 先删除无用状态，剪枝后状态的id是连续的，可以直接用作下标
+    auto prunedDFA = DFAPruner::getInstance().prune(dfa);
+    auto &states = prunedDFA->getStates();
+
     // 保存每个状态在哪个组中
-    std::vector<StateInGroup> statesInGroup(dfa.getStates().size());
+    std::vector<StateInGroup> statesInGroup(states.size());
 
-    // 初始情况，将所有终态放入组1，其余放入组0
-    auto group0 = std::make_shared<StateGroup>();
-    auto group1 = std::make_shared<StateGroup>();
-    for (auto &i : dfa.getStates())
+    // 初始情况，将所有非终态放入组0，终态按照接受的规则分组
+    std::map<int, std::shared_ptr<StateGroup>> initialGroups;
+    for (auto &i : states)
     {
         auto stateId = i.first;
-        auto &state = i.second;
         statesInGroup[stateId].stateId = stateId;
 
-        if (dfa.getEndStates().find(state->id) != dfa.getEndStates().end())
-        {
-            statesInGroup[stateId].groupId = 1;
-            group1->states.push_back(stateId);
-        }
-        else
+        int key = -2;
+        auto it = prunedDFA->getEndStates().find(stateId);
+        if (it != prunedDFA->getEndStates().end())
+            key = it->second.get().rule;
+
+        auto &group = initialGroups[key];
+        if (group == nullptr)
         {
-            statesInGroup[stateId].groupId = 0;
-            group0->states.push_back(stateId);
+            group = std::make_shared<StateGroup>();
+            group->groupId = initialGroups.size() - 1;
         }
+        statesInGroup[stateId].groupId = group->groupId;
+        group->states.push_back(stateId);
     }
 
     std::queue<std::shared_ptr<StateGroup>> groupQueue;
     std::set<std::shared_ptr<StateGroup>> groupSet;
 
-    groupQueue.push(group0);
-    groupQueue.push(group1);
+    for (auto &i : initialGroups)
+        groupQueue.push(i.second);
 
-    // 循环处理每个组，尝试将其划分
-    int nextGroupId = 2;
+    // 循环处理每个组，尝试将其划分。一个组被划分后，已经处理过的组也可能需要重新划分，
+    // 因此每当队列为空而本轮有组被划分时，把所有组重新放回队列
+    int nextGroupId = initialGroups.size();
+    bool split = false;
     while (!groupQueue.empty())
     {
         auto group = groupQueue.front();
         groupQueue.pop();
 
         if (group->states.size() == 1)
-        {
             groupSet.insert(group);
-            break;
-        }
-
-        // 记录每个状态对于每个字符移动到哪个组
-        std::map<int, MoveInfo> groupMoveInfo;
-        for (auto &state : group->states)
+        else
         {
-            auto &dfaState = *(dfa.getStates().at(state));
-            MoveInfo moveInfo;
-            for (auto &path : dfaState.paths)
+            // 记录每个状态对于每个字符移动到哪个组
+            std::map<int, MoveInfo> groupMoveInfo;
+            for (auto &state : group->states)
             {
-                auto &byChar = path.first;
-                auto &to = path.second;
+                auto &dfaState = *states.at(state);
+                MoveInfo moveInfo;
+                for (auto &path : dfaState.paths)
+                {
+                    auto &byChar = path.first;
+                    auto &to = path.second;
 
-                moveInfo[byChar] = statesInGroup[to].groupId;
+                    moveInfo[byChar] = statesInGroup[to].groupId;
+                }
+                groupMoveInfo[state] = std::move(moveInfo);
             }
-        }
 
-        // 把移动到同一组的状态放到一起
-        std::vector<std::vector<int>> newGroups;
-        newGroups.push_back(std::vector<int>(group->states[0]));
-
-        for (int i = 1; i < group->states.size(); i++)
-        {
-            auto stateId = group->states[i];
+            // 把移动到同一组的状态放到一起
+            std::vector<std::vector<int>> newGroups;
+            newGroups.push_back({group->states[0]});
 
-            bool inCurrentGroups = false;
-            for (int j = 0; j < newGroups.size(); j++)
+            for (int i = 1; i < group->states.size(); i++)
             {
-                auto &newGroup = newGroups[j];
-                auto &firstStateId = newGroup[0];
-                if (isSame(groupMoveInfo[stateId], groupMoveInfo[firstStateId]))
+                auto stateId = group->states[i];
+
+                bool inCurrentGroups = false;
+                for (int j = 0; j < newGroups.size(); j++)
                 {
-                    newGroup.push_back(stateId);
-                    inCurrentGroups = true;
-                    break;
+                    auto &newGroup = newGroups[j];
+                    auto &firstStateId = newGroup[0];
+                    if (isSame(groupMoveInfo[stateId], groupMoveInfo[firstStateId]))
+                    {
+                        newGroup.push_back(stateId);
+                        inCurrentGroups = true;
+                        break;
+                    }
                 }
+                if (!inCurrentGroups)
+                    newGroups.push_back({stateId});
             }
-            if (!inCurrentGroups)
-                newGroups.push_back(std::vector<int>(stateId));
-        }
-
-        if (newGroups.size() == 1)
-        {
-            groupSet.insert(group);
-            continue;
-        }
 
-        for (int i = 0; i < newGroups.size(); i++)
-        {
-            auto &newGroup = newGroups[i];
-            auto newGroupPtr = std::make_shared<StateGroup>();
-            newGroupPtr->groupId = nextGroupId++;
-            for (auto &stateId : newGroup)
+            if (newGroups.size() == 1)
+                groupSet.insert(group);
+            else
             {
-                statesInGroup[stateId].groupId = newGroupPtr->groupId;
-                newGroupPtr->states.push_back(stateId);
+                split = true;
+                for (int i = 0; i < newGroups.size(); i++)
+                {
+                    auto &newGroup = newGroups[i];
+                    auto newGroupPtr = std::make_shared<StateGroup>();
+                    newGroupPtr->groupId = nextGroupId++;
+                    for (auto &stateId : newGroup)
+                    {
+                        statesInGroup[stateId].groupId = newGroupPtr->groupId;
+                        newGroupPtr->states.push_back(stateId);
+                    }
+                    groupQueue.push(newGroupPtr);
+                }
             }
-            groupQueue.push(newGroupPtr);
         }
-    }
-
-    // 找到初态所在的组
-    auto startGroupId = statesInGroup[dfa.getStartState().id].groupId;
-    std::unique_ptr<DFAState> newStartState = std::make_unique<DFAState>();
-    newStartState->id = startGroupId;
-
-    // 生成新的DFA
-    std::vector<std::unique_ptr<DFAState>> newStates;
-    newStates.push_back(std::move(newStartState));
-
-    for (auto path : dfa.getStartState().paths)
-    {
-        auto &byChar = path.first;
-        auto &to = path.second;
 
-        auto toGroup = statesInGroup[to].groupId;
-        newStartState->paths[byChar] = toGroup;
+        if (groupQueue.empty() && split)
+        {
+            for (auto &finishedGroup : groupSet)
+                groupQueue.push(finishedGroup);
+            groupSet.clear();
+            split = false;
+        }
     }
 
+    // 生成新的DFA，新状态的id暂时使用组的id
+    std::vector<std::unique_ptr<DFAState>> newStates(nextGroupId);
     for (auto &group : groupSet)
     {
-        if (group->groupId == startGroupId)
-            continue;
-
         auto newState = std::make_unique<DFAState>();
         newState->id = group->groupId;
 
-        auto &groupState = dfa.getStates().at(group->states[0]);
+        auto &groupState = states.at(group->states[0]);
 
         for (auto path : groupState->paths)
         {
@@ -200,15 +193,20 @@ std::unique_ptr<DFA> DFAMinimizer::minimize(const DFA &dfa)
             newState->paths[byChar] = toGroup;
         }
 
-        newStates.push_back(std::move(newState));
+        newStates[group->groupId] = std::move(newState);
     }
 
-    auto endStates = handleEndStates(groupSet, newStates, dfa);
+    auto endStates = handleEndStates(groupSet, newStates, *prunedDFA);
 
-    auto newDFA = std::make_unique<DFA>(*newStates[0]);
+    // 找到初态所在的组
+    auto startGroupId = statesInGroup[prunedDFA->getStartState().id].groupId;
+    auto newDFA = std::make_unique<DFA>(*newStates[startGroupId]);
 
     for (int i = 0; i < newStates.size(); i++)
     {
+        if (newStates[i] == nullptr)
+            continue;
+
         auto state = std::move(newStates[i]);
 
         if (endStates.find(state->id) != endStates.end())
@@ -217,7 +215,8 @@ std::unique_ptr<DFA> DFAMinimizer::minimize(const DFA &dfa)
         newDFA->getStates().insert({state->id, std::move(state)});
     }
 
-    return newDFA;
+    // 组的id不连续，再次剪枝以重新编号
+    return DFAPruner::getInstance().prune(*newDFA);
 }
 
 std::unique_ptr<MinimizedDFAChlex> DFAMinimizer::minimize(std::shared_ptr<DFAChlex> dfaChlex)
@@ -226,4 +225,216 @@ std::unique_ptr<MinimizedDFAChlex> DFAMinimizer::minimize(std::shared_ptr<DFAChl
     minimizedDFAChlex->dfaChlex = dfaChlex;
     minimizedDFAChlex->minimizedDFA = minimize(*dfaChlex->dfa);
     return minimizedDFAChlex;
-}
\ No newline at end of file
+}
+
+namespace
+{
+    /**
+     * @brief Moore算法中状态签名的哈希函数
+     */
+    struct SignatureHash
+    {
+        std::size_t operator()(const std::vector<int> &signature) const
+        {
+            std::size_t result = signature.size();
+            for (auto group : signature)
+                result = result * 1000003 ^ (group + 1);
+            return result;
+        }
+    };
+}
+
+std::unique_ptr<DFA> DFAMinimizer::minimize(const DFA &dfa, int threadCount)
+{
+    DFAMinimizerScratch scratch;
+    return minimize(dfa, threadCount, scratch);
+}
+
+std::unique_ptr<DFA> DFAMinimizer::minimize(const DFA &dfa, int threadCount, DFAMinimizerScratch &scratch)
+{
+    // 将状态连续编号，之后的计算都使用下标
+    std::vector<const DFAState *> states;
+    std::vector<int> indexOf(dfa.getStates().rbegin()->first + 1, -1);
+    for (auto &i : dfa.getStates())
+    {
+        indexOf[i.first] = states.size();
+        states.push_back(i.second.get());
+    }
+    int stateCount = states.size();
+
+    auto byteClasses = ByteClassifier::getInstance().classify(dfa);
+    int classCount = byteClasses.classCount;
+
+    // 到死状态的转移与没有转移等价，视为没有转移
+    auto live = DFAPruner::getInstance().findLiveStates(dfa);
+
+    // 每个状态对每个字节等价类的转移，-1表示没有转移
+    auto &moves = scratch.moves;
+    moves.assign(stateCount * classCount, -1);
+    for (int i = 0; i < stateCount; i++)
+    {
+        for (int c = 0; c < classCount; c++)
+        {
+            auto &paths = states[i]->paths;
+            auto it = paths.find(static_cast<char>(byteClasses.representatives[c]));
+            if (it != paths.end() && live[it->second])
+                moves[i * classCount + c] = indexOf[it->second];
+        }
+    }
+
+    // 初始划分：非终止状态为一组，终止状态按照接受的规则分组
+    auto &groupOf = scratch.groupOf;
+    groupOf.resize(stateCount);
+    int groupCount = 0;
+    {
+        std::map<int, int> initialGroups;
+        for (int i = 0; i < stateCount; i++)
+        {
+            int key = -2;
+            auto it = dfa.getEndStates().find(states[i]->id);
+            if (it != dfa.getEndStates().end())
+                key = it->second.get().rule;
+
+            auto result = initialGroups.insert({key, static_cast<int>(initialGroups.size())});
+            groupOf[i] = result.first->second;
+        }
+        groupCount = initialGroups.size();
+    }
+
+    ThreadPool threadPool(threadCount);
+    int chunkSize = 1024;
+    int chunkCount = (stateCount + chunkSize - 1) / chunkSize;
+
+    auto &signatures = scratch.signatures;
+    auto &hashes = scratch.hashes;
+    auto &newGroupOf = scratch.newGroupOf;
+    if (signatures.size() < stateCount)
+        signatures.resize(stateCount);
+    hashes.resize(stateCount);
+    newGroupOf.resize(stateCount);
+    while (true)
+    {
+        // 并行计算每个状态的签名及其哈希值
+        threadPool.run(chunkCount, [&](int chunk, int) {
+            auto end = std::min(stateCount, (chunk + 1) * chunkSize);
+            for (int i = chunk * chunkSize; i < end; i++)
+            {
+                auto &signature = signatures[i];
+                signature.resize(classCount + 1);
+                signature[0] = groupOf[i];
+                for (int c = 0; c < classCount; c++)
+                {
+                    auto to = moves[i * classCount + c];
+                    signature[c + 1] = to == -1 ? -1 : groupOf[to];
+                }
+                hashes[i] = SignatureHash()(signature);
+            }
+        });
+
+        // 按照签名重新分组，组按照其中下标最小的状态的顺序编号
+        std::unordered_map<std::size_t, std::vector<std::pair<int, int>>> buckets;
+        int newGroupCount = 0;
+        for (int i = 0; i < stateCount; i++)
+        {
+            auto &bucket = buckets[hashes[i]];
+            int newGroup = -1;
+            for (auto &entry : bucket)
+            {
+                if (signatures[entry.first] == signatures[i])
+                {
+                    newGroup = entry.second;
+                    break;
+                }
+            }
+
+            if (newGroup == -1)
+            {
+                newGroup = newGroupCount++;
+                bucket.push_back({i, newGroup});
+            }
+            newGroupOf[i] = newGroup;
+        }
+
+        groupOf.swap(newGroupOf);
+        if (newGroupCount == groupCount)
+            break;
+        groupCount = newGroupCount;
+    }
+
+    // 每组取下标最小的状态作为代表
+    std::vector<int> representative(groupCount, -1);
+    for (int i = 0; i < stateCount; i++)
+        if (representative[groupOf[i]] == -1)
+            representative[groupOf[i]] = i;
+
+    // 从起始状态所在的组开始广度优先地重新编号
+    std::vector<int> newIdOf(groupCount, -1);
+    std::vector<int> order{groupOf[indexOf[dfa.getStartState().id]]};
+    newIdOf[order[0]] = 0;
+    for (int i = 0; i < order.size(); i++)
+    {
+        for (auto &path : states[representative[order[i]]]->paths)
+        {
+            if (!live[path.second])
+                continue;
+            auto toGroup = groupOf[indexOf[path.second]];
+            if (newIdOf[toGroup] == -1)
+            {
+                newIdOf[toGroup] = order.size();
+                order.push_back(toGroup);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<DFAState>> newStates;
+    std::vector<bool> isEndState;
+    for (int i = 0; i < order.size(); i++)
+    {
+        auto &state = *states[representative[order[i]]];
+        auto it = dfa.getEndStates().find(state.id);
+
+        std::unique_ptr<DFAState> newState;
+        if (it != dfa.getEndStates().end())
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = it->second.get().rule;
+            newState = std::move(endState);
+        }
+        else
+            newState = std::make_unique<DFAState>();
+
+        newState->id = i;
+        for (auto &path : state.paths)
+        {
+            if (live[path.second])
+                newState->paths[path.first] = newIdOf[groupOf[indexOf[path.second]]];
+        }
+
+        isEndState.push_back(it != dfa.getEndStates().end());
+        newStates.push_back(std::move(newState));
+    }
+
+    auto newDFA = std::make_unique<DFA>(*newStates[0]);
+    for (int i = 0; i < newStates.size(); i++)
+    {
+        if (isEndState[i])
+            newDFA->getEndStates().insert({i, static_cast<DFAEndState &>(*newStates[i])});
+        newDFA->getStates().insert({i, std::move(newStates[i])});
+    }
+
+    return newDFA;
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAMinimizer::minimize(std::shared_ptr<DFAChlex> dfaChlex, int threadCount)
+{
+    DFAMinimizerScratch scratch;
+    return minimize(dfaChlex, threadCount, scratch);
+}
+
+std::unique_ptr<MinimizedDFAChlex> DFAMinimizer::minimize(std::shared_ptr<DFAChlex> dfaChlex, int threadCount, DFAMinimizerScratch &scratch)
+{
+    auto minimizedDFAChlex = std::make_unique<MinimizedDFAChlex>();
+    minimizedDFAChlex->dfaChlex = dfaChlex;
+    minimizedDFAChlex->minimizedDFA = minimize(*dfaChlex->dfa, threadCount, scratch);
+    return minimizedDFAChlex;
+}
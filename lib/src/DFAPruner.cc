@@ -0,0 +1,125 @@
+/**
+ * @file DFAPruner.cc
+ * @brief DFAPruner.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "DFAPruner.hh"
+
+using namespace chlex;
+
+DFAPruner DFAPruner::instance;
+
+std::vector<bool> DFAPruner::findLiveStates(const DFA &dfa)
+{
+    int idCount = dfa.getStates().empty() ? 0 : dfa.getStates().rbegin()->first + 1;
+
+    // 按照目标状态分桶的前驱，用于从终止状态反向搜索
+    std::vector<int> predecessorStart(idCount + 1, 0);
+    for (auto &i : dfa.getStates())
+        for (auto &path : i.second->paths)
+            predecessorStart[path.second + 1]++;
+    for (int i = 0; i < idCount; i++)
+        predecessorStart[i + 1] += predecessorStart[i];
+
+    std::vector<int> predecessors(predecessorStart[idCount]);
+    std::vector<int> filled(predecessorStart.begin(), predecessorStart.end() - 1);
+    for (auto &i : dfa.getStates())
+        for (auto &path : i.second->paths)
+            predecessors[filled[path.second]++] = i.first;
+
+    std::vector<bool> live(idCount, false);
+    std::vector<int> stack;
+    for (auto &i : dfa.getEndStates())
+    {
+        live[i.first] = true;
+        stack.push_back(i.first);
+    }
+    while (!stack.empty())
+    {
+        auto state = stack.back();
+        stack.pop_back();
+        for (int i = predecessorStart[state]; i < predecessorStart[state + 1]; i++)
+        {
+            auto predecessor = predecessors[i];
+            if (!live[predecessor])
+            {
+                live[predecessor] = true;
+                stack.push_back(predecessor);
+            }
+        }
+    }
+    return live;
+}
+
+std::unique_ptr<DFA> DFAPruner::prune(const DFA &dfa)
+{
+    auto live = findLiveStates(dfa);
+    int idCount = live.size();
+
+    // 从起始状态开始广度优先地编号，只经过能到达终止状态的状态
+    std::vector<int> newIdOf(idCount, -1);
+    std::vector<const DFAState *> order{&dfa.getStartState()};
+    newIdOf[dfa.getStartState().id] = 0;
+    for (int i = 0; i < order.size(); i++)
+    {
+        for (auto &path : order[i]->paths)
+        {
+            auto to = path.second;
+            if (live[to] && newIdOf[to] == -1)
+            {
+                newIdOf[to] = order.size();
+                order.push_back(dfa.getStates().at(to).get());
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<DFAState>> newStates;
+    std::vector<bool> isEndState;
+    for (int i = 0; i < order.size(); i++)
+    {
+        auto &state = *order[i];
+        auto it = dfa.getEndStates().find(state.id);
+
+        std::unique_ptr<DFAState> newState;
+        if (it != dfa.getEndStates().end())
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = it->second.get().rule;
+            newState = std::move(endState);
+        }
+        else
+            newState = std::make_unique<DFAState>();
+
+        newState->id = i;
+        for (auto &path : state.paths)
+        {
+            if (live[path.second])
+                newState->paths.emplace_hint(newState->paths.end(), path.first, newIdOf[path.second]);
+        }
+
+        isEndState.push_back(it != dfa.getEndStates().end());
+        newStates.push_back(std::move(newState));
+    }
+
+    auto newDFA = std::make_unique<DFA>(*newStates[0]);
+    for (int i = 0; i < newStates.size(); i++)
+    {
+        if (isEndState[i])
+            newDFA->getEndStates().insert({i, static_cast<DFAEndState &>(*newStates[i])});
+        newDFA->getStates().emplace_hint(newDFA->getStates().end(), i, std::move(newStates[i]));
+    }
+
+    return newDFA;
+}
+
+std::unique_ptr<DFAChlex> DFAPruner::prune(std::shared_ptr<DFAChlex> dfaChlex)
+{
+    auto prunedDFAChlex = std::make_unique<DFAChlex>();
+    prunedDFAChlex->nfaChlex = dfaChlex->nfaChlex;
+    prunedDFAChlex->dfa = prune(*dfaChlex->dfa);
+    return prunedDFAChlex;
+}
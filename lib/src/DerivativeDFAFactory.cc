@@ -0,0 +1,640 @@
+/**
+ * @file DerivativeDFAFactory.cc
+ * @brief DerivativeDFAFactory.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "DerivativeDFAFactory.hh"
+
+#include "NFAFactory.hh"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace chlex;
+
+DerivativeDFAFactory DerivativeDFAFactory::instance;
+
+std::size_t DerivNodePool::KeyHash::operator()(const Key &key) const
+{
+    std::size_t result = std::hash<std::bitset<256>>()(key.chars) ^ static_cast<std::size_t>(key.type);
+    for (auto child : key.children)
+        result = result * 1000003 ^ child;
+    return result;
+}
+
+DerivNodePool::DerivNodePool()
+{
+    emptyId = intern(Key{DerivNodeType::EMPTY}, false);
+    epsilonId = intern(Key{DerivNodeType::EPSILON}, true);
+}
+
+int DerivNodePool::intern(Key key, bool nullable)
+{
+    auto it = internTable.find(key);
+    if (it != internTable.end())
+        return it->second;
+
+    auto node = std::make_unique<DerivNode>();
+    node->type = key.type;
+    node->id = nodes.size();
+    node->nullable = nullable;
+    node->chars = key.chars;
+    node->children = key.children;
+
+    auto id = node->id;
+    internTable.insert({std::move(key), id});
+    nodes.push_back(std::move(node));
+    return id;
+}
+
+int DerivNodePool::makeCharSet(const std::bitset<256> &chars)
+{
+    if (chars.none())
+        return emptyId;
+
+    return intern(Key{DerivNodeType::CHARSET, chars}, false);
+}
+
+int DerivNodePool::makeConcat(int left, int right)
+{
+    if (left == emptyId || right == emptyId)
+        return emptyId;
+    if (left == epsilonId)
+        return right;
+    if (right == epsilonId)
+        return left;
+
+    // 将(ab)c规范化为a(bc)，使得相同的语言总是得到相同的节点
+    // 左子节点已经是右结合的，其中每个连接节点的左子节点都不是连接，因此依次取出这些左子节点，再从右向左连接
+    std::vector<int> lefts;
+    while (nodes[left]->type == DerivNodeType::CONCAT)
+    {
+        lefts.push_back(nodes[left]->children[0]);
+        left = nodes[left]->children[1];
+    }
+    lefts.push_back(left);
+
+    auto result = right;
+    for (auto it = lefts.rbegin(); it != lefts.rend(); it++)
+    {
+        auto nullable = nodes[*it]->nullable && nodes[result]->nullable;
+        result = intern(Key{DerivNodeType::CONCAT, {}, {*it, result}}, nullable);
+    }
+    return result;
+}
+
+int DerivNodePool::makeOr(int left, int right)
+{
+    if (left == right)
+        return left;
+    if (left == emptyId)
+        return right;
+    if (right == emptyId)
+        return left;
+
+    return makeOr(std::vector<int>{left, right});
+}
+
+int DerivNodePool::makeOr(const std::vector<int> &alternatives)
+{
+    // 展平所有的或运算，并把所有字符集合合并为一个
+    std::vector<int> children;
+    std::bitset<256> chars;
+    for (auto side : alternatives)
+    {
+        auto &node = *nodes[side];
+        if (node.type == DerivNodeType::OR)
+        {
+            for (auto child : node.children)
+            {
+                if (nodes[child]->type == DerivNodeType::CHARSET)
+                    chars |= nodes[child]->chars;
+                else
+                    children.push_back(child);
+            }
+        }
+        else if (node.type == DerivNodeType::CHARSET)
+            chars |= node.chars;
+        else if (node.type != DerivNodeType::EMPTY)
+            children.push_back(side);
+    }
+
+    if (chars.any())
+        children.push_back(makeCharSet(chars));
+
+    std::sort(children.begin(), children.end());
+    children.erase(std::unique(children.begin(), children.end()), children.end());
+
+    if (children.empty())
+        return emptyId;
+    if (children.size() == 1)
+        return children[0];
+
+    bool nullable = false;
+    for (auto child : children)
+        nullable = nullable || nodes[child]->nullable;
+
+    return intern(Key{DerivNodeType::OR, {}, std::move(children)}, nullable);
+}
+
+int DerivNodePool::makeStar(int child)
+{
+    if (child == emptyId || child == epsilonId)
+        return epsilonId;
+    if (nodes[child]->type == DerivNodeType::STAR)
+        return child;
+
+    return intern(Key{DerivNodeType::STAR, {}, {child}}, true);
+}
+
+int DerivNodePool::fromAST(const RENode &ast, bool foldCase)
+{
+    // 用显式的栈代替递归，按后序遍历语法树：节点第一次出栈时压入它的操作数，第二次出栈时组合操作数的节点
+    // 连续的或运算和连接分别展平为一个多元的节点，使得很长的或运算和连接只需组合一次
+    // 被多个父节点引用的子树只创建一次
+    // 同时按照Thompson构造估计每个子树的NFA状态数，有界重复超出 NFAFactory::maxRepeatStates 时与NFA路径一样立即失败，
+    // 否则嵌套的重复虽然只创建很少的节点，却会在求导时展开出同样多的DFA状态
+    struct Frame
+    {
+        const RENode *node; ///< 语法树节点
+        int operands;       ///< 已经压入的操作数的数量，-1表示尚未压入
+    };
+
+    std::vector<Frame> nodeStack{{&ast, -1}};
+    std::vector<int> idStack;
+    std::vector<std::size_t> sizeStack;
+    std::unordered_map<const RENode *, std::pair<int, std::size_t>> created;
+
+    while (!nodeStack.empty())
+    {
+        auto frame = nodeStack.back();
+        nodeStack.pop_back();
+        auto node = frame.node;
+
+        if (frame.operands == -1)
+        {
+            auto it = created.find(node);
+            if (it != created.end())
+            {
+                idStack.push_back(it->second.first);
+                sizeStack.push_back(it->second.second);
+                continue;
+            }
+        }
+
+        int result;
+        std::size_t size = 2;
+        switch (node->type)
+        {
+        case RENodeType::CHAR:
+        {
+            std::bitset<256> chars;
+            chars.set(static_cast<unsigned char>(static_cast<const CharNode *>(node)->value));
+            result = makeCharSet(foldCase ? CharSetNode::foldCase(chars) : chars);
+            break;
+        }
+        case RENodeType::CHARSET:
+        {
+            const auto &chars = static_cast<const CharSetNode *>(node)->chars;
+            result = makeCharSet(foldCase ? CharSetNode::foldCase(chars) : chars);
+            break;
+        }
+        case RENodeType::OR:
+        case RENodeType::CONCAT:
+        {
+            if (frame.operands == -1)
+            {
+                // 按从左到右的顺序找出同一类型的连续节点下的所有操作数，倒序压栈使得最左边的操作数最先出栈
+                std::vector<const RENode *> operands;
+                std::vector<const RENode *> chain{node};
+                while (!chain.empty())
+                {
+                    auto current = chain.back();
+                    chain.pop_back();
+                    if (current->type != node->type || (current != node && created.count(current)))
+                    {
+                        operands.push_back(current);
+                        continue;
+                    }
+                    chain.push_back(static_cast<const BiOpNode *>(current)->right);
+                    chain.push_back(static_cast<const BiOpNode *>(current)->left);
+                }
+
+                nodeStack.push_back({node, static_cast<int>(operands.size())});
+                for (auto it = operands.rbegin(); it != operands.rend(); it++)
+                    nodeStack.push_back({*it, -1});
+                continue;
+            }
+
+            std::vector<int> operands(idStack.end() - frame.operands, idStack.end());
+            idStack.resize(idStack.size() - frame.operands);
+            size = node->type == RENodeType::OR ? 2 * (frame.operands - 1) : 0;
+            for (int i = 0; i < frame.operands; i++)
+                size += sizeStack[sizeStack.size() - frame.operands + i];
+            sizeStack.resize(sizeStack.size() - frame.operands);
+
+            if (node->type == RENodeType::OR)
+                result = makeOr(operands);
+            else
+            {
+                // 从右向左连接，每次连接的右边总是已经规范化的
+                result = epsilonId;
+                for (auto it = operands.rbegin(); it != operands.rend(); it++)
+                    result = makeConcat(*it, result);
+            }
+            break;
+        }
+        case RENodeType::STAR:
+        case RENodeType::PLUS:
+        case RENodeType::QUESTION:
+        case RENodeType::REPEAT:
+        {
+            if (frame.operands == -1)
+            {
+                nodeStack.push_back({node, 1});
+                nodeStack.push_back({static_cast<const MonoOpNode *>(node)->child, -1});
+                continue;
+            }
+
+            auto child = idStack.back();
+            auto childSize = sizeStack.back();
+            idStack.pop_back();
+            sizeStack.pop_back();
+            size = childSize + 2;
+            if (node->type == RENodeType::STAR)
+                result = makeStar(child);
+            else if (node->type == RENodeType::PLUS) // a+ = aa*
+                result = makeConcat(child, makeStar(child));
+            else if (node->type == RENodeType::QUESTION) // a? = ε|a
+                result = makeOr(epsilonId, child);
+            else // a{m,n} = a...a(ε|a(ε|a...))，a{m,} = a...aa*，各个副本共享同一个id
+            {
+                const auto &repeatNode = static_cast<const RepeatNode &>(*node);
+                std::size_t copies = repeatNode.max == -1 ? repeatNode.min + 1 : repeatNode.max;
+                if (copies > 0 && childSize > NFAFactory::maxRepeatStates / copies)
+                    throw DerivativeDFAFactoryException("Repetition generates too many states", -1);
+                size = childSize * copies + 2;
+
+                result = repeatNode.max == -1 ? makeStar(child) : epsilonId;
+                for (int i = repeatNode.min; i < repeatNode.max; i++)
+                    result = makeOr(epsilonId, makeConcat(child, result));
+                for (int i = 0; i < repeatNode.min; i++)
+                    result = makeConcat(child, result);
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error("Unknown RENodeType (this should never happen)");
+        }
+
+        created.insert({node, {result, size}});
+        idStack.push_back(result);
+        sizeStack.push_back(size);
+    }
+
+    return idStack.back();
+}
+
+int DerivNodePool::derive(int id, char byChar)
+{
+    auto byte = static_cast<unsigned char>(byChar);
+    auto cacheKey = [byte](int id) { return (static_cast<unsigned long long>(id) << 8) | byte; };
+    auto it = derivCache.find(cacheKey(id));
+    if (it != derivCache.end())
+        return it->second;
+
+    // 用显式的栈代替递归：节点第一次出栈时压入需要求导的子节点，第二次出栈时子节点的导数都已在缓存中
+    std::vector<std::pair<int, bool>> nodeStack{{id, false}};
+    while (!nodeStack.empty())
+    {
+        auto current = nodeStack.back().first;
+        auto childrenDone = nodeStack.back().second;
+        nodeStack.pop_back();
+
+        if (derivCache.count(cacheKey(current)))
+            continue;
+
+        auto &node = *nodes[current];
+        if (!childrenDone)
+        {
+            nodeStack.push_back({current, true});
+            switch (node.type)
+            {
+            case DerivNodeType::CONCAT:
+                if (nodes[node.children[0]]->nullable)
+                    nodeStack.push_back({node.children[1], false});
+                nodeStack.push_back({node.children[0], false});
+                break;
+            case DerivNodeType::OR:
+            case DerivNodeType::STAR:
+                for (auto child : node.children)
+                    nodeStack.push_back({child, false});
+                break;
+            default:
+                break;
+            }
+            continue;
+        }
+
+        auto derived = [&](int child) { return derivCache.at(cacheKey(child)); };
+        int result;
+        switch (node.type)
+        {
+        case DerivNodeType::EMPTY:
+        case DerivNodeType::EPSILON:
+            result = emptyId;
+            break;
+        case DerivNodeType::CHARSET:
+            result = node.chars.test(byte) ? epsilonId : emptyId;
+            break;
+        case DerivNodeType::CONCAT: // d(rs) = d(r)s | ν(r)d(s)
+        {
+            auto left = node.children[0];
+            auto right = node.children[1];
+            result = makeConcat(derived(left), right);
+            if (nodes[left]->nullable)
+                result = makeOr(result, derived(right));
+            break;
+        }
+        case DerivNodeType::OR: // d(r|s) = d(r)|d(s)
+        {
+            std::vector<int> alternatives;
+            alternatives.reserve(node.children.size());
+            for (auto child : node.children)
+                alternatives.push_back(derived(child));
+            result = makeOr(alternatives);
+            break;
+        }
+        case DerivNodeType::STAR: // d(r*) = d(r)r*
+            result = makeConcat(derived(node.children[0]), current);
+            break;
+        default:
+            throw std::runtime_error("Unknown DerivNodeType (this should never happen)");
+        }
+
+        derivCache.insert({cacheKey(current), result});
+    }
+
+    return derivCache.at(cacheKey(id));
+}
+
+DerivativeDFA::DerivativeDFA(const ParsedChlex &parsedChlex, const std::vector<KeywordInfo> &keywords)
+{
+    auto &regExps = parsedChlex.getRegExps();
+    std::vector<bool> skipped(regExps.size(), false);
+    for (auto &keyword : keywords)
+        skipped[keyword.rule] = true;
+
+    std::vector<std::pair<int, int>> startDerivs;
+    for (int i = 0; i < regExps.size(); i++)
+    {
+        if (skipped[i])
+            continue;
+
+        int deriv;
+        try
+        {
+            deriv = pool.fromAST(*regExps[i]->ast, regExps[i]->regExp->caseless);
+        }
+        catch (DerivativeDFAFactoryException &e)
+        {
+            e.rule = i;
+            throw;
+        }
+        if (deriv != pool.makeEmpty())
+            startDerivs.push_back({i, deriv});
+    }
+
+    // 起始状态即使不接受任何字符串也需要存在，因此不经过getOrCreateState的死状态检查
+    int rule = -1;
+    for (auto &deriv : startDerivs)
+    {
+        if (pool.get(deriv.second).nullable)
+        {
+            rule = deriv.first;
+            break;
+        }
+    }
+    stateIds.insert({startDerivs, 0});
+    states.push_back(std::move(startDerivs));
+    stateRules.push_back(rule);
+    transitions.emplace_back();
+}
+
+int DerivativeDFA::getOrCreateState(std::vector<std::pair<int, int>> derivs)
+{
+    if (derivs.empty())
+        return -1;
+
+    auto it = stateIds.find(derivs);
+    if (it != stateIds.end())
+        return it->second;
+
+    int rule = -1;
+    for (auto &deriv : derivs)
+    {
+        if (pool.get(deriv.second).nullable)
+        {
+            rule = deriv.first;
+            break;
+        }
+    }
+
+    int id = states.size();
+    stateIds.insert({derivs, id});
+    states.push_back(std::move(derivs));
+    stateRules.push_back(rule);
+    transitions.emplace_back();
+    return id;
+}
+
+void DerivativeDFA::expand(int state)
+{
+    // 导数开头可能读入的字符集合：连接的右侧只有在左侧可以为空时才可能被读入
+    std::vector<int> classOf(256, 0);
+    int classCount = 1;
+    std::unordered_set<int> visited;
+    std::vector<int> nodeStack;
+    for (auto &deriv : states[state])
+        nodeStack.push_back(deriv.second);
+    while (!nodeStack.empty())
+    {
+        auto id = nodeStack.back();
+        nodeStack.pop_back();
+        if (!visited.insert(id).second)
+            continue;
+
+        auto &node = pool.get(id);
+        switch (node.type)
+        {
+        case DerivNodeType::CHARSET:
+        {
+            // 用字符集合细分已有的导数类
+            std::vector<int> split(classCount * 2, -1);
+            int splitCount = 0;
+            for (int byte = 0; byte < 256; byte++)
+            {
+                auto &newClass = split[classOf[byte] * 2 + node.chars[byte]];
+                if (newClass == -1)
+                    newClass = splitCount++;
+                classOf[byte] = newClass;
+            }
+            classCount = splitCount;
+            break;
+        }
+        case DerivNodeType::CONCAT:
+            nodeStack.push_back(node.children[0]);
+            if (pool.get(node.children[0]).nullable)
+                nodeStack.push_back(node.children[1]);
+            break;
+        case DerivNodeType::OR:
+        case DerivNodeType::STAR:
+            for (auto child : node.children)
+                nodeStack.push_back(child);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // 每个导数类用其中的第一个字节求导，0表示ε，不会出现在输入中
+    auto derivs = states[state];
+    std::vector<int> classTargets(classCount, -2);
+    std::vector<int> stateTransitions(256, -1);
+    for (int byte = 1; byte < 256; byte++)
+    {
+        auto &target = classTargets[classOf[byte]];
+        if (target == -2)
+        {
+            std::vector<std::pair<int, int>> nextDerivs;
+            for (auto &deriv : derivs)
+            {
+                auto next = pool.derive(deriv.second, static_cast<char>(byte));
+                if (next != pool.makeEmpty())
+                    nextDerivs.push_back({deriv.first, next});
+            }
+            target = getOrCreateState(std::move(nextDerivs));
+        }
+        stateTransitions[byte] = target;
+    }
+    transitions[state] = std::move(stateTransitions);
+}
+
+int DerivativeDFA::next(int state, char byChar)
+{
+    auto byte = static_cast<unsigned char>(byChar);
+    if (byte == 0) // 0表示ε，不会出现在输入中
+        return -1;
+
+    if (transitions[state].empty())
+        expand(state);
+    return transitions[state][byte];
+}
+
+std::unique_ptr<DFA> DerivativeDFA::toDFA()
+{
+    // 广度优先地计算所有可达状态的全部转移
+    std::vector<bool> visited(states.size(), false);
+    std::queue<int> stateQueue;
+    stateQueue.push(0);
+    visited[0] = true;
+
+    while (!stateQueue.empty())
+    {
+        auto state = stateQueue.front();
+        stateQueue.pop();
+
+        for (int byte = 1; byte < 256; byte++)
+        {
+            auto to = next(state, static_cast<char>(byte));
+            if (to == -1)
+                continue;
+            if (to >= visited.size())
+                visited.resize(to + 1, false);
+            if (!visited[to])
+            {
+                visited[to] = true;
+                stateQueue.push(to);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<DFAState>> dfaStates;
+    for (int i = 0; i < states.size(); i++)
+    {
+        std::unique_ptr<DFAState> dfaState;
+        if (stateRules[i] != -1)
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = stateRules[i];
+            dfaState = std::move(endState);
+        }
+        else
+            dfaState = std::make_unique<DFAState>();
+
+        dfaState->id = i;
+        for (int byte = 1; byte < 256; byte++)
+        {
+            auto to = transitions[i][byte];
+            if (to >= 0)
+                dfaState->paths[static_cast<char>(byte)] = to;
+        }
+        dfaStates.push_back(std::move(dfaState));
+    }
+
+    auto dfa = std::make_unique<DFA>(*dfaStates[0]);
+    for (auto &dfaState : dfaStates)
+    {
+        auto id = dfaState->id;
+        if (stateRules[id] != -1)
+            dfa->getEndStates().insert({id, static_cast<DFAEndState &>(*dfaState)});
+        dfa->getStates().insert({id, std::move(dfaState)});
+    }
+
+    return dfa;
+}
+
+std::unique_ptr<DerivativeDFA> DerivativeDFAFactory::generateLazy(const ParsedChlex &parsedChlex)
+{
+    return std::make_unique<DerivativeDFA>(parsedChlex);
+}
+
+std::unique_ptr<DFA> DerivativeDFAFactory::generate(const ParsedChlex &parsedChlex)
+{
+    DerivativeDFA lazyDFA(parsedChlex);
+    return lazyDFA.toDFA();
+}
+
+std::unique_ptr<DFAChlex> DerivativeDFAFactory::generate(std::shared_ptr<ParsedChlex> parsedChlex)
+{
+    // 提取关键字时过大的有界重复被报告为生成NFA的异常，在导数构造中改为报告为导数构造的异常
+    std::vector<KeywordInfo> keywords;
+    try
+    {
+        keywords = NFAFactory::getInstance().extractKeywords(*parsedChlex);
+    }
+    catch (NFAFactoryException &e)
+    {
+        throw DerivativeDFAFactoryException(e.message, e.rule);
+    }
+
+    // 导数构造不需要NFA，因此NFAChlex中只保存解析后的Chlex和关键字
+    auto nfaChlex = std::make_shared<NFAChlex>();
+    nfaChlex->parsedChlex = parsedChlex;
+    for (auto &keyword : keywords)
+    {
+        if (keyword.hostRule != -1)
+            nfaChlex->keywords.push_back(keyword);
+    }
+
+    auto dfaChlex = std::make_unique<DFAChlex>();
+    dfaChlex->dfa = DerivativeDFA(*parsedChlex, keywords).toDFA();
+    dfaChlex->nfaChlex = nfaChlex;
+    return dfaChlex;
+}
@@ -9,6 +9,13 @@
 
 #include "LexerFactory.hh"
 
+#include "PerfectHash.hh"
+
+#include <algorithm>
+#include <set>
+#include <string_view>
+#include <unordered_map>
+
 using namespace chlex;
 
 LexerFactory LexerFactory::instance;
@@ -16,6 +23,7 @@ LexerFactory LexerFactory::instance;
 static const std::string code1 =
     "#include <iostream>\n"
     "#include <fstream>\n"
+    "#include <string>\n"
     "\n";
 
 static const std::string code2 =
@@ -26,14 +34,18 @@ static const std::string code2 =
 
 static const std::string code3 =
     ";\n"
-    "    int lastEndState = 0;\n"
-    "    int lastEndStateIndex = 0;\n"
+    "    int lastAction = -1;\n"
+    "    int lastEndStateIndex = 0;\n";
+
+static const std::string code3Loop =
     "\n"
     "    char currentChar;\n"
     "\n"
     "    while (in.read(&currentChar, 1))\n"
-    "    {\n"
-    "        lastEndStateIndex++;\n"
+    "    {\n";
+
+static const std::string code3Switch =
+    "        unsigned char byte = currentChar;\n"
     "        switch (state)\n"
     "        {\n";
 
@@ -43,12 +55,54 @@ static const std::string code4 =
     "        }\n"
     "    }\n"
     "\n"
-    "    in.seekg(-lastEndStateIndex, std::ios::cur);\n"
-    "\n"
     "end:\n"
-    "    switch (lastEndState)\n"
+    "    if (lastEndStateIndex != 0)\n"
+    "    {\n"
+    "        in.clear();\n"
+    "        in.seekg(-lastEndStateIndex, std::ios::cur);\n"
+    "    }\n";
+
+static const std::string code4Switch =
+    "\n"
+    "    switch (lastAction)\n"
     "    {\n";
 
+// 关键字模式下额外生成的代码
+static const std::string keywordLexemeDecl =
+    "    std::string lexeme;\n";
+
+static const std::string keywordLexemePush =
+    "        lexeme.push_back(currentChar);\n";
+
+static const std::string keywordLexemeResize =
+    "    lexeme.resize(lexeme.size() - lastEndStateIndex);\n";
+
+static const std::string keywordFind1 =
+    "\n"
+    "int findKeyword(const std::string &lexeme)\n"
+    "{\n"
+    "    unsigned long long hash = 14695981039346656037ULL;\n"
+    "    for (auto c : lexeme)\n"
+    "    {\n"
+    "        hash ^= static_cast<unsigned char>(c);\n"
+    "        hash *= 1099511628211ULL;\n"
+    "    }\n"
+    "\n"
+    "    unsigned long long slot = hash ^ (keywordSeeds[hash % ";
+
+static const std::string keywordFind2 =
+    "] * 0x9E3779B97F4A7C15ULL);\n"
+    "    slot ^= slot >> 33;\n"
+    "    slot *= 0xFF51AFD7ED558CCDULL;\n"
+    "    slot ^= slot >> 33;\n"
+    "    slot %= ";
+
+static const std::string keywordFind3 =
+    ";\n"
+    "\n"
+    "    return lexeme == keywordLexemes[slot] ? keywordRules[slot] : -1;\n"
+    "}\n";
+
 static const std::string code5 =
     "    default:\n"
     "        return -1;\n"
@@ -82,31 +136,198 @@ static const std::string code5 =
     "    return 0;\n"
     "}\n";
 
-std::string LexerFactory::fromState(const DFA &dfa, int stateId)
+/**
+ * @brief 将字符串转换为C++字符串字面量
+ * @param str 字符串
+ * @return 字符串字面量
+ */
+static std::string toCString(const std::string &str)
 {
-    std::string result =
-        "        case " + std::to_string(stateId) + ":\n" +
-        "        {\n"
-        "            switch (currentChar)\n"
-        "            {\n";
+    std::string result = "\"";
+    for (auto c : str)
+    {
+        auto byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if (byte < 32 || byte >= 127)
+        {
+            // 使用三位八进制转义，避免与之后的字符连在一起
+            result += '\\';
+            result += static_cast<char>('0' + (byte >> 6));
+            result += static_cast<char>('0' + ((byte >> 3) & 7));
+            result += static_cast<char>('0' + (byte & 7));
+        }
+        else
+            result += c;
+    }
+    return result + "\"";
+}
+
+std::string LexerFactory::generateKeywordTable(const std::vector<KeywordInfo> &keywords)
+{
+    if (keywords.empty())
+        return "";
 
-    auto &state = dfa.getStates().at(stateId);
-    for (auto &i : state->paths)
+    std::vector<std::string> lexemes;
+    for (auto &keyword : keywords)
+        lexemes.push_back(keyword.lexeme);
+
+    auto hash = PerfectHashFactory::getInstance().generate(lexemes);
+
+    std::string seeds;
+    for (auto seed : hash.seeds)
+        seeds += std::to_string(seed) + ", ";
+
+    std::string slotLexemes;
+    std::string slotRules;
+    for (auto slot : hash.slots)
     {
-        auto byChar = i.first;
-        auto to = i.second;
+        slotLexemes += toCString(keywords[slot].lexeme) + ", ";
+        slotRules += std::to_string(keywords[slot].rule) + ", ";
+    }
 
-        result +=
-            "            case " + std::to_string(byChar) + ":\n" +
-            "                state = " + std::to_string(to) + ";\n" +
-            "                break;\n";
+    return "\n"
+           "static const unsigned int keywordSeeds[] = {" +
+           seeds + "};\n" +
+           "static const char *const keywordLexemes[] = {" + slotLexemes + "};\n" +
+           "static const int keywordRules[] = {" + slotRules + "};\n" +
+           keywordFind1 +
+           std::to_string(hash.seeds.size()) +
+           keywordFind2 +
+           std::to_string(hash.slots.size()) +
+           keywordFind3;
+}
+
+/**
+ * @brief 生成按照字节区间二分查找的判断代码
+ * @param bounds 每一段的第一个字节，第一段从0开始，最后一段到255结束
+ * @param actions 每一段的代码，每行都不含缩进，最后一行总是离开当前状态
+ * @param begin 第一段的序号
+ * @param end 最后一段之后的序号
+ * @param indent 缩进
+ * @return 判断代码
+ */
+static std::string decisionTree(const std::vector<int> &bounds, const std::vector<std::vector<std::string>> &actions, int begin, int end, const std::string &indent)
+{
+    if (end - begin == 1)
+    {
+        std::string result;
+        for (auto &line : actions[begin])
+            result += indent + line + "\n";
+        return result;
+    }
+
+    auto middle = (begin + end) / 2;
+    return indent + "if (byte < " + std::to_string(bounds[middle]) + ")\n" +
+           indent + "{\n" +
+           decisionTree(bounds, actions, begin, middle, indent + "    ") +
+           indent + "}\n" +
+           indent + "else\n" +
+           indent + "{\n" +
+           decisionTree(bounds, actions, middle, end, indent + "    ") +
+           indent + "}\n";
+}
+
+ActionTable LexerFactory::generateActionTable(const MinimizedDFAChlex &chlex)
+{
+    auto &regExps = chlex.getDFAChlex().getNFAChlex().getParsedChlex().getRegExps();
+
+    std::set<int> keywordHosts;
+    for (auto &keyword : chlex.getDFAChlex().getNFAChlex().getKeywords())
+        keywordHosts.insert(keyword.hostRule);
+
+    ActionTable actions;
+    actions.ruleActions.assign(regExps.size(), -1);
+    std::unordered_map<std::string_view, int> codeActions;
+    for (auto &i : chlex.getMinimizedDFA().getEndStates())
+    {
+        auto rule = i.second.get().rule;
+        if (actions.ruleActions[rule] != -1)
+            continue;
+
+        int action = actions.actionRules.size();
+        if (keywordHosts.find(rule) == keywordHosts.end())
+            action = codeActions.insert({regExps[rule]->regExp->code, action}).first->second;
+        if (action == actions.actionRules.size())
+            actions.actionRules.push_back(rule);
+        actions.ruleActions[rule] = action;
+    }
+    return actions;
+}
+
+std::string LexerFactory::fromState(const DFA &dfa, int stateId, const BacktrackInfo &backtrack, const ActionTable &actionTable)
+{
+    auto isEndState = [&](int id) { return dfa.getEndStates().find(id) != dfa.getEndStates().end(); };
+    auto actionOf = [&](int id) { return actionTable.ruleActions[dfa.getEndStates().at(id).get().rule]; };
+
+    // lastEndStateIndex是上一次到达终止状态之后读入的字节数，只有可能需要回退多个字节的状态才需要逐字节计数。
+    // 终止状态中计数总是为0，读入一个字节后为1
+    bool fromEndState = isEndState(stateId);
+
+    std::vector<std::string> failure;
+    if (fromEndState)
+        failure.push_back("lastEndStateIndex = 1;");
+    failure.push_back("goto end;");
+
+    auto transition = [&](int to) {
+        std::vector<std::string> lines{"state = " + std::to_string(to) + ";"};
+        if (isEndState(to))
+        {
+            // 进入起始状态时没有记录它的动作，因此从起始状态出发时总是记录，包括回到起始状态本身的转移
+            bool recorded = fromEndState && stateId != dfa.getStartState().id && actionOf(to) == actionOf(stateId);
+            if (!recorded)
+                lines.push_back("lastAction = " + std::to_string(actionOf(to)) + ";");
+            if (!fromEndState)
+                lines.push_back("lastEndStateIndex = 0;");
+
+            // 最终接受状态之后不可能再匹配，不需要再读入下一个字节
+            if (backtrack.finalAccepts[to])
+            {
+                lines.push_back("goto end;");
+                return lines;
+            }
+        }
+        else if (fromEndState)
+            lines.push_back("lastEndStateIndex = 1;");
+
+        lines.push_back("break;");
+        return lines;
+    };
+
+    // 将0到255划分为若干段，每段是一个转移区间或者区间之间没有转移的部分
+    std::vector<int> bounds;
+    std::vector<std::vector<std::string>> actions;
+    int next = 0;
+    for (auto &range : dfa.getStates().at(stateId)->getRanges())
+    {
+        if (range.lo > next)
+        {
+            bounds.push_back(next);
+            actions.push_back(failure);
+        }
+        bounds.push_back(range.lo);
+        actions.push_back(transition(range.to));
+        next = range.hi + 1;
+    }
+    if (next < 256)
+    {
+        bounds.push_back(next);
+        actions.push_back(failure);
     }
 
+    std::string result =
+        "        case " + std::to_string(stateId) + ":\n" +
+        "        {\n";
+
+    if (backtrack.mayBacktrack[stateId])
+        result +=
+            "            lastEndStateIndex++;\n";
+
     result +=
-        "            default:\n"
-        "                goto end;\n"
-        "            }\n"
-        "            break;\n"
+        decisionTree(bounds, actions, 0, bounds.size(), "            ") +
         "        }\n";
 
     return result;
@@ -122,33 +343,98 @@ std::string LexerFactory::generateCode(const MinimizedDFAChlex &chlex)
         tokenDecl += "const int " + tokens[i] + " = " + std::to_string(i) + ";\n";
     }
 
+    auto &keywords = chlex.getDFAChlex().getNFAChlex().getKeywords();
+    auto keywordDecl = generateKeywordTable(keywords);
+
+    auto backtrack = BacktrackAnalyzer::getInstance().analyze(chlex.getMinimizedDFA());
+    auto actions = generateActionTable(chlex);
+
     std::string stateSwitch;
     for (auto &i : chlex.getMinimizedDFA().getStates())
     {
         auto stateId = i.first;
-        stateSwitch += fromState(chlex.getMinimizedDFA(), stateId);
+        stateSwitch += fromState(chlex.getMinimizedDFA(), stateId, backtrack, actions);
     }
 
+    auto &regExps = chlex.getDFAChlex().getNFAChlex().getParsedChlex().getRegExps();
+
     std::string endSwitch;
-    for (auto &i : chlex.getMinimizedDFA().getEndStates())
+    for (int action = 0; action < actions.actionRules.size(); action++)
     {
-        auto stateId = i.first;
-        DFAEndState &state = i.second;
+        auto rule = actions.actionRules[action];
+        auto &code = regExps[rule]->regExp->code;
+
+        // 如果该动作的正则表达式能匹配某些关键字，则先查询关键字，代码相同的关键字共用一个分支
+        std::vector<std::string> keywordCodes;
+        std::vector<std::string> keywordCases;
+        for (auto &keyword : keywords)
+        {
+            if (keyword.hostRule != rule)
+                continue;
+
+            auto &keywordCode = regExps[keyword.rule]->regExp->code;
+            int index = std::find(keywordCodes.begin(), keywordCodes.end(), keywordCode) - keywordCodes.begin();
+            if (index == keywordCodes.size())
+            {
+                keywordCodes.push_back(keywordCode);
+                keywordCases.emplace_back();
+            }
+            keywordCases[index] += "        case " + std::to_string(keyword.rule) + ":\n";
+        }
+
+        if (keywordCodes.empty())
+        {
+            endSwitch +=
+                "        case " + std::to_string(action) + ":\n" +
+                "        {\n" +
+                code +
+                "        break;\n" +
+                "        }\n";
+            continue;
+        }
+
+        std::string keywordSwitch;
+        for (int i = 0; i < keywordCodes.size(); i++)
+        {
+            keywordSwitch +=
+                keywordCases[i] +
+                "        {\n" +
+                keywordCodes[i] +
+                "        break;\n" +
+                "        }\n";
+        }
+
         endSwitch +=
-            "        case " + std::to_string(stateId) + ":\n" +
+            "        case " + std::to_string(action) + ":\n" +
+            "        {\n" +
+            "        switch (findKeyword(lexeme))\n" +
             "        {\n" +
-            state.code +
+            keywordSwitch +
+            "        default:\n" +
+            "        {\n" +
+            code +
+            "        break;\n" +
+            "        }\n" +
+            "        }\n" +
             "        break;\n" +
             "        }\n";
     }
 
+    bool keywordMode = !keywords.empty();
     return code1 +
            tokenDecl +
+           keywordDecl +
            code2 +
            std::to_string(chlex.getMinimizedDFA().getStartState().id) +
            code3 +
+           (keywordMode ? keywordLexemeDecl : "") +
+           code3Loop +
+           (keywordMode ? keywordLexemePush : "") +
+           code3Switch +
            stateSwitch +
            code4 +
+           (keywordMode ? keywordLexemeResize : "") +
+           code4Switch +
            endSwitch +
            code5;
 }
@@ -0,0 +1,414 @@
+/**
+ * @file LexerImage.cc
+ * @brief LexerImage.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "LexerImage.hh"
+
+#include "ByteClassifier.hh"
+#include "PerfectHash.hh"
+
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chlex;
+
+LexerImageWriter LexerImageWriter::instance;
+
+static const char imageMagic[8] = {'C', 'H', 'L', 'E', 'X', 'I', 'M', 'G'};
+
+/**
+ * @brief 将一段内容追加到映像末尾，追加前先对齐到8字节
+ * @param image 映像
+ * @param data 内容
+ * @param size 内容的长度
+ * @return 内容在映像中的位置
+ */
+static std::uint64_t appendSection(std::string &image, const void *data, std::size_t size)
+{
+    image.resize((image.size() + 7) / 8 * 8, '\0');
+    auto offset = image.size();
+    image.append(static_cast<const char *>(data), size);
+    return offset;
+}
+
+LexerImageContent LexerImageWriter::collect(const MinimizedDFAChlex &chlex)
+{
+    auto &dfa = chlex.getMinimizedDFA();
+    auto &nfaChlex = chlex.getDFAChlex().getNFAChlex();
+    auto &parsedChlex = nfaChlex.getParsedChlex();
+    auto byteClasses = ByteClassifier::getInstance().classify(dfa);
+
+    // 最小化DFA的状态从0开始连续编号，id直接用作下标
+    LexerImageContent content;
+    content.stateCount = dfa.getStates().size();
+    content.classCount = byteClasses.classCount;
+    content.startState = dfa.getStartState().id;
+
+    content.classOf.resize(256);
+    for (int byChar = 0; byChar < 256; byChar++)
+        content.classOf[byChar] = byteClasses.classOf[byChar];
+
+    content.transitions.assign(content.stateCount * content.classCount, -1);
+    content.accepts.assign(content.stateCount, -1);
+    for (auto &i : dfa.getStates())
+    {
+        auto index = i.first;
+        for (int c = 0; c < byteClasses.classCount; c++)
+        {
+            auto it = i.second->paths.find(static_cast<char>(byteClasses.representatives[c]));
+            if (it != i.second->paths.end())
+                content.transitions[index * byteClasses.classCount + c] = it->second;
+        }
+    }
+    for (auto &i : dfa.getEndStates())
+        content.accepts[i.first] = i.second.get().rule;
+
+    for (auto &parsedRegExp : parsedChlex.getRegExps())
+        content.ruleCodes.push_back(parsedRegExp->regExp->code);
+    content.tokens = parsedChlex.getRawChlex().getTokens();
+
+    // 关键字按照完美哈希的槽位排列，与生成的代码中的关键字表相同
+    auto &keywords = nfaChlex.getKeywords();
+    std::vector<std::string> lexemes;
+    for (auto &keyword : keywords)
+        lexemes.push_back(keyword.lexeme);
+    auto hash = PerfectHashFactory::getInstance().generate(lexemes);
+
+    content.keywordSeeds.assign(hash.seeds.begin(), hash.seeds.end());
+    for (auto slot : hash.slots)
+        content.keywords.push_back(keywords[slot]);
+
+    return content;
+}
+
+void LexerImageWriter::compress(LexerImageContent &content, int maxDepth)
+{
+    if (content.compressed)
+        return;
+
+    auto d2fa = D2FAFactory::getInstance().generate(content.stateCount, content.classCount, content.transitions, maxDepth);
+    content.compressed = true;
+    content.transitions = std::move(d2fa.targets);
+    content.defaults = std::move(d2fa.defaults);
+    content.rowStarts = std::move(d2fa.rowStarts);
+    content.labels = std::move(d2fa.labels);
+}
+
+std::string LexerImageWriter::write(const LexerImageContent &content)
+{
+    std::string strings;
+    auto addString = [&](const std::string &string) {
+        LexerImageString result{static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(string.size())};
+        strings += string;
+        return result;
+    };
+
+    std::vector<LexerImageString> rules;
+    for (auto &code : content.ruleCodes)
+        rules.push_back(addString(code));
+
+    std::vector<LexerImageString> tokens;
+    for (auto &token : content.tokens)
+        tokens.push_back(addString(token));
+
+    std::vector<LexerImageKeyword> keywords;
+    for (auto &keyword : content.keywords)
+        keywords.push_back(LexerImageKeyword{addString(keyword.lexeme), keyword.rule, keyword.hostRule});
+
+    if (strings.size() > UINT32_MAX)
+        throw LexerImageException("Strings are too large for the image format");
+
+    LexerImageHeader header{};
+    std::memcpy(header.magic, imageMagic, sizeof(imageMagic));
+    header.endianTag = LexerImageHeader::currentEndianTag;
+    header.version = LexerImageHeader::currentVersion;
+    header.stateCount = content.stateCount;
+    header.classCount = content.classCount;
+    header.startState = content.startState;
+    header.ruleCount = rules.size();
+    header.tokenCount = tokens.size();
+    header.keywordSeedCount = content.keywordSeeds.size();
+    header.keywordCount = keywords.size();
+    header.flags = content.compressed ? LexerImageHeader::compressedFlag : 0;
+
+    std::string image(sizeof(LexerImageHeader), '\0');
+    header.classOffset = appendSection(image, content.classOf.data(), content.classOf.size());
+    header.transitionOffset = appendSection(image, content.transitions.data(), content.transitions.size() * sizeof(std::int32_t));
+    if (content.compressed)
+    {
+        header.transitionCount = content.transitions.size();
+        header.defaultOffset = appendSection(image, content.defaults.data(), content.defaults.size() * sizeof(std::int32_t));
+        header.rowOffset = appendSection(image, content.rowStarts.data(), content.rowStarts.size() * sizeof(std::uint32_t));
+        header.labelOffset = appendSection(image, content.labels.data(), content.labels.size());
+    }
+    header.acceptOffset = appendSection(image, content.accepts.data(), content.accepts.size() * sizeof(std::int32_t));
+    header.ruleOffset = appendSection(image, rules.data(), rules.size() * sizeof(LexerImageString));
+    header.tokenOffset = appendSection(image, tokens.data(), tokens.size() * sizeof(LexerImageString));
+    header.keywordSeedOffset = appendSection(image, content.keywordSeeds.data(), content.keywordSeeds.size() * sizeof(std::uint32_t));
+    header.keywordOffset = appendSection(image, keywords.data(), keywords.size() * sizeof(LexerImageKeyword));
+    header.stringOffset = appendSection(image, strings.data(), strings.size());
+    header.stringSize = strings.size();
+    header.totalSize = image.size();
+
+    std::memcpy(&image[0], &header, sizeof(header));
+    return image;
+}
+
+void LexerImageWriter::write(const MinimizedDFAChlex &chlex, const std::string &filename)
+{
+    auto image = write(chlex);
+
+    std::ofstream out(filename, std::ios::binary);
+    if (!out)
+        throw LexerImageException("Cannot open file");
+
+    out.write(image.data(), image.size());
+    if (!out)
+        throw LexerImageException("Cannot write file");
+}
+
+MappedLexer::MappedLexer(const std::string &filename)
+{
+    auto fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw LexerImageException("Cannot open file");
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1 || fileStat.st_size == 0)
+    {
+        close(fd);
+        throw LexerImageException("Cannot read file");
+    }
+
+    // 映射建立后就不再需要文件描述符
+    auto address = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+        throw LexerImageException("Cannot map file");
+
+    data = static_cast<const unsigned char *>(address);
+    size = fileStat.st_size;
+    mapped = true;
+
+    try
+    {
+        attach();
+    }
+    catch (...)
+    {
+        munmap(const_cast<unsigned char *>(data), size);
+        throw;
+    }
+}
+
+MappedLexer::MappedLexer(const void *data, std::size_t size) : data(static_cast<const unsigned char *>(data)), size(size)
+{
+    if (reinterpret_cast<std::uintptr_t>(data) % 8 != 0)
+        throw LexerImageException("Image is not aligned");
+
+    attach();
+}
+
+MappedLexer::MappedLexer(const LexerImageContent &content)
+{
+    auto image = LexerImageWriter::getInstance().write(content);
+    ownedImage.resize((image.size() + 7) / 8);
+    std::memcpy(ownedImage.data(), image.data(), image.size());
+    data = reinterpret_cast<const unsigned char *>(ownedImage.data());
+    size = image.size();
+
+    attach();
+}
+
+MappedLexer::~MappedLexer()
+{
+    if (mapped)
+        munmap(const_cast<unsigned char *>(data), size);
+}
+
+void MappedLexer::attach()
+{
+    if (size < sizeof(LexerImageHeader))
+        throw LexerImageException("Image is too small");
+
+    header = reinterpret_cast<const LexerImageHeader *>(data);
+    if (std::memcmp(header->magic, imageMagic, sizeof(imageMagic)) != 0)
+        throw LexerImageException("Not a lexer image");
+    if (header->endianTag != LexerImageHeader::currentEndianTag)
+        throw LexerImageException("Image was written with a different byte order");
+    if (header->version != LexerImageHeader::currentVersion)
+        throw LexerImageException("Unsupported image version");
+    if (header->totalSize > size)
+        throw LexerImageException("Image is truncated");
+
+    // 检查每一段都在映像之内且是对齐的
+    auto section = [&](std::uint64_t offset, std::uint64_t count, std::uint64_t elementSize) {
+        if (offset % 8 != 0 || offset > header->totalSize || count > (header->totalSize - offset) / elementSize)
+            throw LexerImageException("Image is corrupted");
+        return data + offset;
+    };
+
+    if (header->classCount == 0 || header->classCount > 256 || header->startState >= header->stateCount)
+        throw LexerImageException("Image is corrupted");
+
+    classOf = section(header->classOffset, 256, sizeof(std::uint8_t));
+    if (header->flags & LexerImageHeader::compressedFlag)
+    {
+        transitions = reinterpret_cast<const std::int32_t *>(section(header->transitionOffset, header->transitionCount, sizeof(std::int32_t)));
+        defaults = reinterpret_cast<const std::int32_t *>(section(header->defaultOffset, header->stateCount, sizeof(std::int32_t)));
+        rowStarts = reinterpret_cast<const std::uint32_t *>(section(header->rowOffset, static_cast<std::uint64_t>(header->stateCount) + 1, sizeof(std::uint32_t)));
+        labels = reinterpret_cast<const std::uint8_t *>(section(header->labelOffset, header->transitionCount, sizeof(std::uint8_t)));
+    }
+    else
+        transitions = reinterpret_cast<const std::int32_t *>(section(header->transitionOffset, static_cast<std::uint64_t>(header->stateCount) * header->classCount, sizeof(std::int32_t)));
+    accepts = reinterpret_cast<const std::int32_t *>(section(header->acceptOffset, header->stateCount, sizeof(std::int32_t)));
+    rules = reinterpret_cast<const LexerImageString *>(section(header->ruleOffset, header->ruleCount, sizeof(LexerImageString)));
+    tokens = reinterpret_cast<const LexerImageString *>(section(header->tokenOffset, header->tokenCount, sizeof(LexerImageString)));
+    keywordSeeds = reinterpret_cast<const std::uint32_t *>(section(header->keywordSeedOffset, header->keywordSeedCount, sizeof(std::uint32_t)));
+    keywords = reinterpret_cast<const LexerImageKeyword *>(section(header->keywordOffset, header->keywordCount, sizeof(LexerImageKeyword)));
+    strings = reinterpret_cast<const char *>(section(header->stringOffset, header->stringSize, 1));
+}
+
+void MappedLexer::validate() const
+{
+    auto check = [](bool condition) {
+        if (!condition)
+            throw LexerImageException("Image is corrupted");
+    };
+    auto isState = [&](std::int32_t state) { return state >= -1 && state < static_cast<std::int64_t>(header->stateCount); };
+    auto isRule = [&](std::int32_t rule) { return rule >= 0 && rule < static_cast<std::int64_t>(header->ruleCount); };
+    auto isString = [&](const LexerImageString &string) { return static_cast<std::uint64_t>(string.offset) + string.length <= header->stringSize; };
+
+    for (int byte = 0; byte < 256; byte++)
+        check(classOf[byte] < header->classCount);
+
+    if (defaults != nullptr)
+    {
+        check(rowStarts[0] == 0 && rowStarts[header->stateCount] == header->transitionCount);
+        for (std::uint32_t state = 0; state < header->stateCount; state++)
+        {
+            check(rowStarts[state] <= rowStarts[state + 1] && isState(defaults[state]));
+            for (auto i = rowStarts[state]; i < rowStarts[state + 1]; i++)
+                check(labels[i] < header->classCount && (i == rowStarts[state] || labels[i - 1] < labels[i]) && isState(transitions[i]));
+        }
+
+        // 沿默认状态前进时，0表示尚未访问，1表示在当前的链上，2表示已经确认可以到达没有默认状态的状态
+        std::vector<std::uint8_t> marks(header->stateCount, 0);
+        std::vector<std::uint32_t> chain;
+        for (std::uint32_t state = 0; state < header->stateCount; state++)
+        {
+            std::int32_t current = state;
+            while (current != -1 && marks[current] == 0)
+            {
+                marks[current] = 1;
+                chain.push_back(current);
+                current = defaults[current];
+            }
+            check(current == -1 || marks[current] == 2);
+            for (auto visited : chain)
+                marks[visited] = 2;
+            chain.clear();
+        }
+    }
+    else
+    {
+        auto count = static_cast<std::size_t>(header->stateCount) * header->classCount;
+        for (std::size_t i = 0; i < count; i++)
+            check(isState(transitions[i]));
+    }
+
+    for (std::uint32_t state = 0; state < header->stateCount; state++)
+        check(accepts[state] == -1 || isRule(accepts[state]));
+    for (std::uint32_t i = 0; i < header->ruleCount; i++)
+        check(isString(rules[i]));
+    for (std::uint32_t i = 0; i < header->tokenCount; i++)
+        check(isString(tokens[i]));
+
+    check(header->keywordCount == 0 || header->keywordSeedCount > 0);
+    for (std::uint32_t i = 0; i < header->keywordCount; i++)
+        check(isString(keywords[i].lexeme) && isRule(keywords[i].rule) && isRule(keywords[i].hostRule));
+}
+
+LexerImageContent MappedLexer::toContent() const
+{
+    LexerImageContent content;
+    content.stateCount = header->stateCount;
+    content.classCount = header->classCount;
+    content.startState = header->startState;
+    content.classOf.assign(classOf, classOf + 256);
+    if (defaults != nullptr)
+    {
+        content.compressed = true;
+        content.transitions.assign(transitions, transitions + header->transitionCount);
+        content.defaults.assign(defaults, defaults + header->stateCount);
+        content.rowStarts.assign(rowStarts, rowStarts + header->stateCount + 1);
+        content.labels.assign(labels, labels + header->transitionCount);
+    }
+    else
+        content.transitions.assign(transitions, transitions + static_cast<std::size_t>(header->stateCount) * header->classCount);
+    content.accepts.assign(accepts, accepts + header->stateCount);
+
+    for (std::uint32_t i = 0; i < header->ruleCount; i++)
+        content.ruleCodes.emplace_back(toStringView(rules[i]));
+    for (std::uint32_t i = 0; i < header->tokenCount; i++)
+        content.tokens.emplace_back(toStringView(tokens[i]));
+
+    content.keywordSeeds.assign(keywordSeeds, keywordSeeds + header->keywordSeedCount);
+    for (std::uint32_t i = 0; i < header->keywordCount; i++)
+        content.keywords.push_back(KeywordInfo{std::string(toStringView(keywords[i].lexeme)), keywords[i].rule, keywords[i].hostRule});
+
+    return content;
+}
+
+int MappedLexer::findKeyword(std::string_view lexeme, int hostRule) const
+{
+    if (header->keywordCount == 0)
+        return -1;
+
+    auto hash = PerfectHash::hash(lexeme.data(), lexeme.size());
+    auto &keyword = keywords[PerfectHash::slotOf(hash, keywordSeeds[hash % header->keywordSeedCount], header->keywordCount)];
+    if (keyword.hostRule != hostRule || toStringView(keyword.lexeme) != lexeme)
+        return -1;
+
+    return keyword.rule;
+}
+
+std::size_t MappedLexer::match(std::string_view input, int &rule) const
+{
+    // 与生成的词法分析程序相同，记录最后一次经过的终止状态
+    std::size_t length = 0;
+    rule = -1;
+
+    int state = header->startState;
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        state = next(state, static_cast<unsigned char>(input[i]));
+        if (state == -1)
+            break;
+
+        if (accepts[state] != -1)
+        {
+            length = i + 1;
+            rule = accepts[state];
+        }
+    }
+
+    if (rule != -1)
+    {
+        auto keywordRule = findKeyword(input.substr(0, length), rule);
+        if (keywordRule != -1)
+            rule = keywordRule;
+    }
+
+    return length;
+}
@@ -10,7 +10,10 @@
 #include "NFAFactory.hh"
 
 #include "RegExpParser.hh"
+#include "DerivativeDFAFactory.hh"
+#include "ThreadPool.hh"
 
+#include <cctype>
 #include <stdexcept>
 
 using namespace chlex;
@@ -30,12 +33,67 @@ std::unique_ptr<NFA> NFAFactory::fromChar(char c, IDAllocator &idAllocator)
     connect(*start, *end, c);
 
     auto nfa = std::make_unique<NFA>(*start);
+    nfa->getEndStates().insert({end->id, *end});
+    nfa->getStates().insert({start->id, std::move(start)});
+    nfa->getStates().insert({end->id, std::move(end)});
+
+    return nfa;
+}
+
+std::unique_ptr<NFA> NFAFactory::fromCharSet(const std::bitset<256> &chars, IDAllocator &idAllocator)
+{
+    auto start = std::make_unique<NFAState>(NFAState{idAllocator.nextID()});
+    auto end = std::make_unique<NFAEndState>(NFAEndState{idAllocator.nextID()});
+
+    for (int c = 1; c < 256; c++) // 0表示ε，不能作为字符
+        if (chars.test(c))
+            connect(*start, *end, static_cast<char>(c));
+
+    auto nfa = std::make_unique<NFA>(*start);
+    nfa->getEndStates().insert({end->id, *end});
     nfa->getStates().insert({start->id, std::move(start)});
     nfa->getStates().insert({end->id, std::move(end)});
 
     return nfa;
 }
 
+std::unique_ptr<NFA> NFAFactory::clone(const NFA &nfa, IDAllocator &idAllocator)
+{
+    // 按照id顺序创建新状态，使复制得到的片段中状态的相对顺序不变
+    std::map<int, NFAState *> newStateOf;
+    std::vector<std::unique_ptr<NFAState>> newStates;
+    for (auto &i : nfa.getStates())
+    {
+        if (nfa.getEndStates().find(i.first) != nfa.getEndStates().end())
+            newStates.push_back(std::make_unique<NFAEndState>(NFAEndState{idAllocator.nextID()}));
+        else
+            newStates.push_back(std::make_unique<NFAState>(NFAState{idAllocator.nextID()}));
+        newStateOf[i.first] = newStates.back().get();
+    }
+
+    for (auto &i : nfa.getStates())
+        for (auto &path : i.second->paths)
+            connect(*newStateOf.at(i.first), *newStateOf.at(path->to.id), path->byChar);
+
+    auto newNFA = std::make_unique<NFA>(*newStateOf.at(nfa.getStartState().id));
+    auto &endState = static_cast<NFAEndState &>(*newStateOf.at(nfa.getEndStates().begin()->first));
+    newNFA->getEndStates().insert({endState.id, endState});
+    for (auto &state : newStates)
+        newNFA->getStates().insert({state->id, std::move(state)});
+
+    return newNFA;
+}
+
+void NFAFactory::mergeStates(NFA &nfa, NFA &left, NFA &right)
+{
+    // 总是把较小的状态表并入较大的状态表，使深层嵌套的表达式不会反复复制所有状态
+    auto &larger = left.getStates().size() >= right.getStates().size() ? left : right;
+    auto &smaller = &larger == &left ? right : left;
+
+    nfa.getStates() = std::move(larger.getStates());
+    nfa.getStates().merge(smaller.getStates());
+}
+
 std::unique_ptr<NFA> NFAFactory::fromOr(std::unique_ptr<NFA> left, std::unique_ptr<NFA> right, IDAllocator &idAllocator)
 {
     auto start = std::make_unique<NFAState>(NFAState{idAllocator.nextID()});
@@ -47,16 +105,11 @@ std::unique_ptr<NFA> NFAFactory::fromOr(std::unique_ptr<NFA> left, std::unique_p
     connect(right->getEndStates().begin()->second, *end, 0);
 
     auto nfa = std::make_unique<NFA>(*start);
+    mergeStates(*nfa, *left, *right);
     nfa->getEndStates().insert({end->id, *end});
     nfa->getStates().insert({start->id, std::move(start)});
     nfa->getStates().insert({end->id, std::move(end)});
 
-    for (auto &state : left->getStates())
-        nfa->getStates().insert(std::move(state));
-
-    for (auto &state : right->getStates())
-        nfa->getStates().insert(std::move(state));
-
     return nfa;
 }
 
@@ -68,14 +121,12 @@ std::unique_ptr<NFA> NFAFactory::fromConcat(std::unique_ptr<NFA> left, std::uniq
     {
         auto &endState = i.second;
         connect(endState, right->getStartState(), 0);
-        nfa->getEndStates().insert(i);
     }
 
-    for (auto &state : left->getStates())
-        nfa->getStates().insert(std::move(state));
+    for (auto &i : right->getEndStates())
+        nfa->getEndStates().insert(i);
 
-    for (auto &state : right->getStates())
-        nfa->getStates().insert(std::move(state));
+    mergeStates(*nfa, *left, *right);
 
     return nfa;
 }
@@ -91,13 +142,11 @@ std::unique_ptr<NFA> NFAFactory::fromClosure(std::unique_ptr<NFA> nfa, IDAllocat
     connect(nfa->getEndStates().begin()->second, nfa->getStartState(), 0);
 
     auto newNFA = std::make_unique<NFA>(*start);
+    newNFA->getStates() = std::move(nfa->getStates());
     newNFA->getEndStates().insert({end->id, *end});
     newNFA->getStates().insert({start->id, std::move(start)});
     newNFA->getStates().insert({end->id, std::move(end)});
 
-    for (auto &state : nfa->getStates())
-        newNFA->getStates().insert(std::move(state));
-
     return newNFA;
 }
 
@@ -111,13 +160,11 @@ std::unique_ptr<NFA> NFAFactory::fromPlus(std::unique_ptr<NFA> nfa, IDAllocator
     connect(nfa->getEndStates().begin()->second, nfa->getStartState(), 0);
 
     auto newNFA = std::make_unique<NFA>(*start);
+    newNFA->getStates() = std::move(nfa->getStates());
     newNFA->getEndStates().insert({end->id, *end});
     newNFA->getStates().insert({start->id, std::move(start)});
     newNFA->getStates().insert({end->id, std::move(end)});
 
-    for (auto &state : nfa->getStates())
-        newNFA->getStates().insert(std::move(state));
-
     return newNFA;
 }
 
@@ -131,71 +178,412 @@ std::unique_ptr<NFA> NFAFactory::fromQuestion(std::unique_ptr<NFA> nfa, IDAlloca
     connect(*start, *end, 0);
 
     auto newNFA = std::make_unique<NFA>(*start);
+    newNFA->getStates() = std::move(nfa->getStates());
     newNFA->getEndStates().insert({end->id, *end});
     newNFA->getStates().insert({start->id, std::move(start)});
     newNFA->getStates().insert({end->id, std::move(end)});
 
-    for (auto &state : nfa->getStates())
-        newNFA->getStates().insert(std::move(state));
+    return newNFA;
+}
+
+std::unique_ptr<NFA> NFAFactory::fromRepeat(std::unique_ptr<NFA> nfa, int min, int max, IDAllocator &idAllocator)
+{
+    // 在复制之前检查状态数，使过大的重复立即失败
+    std::size_t copies = max == -1 ? min + 1 : max;
+    if (copies > 0 && nfa->getStates().size() > maxRepeatStates / copies)
+        throw NFAFactoryException("Repetition generates too many NFA states", -1);
+
+    auto start = std::make_unique<NFAState>(NFAState{idAllocator.nextID()});
+    auto end = std::make_unique<NFAEndState>(NFAEndState{idAllocator.nextID()});
+
+    // 依次接上各个副本，最后一个副本直接使用操作数本身
+    std::vector<std::unique_ptr<NFA>> parts;
+    for (std::size_t i = 1; i < copies; i++)
+        parts.push_back(clone(*nfa, idAllocator));
+    if (copies > 0)
+        parts.push_back(std::move(nfa));
+
+    auto newNFA = std::make_unique<NFA>(*start);
+    NFAState *last = start.get();
+    for (int i = 0; i < parts.size(); i++)
+    {
+        auto &part = *parts[i];
+        auto &partEnd = part.getEndStates().begin()->second.get();
+        connect(*last, part.getStartState(), 0);
+        if (i >= min) // 可选的副本，可以直接跳到终止状态
+            connect(*last, *end, 0);
+        if (max == -1 && i == parts.size() - 1) // 没有上限，最后一个副本可以重复
+            connect(partEnd, part.getStartState(), 0);
+        last = &partEnd;
+
+        newNFA->getStates().merge(part.getStates());
+    }
+    connect(*last, *end, 0);
+
+    newNFA->getEndStates().insert({end->id, *end});
+    newNFA->getStates().insert({start->id, std::move(start)});
+    newNFA->getStates().insert({end->id, std::move(end)});
 
     return newNFA;
 }
 
-std::unique_ptr<NFA> NFAFactory::generate(const RENode &ast, IDAllocator &idAllocator)
+std::unique_ptr<NFA> NFAFactory::generate(const RENode &ast, IDAllocator &idAllocator, const SharedNFAs &sharedNFAs, bool foldCase)
 {
-    switch (ast.type)
+    // 用显式的栈代替递归，按后序遍历语法树：节点第一次出栈时压入它的子节点，第二次出栈时组装子节点的NFA
+    std::vector<std::pair<const RENode *, bool>> nodeStack{{&ast, false}};
+    std::vector<std::unique_ptr<NFA>> nfaStack;
+
+    while (!nodeStack.empty())
     {
-    case RENodeType::CHAR:
+        auto node = nodeStack.back().first;
+        auto childrenDone = nodeStack.back().second;
+        nodeStack.pop_back();
+
+        auto shared = sharedNFAs.find(node);
+        if (shared != sharedNFAs.end())
+        {
+            nfaStack.push_back(clone(*shared->second, idAllocator));
+            continue;
+        }
+
+        switch (node->type)
+        {
+        case RENodeType::CHAR:
+        {
+            const auto &charNode = static_cast<const CharNode &>(*node);
+            if (foldCase && std::isalpha(static_cast<unsigned char>(charNode.value)))
+            {
+                std::bitset<256> chars;
+                chars.set(static_cast<unsigned char>(charNode.value));
+                nfaStack.push_back(fromCharSet(CharSetNode::foldCase(chars), idAllocator));
+            }
+            else
+                nfaStack.push_back(fromChar(charNode.value, idAllocator));
+            break;
+        }
+        case RENodeType::CHARSET:
+        {
+            const auto &charSetNode = static_cast<const CharSetNode &>(*node);
+            nfaStack.push_back(fromCharSet(foldCase ? CharSetNode::foldCase(charSetNode.chars) : charSetNode.chars, idAllocator));
+            break;
+        }
+        case RENodeType::OR:
+        case RENodeType::CONCAT:
+        {
+            const auto &biOpNode = static_cast<const BiOpNode &>(*node);
+            if (!childrenDone)
+            {
+                // 右子节点后入栈，先生成左子节点，使状态id的顺序与递归生成时相同
+                nodeStack.push_back({node, true});
+                nodeStack.push_back({biOpNode.right, false});
+                nodeStack.push_back({biOpNode.left, false});
+                break;
+            }
+
+            auto rightNFA = std::move(nfaStack.back());
+            nfaStack.pop_back();
+            auto leftNFA = std::move(nfaStack.back());
+            nfaStack.pop_back();
+
+            if (node->type == RENodeType::OR)
+                nfaStack.push_back(fromOr(std::move(leftNFA), std::move(rightNFA), idAllocator));
+            else
+                nfaStack.push_back(fromConcat(std::move(leftNFA), std::move(rightNFA), idAllocator));
+            break;
+        }
+        case RENodeType::STAR:
+        case RENodeType::PLUS:
+        case RENodeType::QUESTION:
+        {
+            const auto &monoOpNode = static_cast<const MonoOpNode &>(*node);
+            if (!childrenDone)
+            {
+                nodeStack.push_back({node, true});
+                nodeStack.push_back({monoOpNode.child, false});
+                break;
+            }
+
+            auto childNFA = std::move(nfaStack.back());
+            nfaStack.pop_back();
+
+            if (node->type == RENodeType::STAR)
+                nfaStack.push_back(fromClosure(std::move(childNFA), idAllocator));
+            else if (node->type == RENodeType::PLUS)
+                nfaStack.push_back(fromPlus(std::move(childNFA), idAllocator));
+            else
+                nfaStack.push_back(fromQuestion(std::move(childNFA), idAllocator));
+            break;
+        }
+        case RENodeType::REPEAT:
+        {
+            const auto &repeatNode = static_cast<const RepeatNode &>(*node);
+            if (!childrenDone)
+            {
+                nodeStack.push_back({node, true});
+                nodeStack.push_back({repeatNode.child, false});
+                break;
+            }
+
+            auto childNFA = std::move(nfaStack.back());
+            nfaStack.pop_back();
+            nfaStack.push_back(fromRepeat(std::move(childNFA), repeatNode.min, repeatNode.max, idAllocator));
+            break;
+        }
+        default:
+            throw std::runtime_error("Unknown RENodeType (this should never happen)");
+        }
+    }
+
+    return std::move(nfaStack.back());
+}
+
+SharedNFAs NFAFactory::generateShared(const std::vector<const RENode *> &roots, const std::vector<int> &rules, bool foldCase)
+{
+    // 统计每个节点被引用的次数，每个节点的子节点只在第一次访问时统计
+    // 按顺序逐个遍历根节点，同时记录第一个引用每个节点的根节点
+    std::map<const RENode *, int> refCounts;
+    std::map<const RENode *, int> firstRoots;
+    std::vector<const RENode *> order; // 每个节点都排在它的子节点之后
+    std::vector<std::pair<const RENode *, bool>> stack;
+    for (int i = 0; i < roots.size(); i++)
     {
-        const auto &charNode = static_cast<const CharNode &>(ast);
-        return fromChar(charNode.value, idAllocator);
+        stack.push_back({roots[i], false});
+        while (!stack.empty())
+        {
+            auto current = stack.back();
+            stack.pop_back();
+
+            if (current.second)
+            {
+                order.push_back(current.first);
+                continue;
+            }
+
+            if (refCounts[current.first]++ > 0)
+                continue;
+
+            firstRoots[current.first] = i;
+            stack.push_back({current.first, true});
+            switch (current.first->type)
+            {
+            case RENodeType::OR:
+            case RENodeType::CONCAT:
+                stack.push_back({static_cast<const BiOpNode *>(current.first)->right, false});
+                stack.push_back({static_cast<const BiOpNode *>(current.first)->left, false});
+                break;
+            case RENodeType::STAR:
+            case RENodeType::PLUS:
+            case RENodeType::QUESTION:
+            case RENodeType::REPEAT:
+                stack.push_back({static_cast<const MonoOpNode *>(current.first)->child, false});
+                break;
+            default:
+                break;
+            }
+        }
     }
-    case RENodeType::OR:
+
+    // 按照子节点在前的顺序生成，使得生成较大的片段时可以复制其中较小的共享片段
+    SharedNFAs sharedNFAs;
+    for (auto node : order)
     {
-        const auto &orNode = static_cast<const BiOpNode &>(ast);
-        auto leftNFA = generate(*orNode.left, idAllocator);
-        auto rightNFA = generate(*orNode.right, idAllocator);
-        return fromOr(std::move(leftNFA), std::move(rightNFA), idAllocator);
+        if (refCounts[node] < 2 || node->type == RENodeType::CHAR || node->type == RENodeType::CHARSET)
+            continue;
+
+        IDAllocator sharedIDAllocator;
+        try
+        {
+            sharedNFAs[node] = generate(*node, sharedIDAllocator, sharedNFAs, foldCase);
+        }
+        catch (NFAFactoryException &e)
+        {
+            e.rule = rules[firstRoots[node]];
+            throw;
+        }
     }
-    case RENodeType::CONCAT:
+
+    return sharedNFAs;
+}
+
+std::unique_ptr<NFA> NFAFactory::generate(const ParsedRegExp &parsedRegExp, IDAllocator &idAllocator)
+{
+    return generate(parsedRegExp, idAllocator, SharedNFAs());
+}
+
+std::unique_ptr<NFA> NFAFactory::generate(const ParsedRegExp &parsedRegExp, IDAllocator &idAllocator, const SharedNFAs &sharedNFAs)
+{
+    return generate(*parsedRegExp.ast, idAllocator, sharedNFAs, parsedRegExp.regExp->caseless);
+}
+
+bool NFAFactory::toLiteral(const RENode &ast, std::string &literal)
+{
+    literal.clear();
+
+    // 按中序遍历连接节点，依次取出所有字符
+    std::vector<const RENode *> nodeStack{&ast};
+    while (!nodeStack.empty())
     {
-        const auto &concatNode = static_cast<const BiOpNode &>(ast);
-        auto leftNFA = generate(*concatNode.left, idAllocator);
-        auto rightNFA = generate(*concatNode.right, idAllocator);
-        return fromConcat(std::move(leftNFA), std::move(rightNFA), idAllocator);
+        auto node = nodeStack.back();
+        nodeStack.pop_back();
+
+        switch (node->type)
+        {
+        case RENodeType::CHAR:
+            literal.push_back(static_cast<const CharNode *>(node)->value);
+            break;
+        case RENodeType::CONCAT:
+        {
+            auto concatNode = static_cast<const BiOpNode *>(node);
+            nodeStack.push_back(concatNode->right);
+            nodeStack.push_back(concatNode->left);
+            break;
+        }
+        default:
+            return false;
+        }
     }
-    case RENodeType::STAR:
+
+    return true;
+}
+
+std::unique_ptr<NFA> NFAFactory::fromLiteralTrie(const std::vector<LiteralTrieNode> &trie, IDAllocator &idAllocator, bool foldCase)
+{
+    std::vector<std::unique_ptr<NFAState>> states;
+    for (auto &node : trie)
     {
-        const auto &starNode = static_cast<const MonoOpNode &>(ast);
-        auto childNFA = generate(*starNode.child, idAllocator);
-        return fromClosure(std::move(childNFA), idAllocator);
+        if (node.endId != -1)
+        {
+            auto endState = std::make_unique<NFAEndState>(NFAEndState{static_cast<unsigned int>(node.endId)});
+            endState->rule = node.rule;
+            states.push_back(std::move(endState));
+        }
+        else
+            states.push_back(std::make_unique<NFAState>(NFAState{idAllocator.nextID()}));
     }
-    case RENodeType::PLUS:
+
+    for (int i = 0; i < trie.size(); i++)
     {
-        const auto &plusNode = static_cast<const MonoOpNode &>(ast);
-        auto childNFA = generate(*plusNode.child, idAllocator);
-        return fromPlus(std::move(childNFA), idAllocator);
+        for (auto &child : trie[i].children)
+        {
+            connect(*states[i], *states[child.second], child.first);
+            if (foldCase && std::islower(static_cast<unsigned char>(child.first)))
+                connect(*states[i], *states[child.second], std::toupper(static_cast<unsigned char>(child.first)));
+        }
     }
-    case RENodeType::QUESTION:
+
+    auto nfa = std::make_unique<NFA>(*states[0]);
+    for (int i = 0; i < trie.size(); i++)
     {
-        const auto &questionNode = static_cast<const MonoOpNode &>(ast);
-        auto childNFA = generate(*questionNode.child, idAllocator);
-        return fromQuestion(std::move(childNFA), idAllocator);
+        if (trie[i].endId != -1)
+            nfa->getEndStates().insert({trie[i].endId, static_cast<NFAEndState &>(*states[i])});
+        nfa->getStates().insert({states[i]->id, std::move(states[i])});
     }
-    default:
-        throw std::runtime_error("Unknown RENodeType (this should never happen)");
+
+    return nfa;
+}
+
+std::vector<KeywordInfo> NFAFactory::extractKeywords(const ParsedChlex &parsedChlex, const std::vector<std::string> &literals)
+{
+    auto &regExps = parsedChlex.getRegExps();
+
+    // 关键字之外的正则表达式按照优先级排列，查找宿主时不需要逐个跳过关键字
+    std::vector<bool> isCandidate(regExps.size());
+    std::vector<int> candidates;
+    for (int i = 0; i < regExps.size(); i++)
+    {
+        isCandidate[i] = !(regExps[i]->regExp->keyword && !regExps[i]->regExp->caseless && !literals[i].empty());
+        if (isCandidate[i])
+            candidates.push_back(i);
     }
+
+    // 用导数判断一个正则表达式能否匹配关键字，这样不需要先生成NFA
+    DerivNodePool pool;
+    std::vector<int> nodes(regExps.size(), -1);
+
+    std::vector<KeywordInfo> keywords;
+    std::set<std::string> lexemes;
+    for (int i = 0; i < regExps.size(); i++)
+    {
+        if (isCandidate[i])
+            continue;
+
+        auto &lexeme = literals[i];
+        int hostRule = -1;
+        for (int k = 0; k < candidates.size() && hostRule == -1; k++)
+        {
+            auto j = candidates[k];
+
+            // 过大的有界重复之后生成NFA时同样会失败，因此直接报告为生成NFA的异常
+            if (nodes[j] == -1)
+            {
+                try
+                {
+                    nodes[j] = pool.fromAST(*regExps[j]->ast, regExps[j]->regExp->caseless);
+                }
+                catch (DerivativeDFAFactoryException &e)
+                {
+                    throw NFAFactoryException(e.message, j);
+                }
+            }
+
+            auto node = nodes[j];
+            for (auto c : lexeme)
+                node = pool.derive(node, c);
+
+            if (pool.get(node).nullable)
+                hostRule = j;
+        }
+
+        // 没有正则表达式能匹配，或者匹配它的正则表达式优先级更高，此时仍然编译到NFA中
+        if (hostRule == -1 || hostRule < i)
+            continue;
+
+        // 相同的关键字只有第一个有效，之后的直接丢弃
+        if (lexemes.insert(lexeme).second)
+            keywords.push_back(KeywordInfo{lexeme, i, hostRule});
+        else
+            keywords.push_back(KeywordInfo{"", i, -1});
+    }
+
+    return keywords;
 }
 
-std::unique_ptr<NFA> NFAFactory::generate(const ParsedRegExp &parsedRegExp, IDAllocator &idAllocator)
+std::vector<KeywordInfo> NFAFactory::extractKeywords(const ParsedChlex &parsedChlex)
 {
-    auto nfa = generate(*parsedRegExp.ast, idAllocator);
-    auto &endState = static_cast<NFAEndState &>(nfa->getEndStates().begin()->second);
-    endState.code = parsedRegExp.regExp->code;
-    return nfa;
+    auto &regExps = parsedChlex.getRegExps();
+    std::vector<std::string> literals(regExps.size());
+    for (int i = 0; i < regExps.size(); i++)
+        if (!toLiteral(*regExps[i]->ast, literals[i]))
+            literals[i].clear();
+    return extractKeywords(parsedChlex, literals);
+}
+
+void NFAFactory::renumber(NFA &nfa, IDAllocator &idAllocator)
+{
+    std::map<int, std::unique_ptr<NFAState>> states;
+    std::map<int, std::reference_wrapper<NFAEndState>> endStates;
+
+    // 路径中保存的是状态的引用，因此只需修改状态本身的id
+    for (auto &i : nfa.getStates())
+    {
+        auto &state = i.second;
+        auto isEndState = nfa.getEndStates().find(i.first) != nfa.getEndStates().end();
+        state->id = idAllocator.nextID();
+        if (isEndState)
+            endStates.insert({state->id, static_cast<NFAEndState &>(*state)});
+        states.insert({state->id, std::move(state)});
+    }
+
+    nfa.getStates() = std::move(states);
+    nfa.getEndStates() = std::move(endStates);
 }
 
 std::unique_ptr<NFAChlex> NFAFactory::generate(std::shared_ptr<ParsedChlex> parsedChlex)
+{
+    return generate(parsedChlex, 1);
+}
+
+std::unique_ptr<NFAChlex> NFAFactory::generate(std::shared_ptr<ParsedChlex> parsedChlex, int threadCount)
 {
     auto nfaChlex = std::make_unique<NFAChlex>();
     nfaChlex->parsedChlex = parsedChlex;
@@ -203,25 +591,125 @@ std::unique_ptr<NFAChlex> NFAFactory::generate(std::shared_ptr<ParsedChlex> pars
     IDAllocator idAllocator;
     std::vector<std::unique_ptr<NFA>> nfas;
 
-    // 对于每一个正则表达式，生成一个NFA
-    for (auto &parsedRegExp : parsedChlex->getRegExps())
-        nfas.push_back(generate(*parsedRegExp, idAllocator));
+    auto &regExps = parsedChlex->getRegExps();
+    std::vector<std::string> literals(regExps.size());
+    for (int i = 0; i < regExps.size(); i++)
+        if (!toLiteral(*regExps[i]->ast, literals[i]))
+            literals[i].clear();
+
+    std::vector<bool> skipped(regExps.size(), false);
+    for (auto &keyword : extractKeywords(*parsedChlex, literals))
+    {
+        skipped[keyword.rule] = true;
+        if (keyword.hostRule != -1)
+            nfaChlex->keywords.push_back(keyword);
+    }
+
+    // 忽略大小写的正则表达式不能复制区分大小写的片段，反之亦然，因此两者分别统计共享子树
+    std::vector<const RENode *> roots, caselessRoots;
+    std::vector<int> rules, caselessRules;
+    for (int i = 0; i < regExps.size(); i++)
+    {
+        if (skipped[i] || !literals[i].empty())
+            continue;
+        if (regExps[i]->regExp->caseless)
+        {
+            caselessRoots.push_back(regExps[i]->ast);
+            caselessRules.push_back(i);
+        }
+        else
+        {
+            roots.push_back(regExps[i]->ast);
+            rules.push_back(i);
+        }
+    }
+    auto sharedNFAs = generateShared(roots, rules, false);
+    auto caselessSharedNFAs = generateShared(caselessRoots, caselessRules, true);
+
+    // 并行地为每个不是字面量的正则表达式生成NFA片段，每个片段使用自己的id分配器
+    std::vector<std::unique_ptr<NFA>> parts(regExps.size());
+    ThreadPool threadPool(threadCount);
+    threadPool.run(regExps.size(), [&](int i, int) {
+        if (skipped[i] || !literals[i].empty())
+            return;
+
+        IDAllocator partIDAllocator;
+        try
+        {
+            parts[i] = generate(*regExps[i], partIDAllocator, regExps[i]->regExp->caseless ? caselessSharedNFAs : sharedNFAs);
+        }
+        catch (NFAFactoryException &e)
+        {
+            e.rule = i;
+            throw;
+        }
+        parts[i]->getEndStates().begin()->second.get().rule = i;
+    });
+
+    // 按照正则表达式的顺序，将NFA片段重新编号，或将字面量插入前缀树
+    // 字面量的终止状态id在此时分配，使得所有终止状态的id与正则表达式的顺序一致
+    // 忽略大小写的字面量以小写形式插入另一棵前缀树
+    std::vector<LiteralTrieNode> trie(1), caselessTrie(1);
+    for (int i = 0; i < regExps.size(); i++)
+    {
+        if (skipped[i])
+            continue;
+
+        auto &literal = literals[i];
+        if (literal.empty())
+        {
+            renumber(*parts[i], idAllocator);
+            nfas.push_back(std::move(parts[i]));
+            continue;
+        }
+
+        auto caseless = regExps[i]->regExp->caseless;
+        auto &currentTrie = caseless ? caselessTrie : trie;
+        int node = 0;
+        for (auto c : literal)
+        {
+            if (caseless)
+                c = std::tolower(static_cast<unsigned char>(c));
+
+            auto it = currentTrie[node].children.find(c);
+            if (it != currentTrie[node].children.end())
+            {
+                node = it->second;
+                continue;
+            }
+
+            currentTrie[node].children.insert({c, static_cast<int>(currentTrie.size())});
+            node = currentTrie.size();
+            currentTrie.emplace_back();
+        }
+
+        if (currentTrie[node].endId == -1) // 相同的字面量只有第一个有效
+        {
+            currentTrie[node].endId = idAllocator.nextID();
+            currentTrie[node].rule = i;
+        }
+    }
+
+    if (trie.size() > 1)
+        nfas.push_back(fromLiteralTrie(trie, idAllocator, false));
+    if (caselessTrie.size() > 1)
+        nfas.push_back(fromLiteralTrie(caselessTrie, idAllocator, true));
 
     // 创建一个新的起始状态，将所有NFA的起始状态连接到这个新的起始状态
     auto start = std::make_unique<NFAState>(NFAState{idAllocator.nextID()});
 
-    for (auto &nfa : nfas)
-        connect(*start, nfa->getStartState(), 0);
+    for (auto &part : nfas)
+        connect(*start, part->getStartState(), 0);
 
     // 合并所有NFA
     auto nfa = std::make_unique<NFA>(*start);
-    for (auto &nfa : nfas)
-        for (auto &endState : nfa->getEndStates())
+    for (auto &part : nfas)
+        for (auto &endState : part->getEndStates())
             nfa->getEndStates().insert(endState);
 
     nfa->getStates().insert({start->id, std::move(start)});
-    for (auto &nfa : nfas)
-        for (auto &state : nfa->getStates())
+    for (auto &part : nfas)
+        for (auto &state : part->getStates())
             nfa->getStates().insert(std::move(state));
 
     nfaChlex->nfa = std::move(nfa);
@@ -0,0 +1,247 @@
+/**
+ * @file NFAOptimizer.cc
+ * @brief NFAOptimizer.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "NFAOptimizer.hh"
+
+#include <algorithm>
+#include <queue>
+
+using namespace chlex;
+
+NFAOptimizer NFAOptimizer::instance;
+
+std::unique_ptr<NFA> NFAOptimizer::optimize(const NFA &nfa)
+{
+    // 将状态连续编号，之后的计算都使用下标
+    std::vector<int> oldIds;
+    std::map<int, int> indexOf;
+    for (auto &i : nfa.getStates())
+    {
+        indexOf[i.first] = oldIds.size();
+        oldIds.push_back(i.first);
+    }
+    int stateCount = oldIds.size();
+    int start = indexOf.at(nfa.getStartState().id);
+
+    std::vector<std::vector<std::pair<char, int>>> paths(stateCount);
+    std::vector<bool> isEnd(stateCount, false);
+    for (int i = 0; i < stateCount; i++)
+    {
+        for (auto &path : nfa.getStates().at(oldIds[i])->paths)
+            paths[i].push_back({path->byChar, indexOf.at(path->to.id)});
+        isEnd[i] = nfa.getEndStates().find(oldIds[i]) != nfa.getEndStates().end();
+    }
+
+    // 只有一条ε出边的非终止状态对闭包没有贡献，求闭包时直接跳到这样的一串状态之后的第一个状态
+    // Thompson构造中连续的或运算的终止状态就是这样的一串状态，若每次求闭包都经过它们，宽的或运算会使化简变成平方复杂度
+    auto passThrough = [&](int i) { return !isEnd[i] && paths[i].size() == 1 && paths[i][0].first == 0; };
+    std::vector<int> skip(stateCount, -1);
+    std::vector<int> chain;
+    for (int i = 0; i < stateCount; i++)
+    {
+        auto current = i;
+        while (skip[current] == -1 && passThrough(current))
+        {
+            skip[current] = -2; // 正在沿这一串状态前进，再次遇到说明这串状态构成了环
+            chain.push_back(current);
+            current = paths[current][0].second;
+        }
+
+        auto target = skip[current] >= 0 ? skip[current] : current;
+        if (skip[current] == -1)
+            skip[current] = current;
+        for (auto state : chain)
+            skip[state] = target;
+        chain.clear();
+    }
+
+    // 从起始状态出发，只沿非ε路径找出可达的状态，并计算这些状态的ε闭包，得到它们的非ε出边和它们接受的终止状态
+    // 只能通过ε路径到达的状态不会出现在化简后的NFA中，因此不计算它们的闭包，也不会被标记为可达
+    // 接受的终止状态取闭包中id最小的一个，这与DFAFactory的规则一致
+    std::vector<std::set<std::pair<char, int>>> edges(stateCount);
+    std::vector<int> accepts(stateCount, -1);
+    std::vector<int> visitMark(stateCount, -1);
+    std::vector<bool> alive(stateCount, false);
+    std::vector<int> worklist{start};
+    std::vector<int> stack;
+    alive[start] = true;
+    while (!worklist.empty())
+    {
+        auto i = worklist.back();
+        worklist.pop_back();
+
+        stack.push_back(i);
+        visitMark[i] = i;
+        while (!stack.empty())
+        {
+            auto current = stack.back();
+            stack.pop_back();
+
+            if (isEnd[current] && (accepts[i] == -1 || oldIds[current] < accepts[i]))
+                accepts[i] = oldIds[current];
+
+            for (auto &path : paths[current])
+            {
+                if (path.first != 0)
+                    edges[i].insert(path);
+                else if (visitMark[skip[path.second]] != i)
+                {
+                    visitMark[skip[path.second]] = i;
+                    stack.push_back(skip[path.second]);
+                }
+            }
+        }
+
+        for (auto &edge : edges[i])
+        {
+            if (!alive[edge.second])
+            {
+                alive[edge.second] = true;
+                worklist.push_back(edge.second);
+            }
+        }
+    }
+
+    // 删除无法到达终止状态的状态
+    std::vector<std::vector<int>> reverseEdges(stateCount);
+    for (int i = 0; i < stateCount; i++)
+        if (alive[i])
+            for (auto &edge : edges[i])
+                reverseEdges[edge.second].push_back(i);
+
+    std::vector<bool> useful(stateCount, false);
+    for (int i = 0; i < stateCount; i++)
+    {
+        if (alive[i] && accepts[i] != -1)
+        {
+            useful[i] = true;
+            stack.push_back(i);
+        }
+    }
+    while (!stack.empty())
+    {
+        auto current = stack.back();
+        stack.pop_back();
+        for (auto from : reverseEdges[current])
+        {
+            if (alive[from] && !useful[from])
+            {
+                useful[from] = true;
+                stack.push_back(from);
+            }
+        }
+    }
+
+    for (int i = 0; i < stateCount; i++)
+    {
+        alive[i] = alive[i] && (useful[i] || i == start);
+        if (!alive[i])
+            continue;
+
+        for (auto it = edges[i].begin(); it != edges[i].end();)
+        {
+            if (useful[it->second])
+                it++;
+            else
+                it = edges[i].erase(it);
+        }
+    }
+
+    // 反复合并接受相同终止状态且出边完全相同的状态，直到不再有可合并的状态
+    // 每个状态用组中下标最小的状态代表
+    std::vector<int> representative(stateCount);
+    for (int i = 0; i < stateCount; i++)
+        representative[i] = i;
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        std::map<std::pair<int, std::set<std::pair<char, int>>>, int> signatures;
+        for (int i = 0; i < stateCount; i++)
+        {
+            if (!alive[i] || representative[i] != i)
+                continue;
+
+            std::set<std::pair<char, int>> signature;
+            for (auto &edge : edges[i])
+                signature.insert({edge.first, representative[edge.second]});
+
+            auto result = signatures.insert({{accepts[i], signature}, i});
+            if (!result.second)
+            {
+                representative[i] = result.first->second;
+                changed = true;
+            }
+        }
+
+        for (int i = 0; i < stateCount; i++)
+            representative[i] = representative[representative[i]];
+    }
+
+    // 重新编号：终止状态按照接受的终止状态排在前面，其余状态按照原来的顺序排在后面
+    std::vector<int> survivors;
+    for (int i = 0; i < stateCount; i++)
+        if (alive[i] && representative[i] == i)
+            survivors.push_back(i);
+
+    std::stable_sort(survivors.begin(), survivors.end(), [&](int a, int b) {
+        if ((accepts[a] == -1) != (accepts[b] == -1))
+            return accepts[a] != -1;
+        return accepts[a] < accepts[b];
+    });
+
+    std::vector<int> newIdOf(stateCount, -1);
+    std::vector<std::unique_ptr<NFAState>> newStates;
+    for (auto i : survivors)
+    {
+        newIdOf[i] = newStates.size();
+        if (accepts[i] != -1)
+        {
+            auto endState = std::make_unique<NFAEndState>();
+            endState->rule = nfa.getEndStates().at(accepts[i]).get().rule;
+            newStates.push_back(std::move(endState));
+        }
+        else
+            newStates.push_back(std::make_unique<NFAState>());
+        newStates.back()->id = newIdOf[i];
+    }
+
+    for (auto i : survivors)
+    {
+        auto &from = *newStates[newIdOf[i]];
+        std::set<std::pair<char, int>> added;
+        for (auto &edge : edges[i])
+        {
+            auto to = newIdOf[representative[edge.second]];
+            if (added.insert({edge.first, to}).second)
+                from.paths.push_back(std::make_unique<NFAPath>(NFAPath{from, *newStates[to], edge.first}));
+        }
+    }
+
+    auto newNFA = std::make_unique<NFA>(*newStates[newIdOf[representative[start]]]);
+    for (auto &state : newStates)
+    {
+        auto id = state->id;
+        if (id < survivors.size() && accepts[survivors[id]] != -1)
+            newNFA->getEndStates().insert({id, static_cast<NFAEndState &>(*state)});
+        newNFA->getStates().insert({id, std::move(state)});
+    }
+
+    return newNFA;
+}
+
+std::unique_ptr<NFAChlex> NFAOptimizer::optimize(std::shared_ptr<NFAChlex> nfaChlex)
+{
+    auto optimized = std::make_unique<NFAChlex>();
+    optimized->parsedChlex = nfaChlex->parsedChlex;
+    optimized->keywords = nfaChlex->keywords;
+    optimized->nfa = optimize(nfaChlex->getNFA());
+    return optimized;
+}
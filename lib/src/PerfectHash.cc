@@ -0,0 +1,124 @@
+/**
+ * @file PerfectHash.cc
+ * @brief PerfectHash.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "PerfectHash.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace chlex;
+
+PerfectHashFactory PerfectHashFactory::instance;
+
+unsigned long long PerfectHash::hash(const std::string &key)
+{
+    return hash(key.data(), key.size());
+}
+
+unsigned long long PerfectHash::hash(const char *key, std::size_t length)
+{
+    unsigned long long result = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; i++)
+    {
+        result ^= static_cast<unsigned char>(key[i]);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+unsigned long long PerfectHash::slotOf(unsigned long long hash, unsigned int seed, unsigned long long slotCount)
+{
+    auto result = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+    result ^= result >> 33;
+    result *= 0xFF51AFD7ED558CCDULL;
+    result ^= result >> 33;
+    return result % slotCount;
+}
+
+int PerfectHash::find(const std::string &key, const std::vector<std::string> &keys) const
+{
+    if (slots.empty())
+        return -1;
+
+    auto h = hash(key);
+    auto slot = slots[slotOf(h, seeds[h % seeds.size()], slots.size())];
+    return keys[slot] == key ? slot : -1;
+}
+
+PerfectHash PerfectHashFactory::generate(const std::vector<std::string> &keys)
+{
+    PerfectHash result;
+    if (keys.empty())
+        return result;
+
+    std::vector<unsigned long long> hashes;
+    for (auto &key : keys)
+        hashes.push_back(PerfectHash::hash(key));
+
+    // 平均每个桶放4个字符串，失败时增加桶的数量重试
+    for (std::size_t bucketCount = (keys.size() + 3) / 4;; bucketCount = bucketCount * 2 + 1)
+    {
+        std::vector<std::vector<int>> buckets(bucketCount);
+        for (int i = 0; i < keys.size(); i++)
+            buckets[hashes[i] % bucketCount].push_back(i);
+
+        // 先放置较大的桶，它们更难找到合适的位移值
+        std::vector<int> order(bucketCount);
+        for (int i = 0; i < bucketCount; i++)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return buckets[a].size() > buckets[b].size(); });
+
+        result.seeds.assign(bucketCount, 0);
+        result.slots.assign(keys.size(), -1);
+
+        bool success = true;
+        std::vector<unsigned long long> placed;
+        for (auto bucket : order)
+        {
+            if (buckets[bucket].empty())
+                break;
+
+            bool found = false;
+            for (unsigned int seed = 0; seed < (1u << 16) && !found; seed++)
+            {
+                placed.clear();
+                found = true;
+                for (auto key : buckets[bucket])
+                {
+                    auto slot = PerfectHash::slotOf(hashes[key], seed, keys.size());
+                    if (result.slots[slot] != -1 || std::find(placed.begin(), placed.end(), slot) != placed.end())
+                    {
+                        found = false;
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+
+                if (found)
+                {
+                    result.seeds[bucket] = seed;
+                    for (int i = 0; i < placed.size(); i++)
+                        result.slots[placed[i]] = buckets[bucket][i];
+                }
+            }
+
+            if (!found)
+            {
+                success = false;
+                break;
+            }
+        }
+
+        if (success)
+            return result;
+
+        if (bucketCount > keys.size() * 4)
+            throw std::runtime_error("Cannot build perfect hash (duplicate keys?)");
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file RegExp.cc
+ * @brief RegExp.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "RegExp.hh"
+
+using namespace chlex;
+
+std::bitset<256> CharSetNode::foldCase(const std::bitset<256> &chars)
+{
+    auto result = chars;
+    for (int c = 'a'; c <= 'z'; c++)
+    {
+        if (chars.test(c) || chars.test(c - 'a' + 'A'))
+        {
+            result.set(c);
+            result.set(c - 'a' + 'A');
+        }
+    }
+    return result;
+}
+
+void *RENodeArena::allocate(std::size_t size)
+{
+    // 向上对齐，使下一次分配的位置仍然是对齐的
+    size = (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    if (size > remaining)
+    {
+        auto newBlockSize = size > blockSize ? size : blockSize;
+        blocks.push_back(std::unique_ptr<std::byte[]>(new std::byte[newBlockSize]));
+        current = blocks.back().get();
+        remaining = newBlockSize;
+    }
+
+    auto result = current;
+    current += size;
+    remaining -= size;
+    return result;
+}
+
+void RENodeArena::splice(RENodeArena &other)
+{
+    // 保留当前块作为最后一个块，使之后的分配仍然可以使用它剩余的空间
+    std::unique_ptr<std::byte[]> currentBlock;
+    if (!blocks.empty())
+    {
+        currentBlock = std::move(blocks.back());
+        blocks.pop_back();
+    }
+
+    for (auto &block : other.blocks)
+        blocks.push_back(std::move(block));
+    if (currentBlock)
+        blocks.push_back(std::move(currentBlock));
+
+    other.blocks.clear();
+    other.current = nullptr;
+    other.remaining = 0;
+}
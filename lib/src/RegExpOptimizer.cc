@@ -0,0 +1,309 @@
+/**
+ * @file RegExpOptimizer.cc
+ * @brief RegExpOptimizer.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "RegExpOptimizer.hh"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace chlex;
+
+RegExpOptimizer RegExpOptimizer::instance;
+
+namespace
+{
+    /**
+     * @brief 规范化后的节点的结构
+     * @details 子节点都已经是规范化的，因此结构相同当且仅当各个字段都相同
+     */
+    struct NodeKey
+    {
+        RENodeType type;        ///< 节点类型
+        std::bitset<256> chars; ///< 字符或字符集合中的字符
+        const RENode *left;     ///< 左子节点或唯一的子节点
+        const RENode *right;    ///< 右子节点
+        int min = 0;            ///< 重复节点的最少重复次数
+        int max = 0;            ///< 重复节点的最多重复次数
+
+        bool operator==(const NodeKey &other) const
+        {
+            return type == other.type && chars == other.chars && left == other.left && right == other.right &&
+                   min == other.min && max == other.max;
+        }
+    };
+
+    /**
+     * @brief NodeKey的哈希函数
+     */
+    struct NodeKeyHash
+    {
+        std::size_t operator()(const NodeKey &key) const
+        {
+            auto result = std::hash<std::bitset<256>>()(key.chars);
+            result = result * 31 + static_cast<std::size_t>(key.type);
+            result = result * 31 + std::hash<const RENode *>()(key.left);
+            result = result * 31 + std::hash<const RENode *>()(key.right);
+            result = result * 31 + static_cast<std::size_t>(key.min);
+            result = result * 31 + static_cast<std::size_t>(key.max);
+            return result;
+        }
+    };
+
+    /**
+     * @brief 规范化器
+     * @details 自底向上地规范化节点，并对结构相同的节点只保留一份
+     */
+    class Canonicalizer
+    {
+    private:
+        RENodeArena &arena;                                       ///< 新节点的分配器
+        std::unordered_map<NodeKey, RENode *, NodeKeyHash> nodes; ///< 所有规范化后的节点
+        std::unordered_map<const RENode *, int> order;            ///< 每个规范化后的节点的创建顺序
+        std::unordered_map<const RENode *, RENode *> canonicalOf; ///< 已经规范化过的原节点
+
+        /**
+         * @brief 获取结构为key的节点，不存在则创建
+         */
+        RENode *intern(const NodeKey &key)
+        {
+            auto it = nodes.find(key);
+            if (it != nodes.end())
+                return it->second;
+
+            RENode *node;
+            switch (key.type)
+            {
+            case RENodeType::CHAR:
+            {
+                int c = 0;
+                while (!key.chars.test(c))
+                    c++;
+                node = arena.make<CharNode>(static_cast<char>(c));
+                break;
+            }
+            case RENodeType::CHARSET:
+                node = arena.make<CharSetNode>(key.chars);
+                break;
+            case RENodeType::OR:
+            case RENodeType::CONCAT:
+                node = arena.make<BiOpNode>(key.type, const_cast<RENode *>(key.left), const_cast<RENode *>(key.right));
+                break;
+            case RENodeType::REPEAT:
+                node = arena.make<RepeatNode>(const_cast<RENode *>(key.left), key.min, key.max);
+                break;
+            default:
+                node = arena.make<MonoOpNode>(key.type, const_cast<RENode *>(key.left));
+                break;
+            }
+
+            nodes.insert({key, node});
+            order.insert({node, static_cast<int>(order.size())});
+            return node;
+        }
+
+        /**
+         * @brief 获取匹配chars中的字符的节点，只有一个字符时为字符节点
+         */
+        RENode *makeChars(const std::bitset<256> &chars)
+        {
+            return intern(NodeKey{chars.count() == 1 ? RENodeType::CHAR : RENodeType::CHARSET, chars, nullptr, nullptr});
+        }
+
+        /**
+         * @brief 获取单目运算符节点，同时化简嵌套的闭包
+         */
+        RENode *makeMono(RENodeType type, RENode *child)
+        {
+            auto childType = child->type;
+
+            switch (type)
+            {
+            case RENodeType::STAR: // (a*)* = (a+)* = (a?)* = a*
+                if (childType == RENodeType::STAR)
+                    return child;
+                if (childType == RENodeType::PLUS || childType == RENodeType::QUESTION)
+                    return makeMono(RENodeType::STAR, static_cast<MonoOpNode *>(child)->child);
+                break;
+            case RENodeType::PLUS: // (a*)+ = a*, (a+)+ = a+, (a?)+ = a*
+                if (childType == RENodeType::STAR || childType == RENodeType::PLUS)
+                    return child;
+                if (childType == RENodeType::QUESTION)
+                    return makeMono(RENodeType::STAR, static_cast<MonoOpNode *>(child)->child);
+                break;
+            case RENodeType::QUESTION: // (a*)? = a*, (a+)? = a*, (a?)? = a?
+                if (childType == RENodeType::STAR || childType == RENodeType::QUESTION)
+                    return child;
+                if (childType == RENodeType::PLUS)
+                    return makeMono(RENodeType::STAR, static_cast<MonoOpNode *>(child)->child);
+                break;
+            default:
+                break;
+            }
+
+            return intern(NodeKey{type, {}, child, nullptr});
+        }
+
+        /**
+         * @brief 获取重复节点，同时把可以用闭包表示的重复次数转换为闭包
+         */
+        RENode *makeRepeat(RENode *child, int min, int max)
+        {
+            if (min == 1 && max == 1) // a{1} = a
+                return child;
+            if (min == 0 && max == -1) // a{0,} = a*
+                return makeMono(RENodeType::STAR, child);
+            if (min == 1 && max == -1) // a{1,} = a+
+                return makeMono(RENodeType::PLUS, child);
+            if (min == 0 && max == 1) // a{0,1} = a?
+                return makeMono(RENodeType::QUESTION, child);
+
+            return intern(NodeKey{RENodeType::REPEAT, {}, child, nullptr, min, max});
+        }
+
+        /**
+         * @brief 将连续的type运算的所有操作数依次放入operands
+         */
+        void flatten(const RENode *node, RENodeType type, std::vector<const RENode *> &operands)
+        {
+            std::vector<const RENode *> stack{node};
+            while (!stack.empty())
+            {
+                auto current = stack.back();
+                stack.pop_back();
+
+                if (current->type == type)
+                {
+                    auto biOpNode = static_cast<const BiOpNode *>(current);
+                    stack.push_back(biOpNode->right);
+                    stack.push_back(biOpNode->left);
+                }
+                else
+                    operands.push_back(current);
+            }
+        }
+
+        /**
+         * @brief 将操作数组成右结合的链
+         */
+        RENode *makeChain(RENodeType type, const std::vector<RENode *> &operands)
+        {
+            auto result = operands.back();
+            for (int i = static_cast<int>(operands.size()) - 2; i >= 0; i--)
+                result = intern(NodeKey{type, {}, operands[i], result});
+            return result;
+        }
+
+    public:
+        explicit Canonicalizer(RENodeArena &arena) : arena(arena) {}
+
+        /**
+         * @brief 规范化节点
+         * @param node 原节点
+         * @return 规范化后的节点
+         */
+        RENode *canonicalize(const RENode *node)
+        {
+            auto it = canonicalOf.find(node);
+            if (it != canonicalOf.end())
+                return it->second;
+
+            RENode *result;
+            switch (node->type)
+            {
+            case RENodeType::CHAR:
+            {
+                std::bitset<256> chars;
+                chars.set(static_cast<unsigned char>(static_cast<const CharNode *>(node)->value));
+                result = makeChars(chars);
+                break;
+            }
+            case RENodeType::CHARSET:
+                result = makeChars(static_cast<const CharSetNode *>(node)->chars);
+                break;
+            case RENodeType::OR:
+            {
+                // 规范化后的分支可能仍然是或运算，需要再展开一次
+                std::vector<const RENode *> branches;
+                flatten(node, RENodeType::OR, branches);
+                std::vector<const RENode *> canonicalBranches;
+                for (auto branch : branches)
+                    flatten(canonicalize(branch), RENodeType::OR, canonicalBranches);
+
+                std::bitset<256> chars;
+                std::vector<RENode *> operands;
+                for (auto branch : canonicalBranches)
+                {
+                    if (branch->type == RENodeType::CHAR)
+                        chars.set(static_cast<unsigned char>(static_cast<const CharNode *>(branch)->value));
+                    else if (branch->type == RENodeType::CHARSET)
+                        chars |= static_cast<const CharSetNode *>(branch)->chars;
+                    else
+                        operands.push_back(const_cast<RENode *>(branch));
+                }
+
+                // 按照创建顺序排序并去重，使得分支顺序不同的或运算也能共享
+                std::sort(operands.begin(), operands.end(), [&](RENode *a, RENode *b) { return order.at(a) < order.at(b); });
+                operands.erase(std::unique(operands.begin(), operands.end()), operands.end());
+                if (chars.any())
+                    operands.insert(operands.begin(), makeChars(chars));
+
+                result = makeChain(RENodeType::OR, operands);
+                break;
+            }
+            case RENodeType::CONCAT:
+            {
+                std::vector<const RENode *> factors;
+                flatten(node, RENodeType::CONCAT, factors);
+                std::vector<const RENode *> canonicalFactors;
+                for (auto factor : factors)
+                    flatten(canonicalize(factor), RENodeType::CONCAT, canonicalFactors);
+
+                std::vector<RENode *> operands;
+                for (auto factor : canonicalFactors)
+                    operands.push_back(const_cast<RENode *>(factor));
+
+                result = makeChain(RENodeType::CONCAT, operands);
+                break;
+            }
+            case RENodeType::STAR:
+            case RENodeType::PLUS:
+            case RENodeType::QUESTION:
+                result = makeMono(node->type, canonicalize(static_cast<const MonoOpNode *>(node)->child));
+                break;
+            case RENodeType::REPEAT:
+            {
+                auto repeatNode = static_cast<const RepeatNode *>(node);
+                result = makeRepeat(canonicalize(repeatNode->child), repeatNode->min, repeatNode->max);
+                break;
+            }
+            default:
+                throw std::runtime_error("Unknown RENodeType (this should never happen)");
+            }
+
+            canonicalOf.insert({node, result});
+            return result;
+        }
+    };
+}
+
+std::unique_ptr<ParsedChlex> RegExpOptimizer::optimize(std::shared_ptr<ParsedChlex> parsedChlex)
+{
+    auto optimized = std::make_unique<ParsedChlex>();
+    optimized->rawChlex = parsedChlex->rawChlex;
+
+    Canonicalizer canonicalizer(optimized->arena);
+    for (auto &parsedRegExp : parsedChlex->regExps)
+    {
+        auto ast = canonicalizer.canonicalize(parsedRegExp->ast);
+        optimized->regExps.push_back(std::make_unique<ParsedRegExp>(parsedRegExp->regExp, ast));
+    }
+
+    return optimized;
+}
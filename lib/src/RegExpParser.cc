@@ -9,36 +9,50 @@
 
 #include "RegExpParser.hh"
 
+#include "ThreadPool.hh"
+
+#include <algorithm>
+
 #include <stdexcept>
 
 using namespace chlex;
 
 RegExpParser RegExpParser::instance;
 
-std::unique_ptr<RENode> RegExpParser::parseFrom(const std::string &re, int pos, int &endPos, bool inBrace, bool inBracket)
+RENode *RegExpParser::parseFrom(const std::string &re, RENodeArena &arena, RegExpParserScratch &scratch)
 {
-    std::vector<char> opStack;                      // 操作符栈
-    std::vector<std::unique_ptr<RENode>> nodeStack; // 节点栈
+    auto &opStack = scratch.opStack;     // 操作符栈
+    auto &nodeStack = scratch.nodeStack; // 节点栈
+    auto &frames = scratch.frames;       // 尚未闭合的括号，代替原来的递归调用
+    opStack.clear();
+    nodeStack.clear();
+    frames.clear();
 
     bool readChar = false; // 上一个读取到的是否是字符
                            // 此变量的意义是检测是否有两个字符相邻，如果有，则需要插入一个连接符
 
-    for (auto i = pos; i < re.length(); i++)
+    // 压入一个操作数，必要时先插入连接符
+    // 由于连接符的优先级最高，所以直接将它压入栈中
+    auto pushOperand = [&](RENode *node) {
+        if (readChar)
+            opStack.push_back('&');
+        readChar = true;
+        nodeStack.push_back(node);
+    };
+
+    for (int i = 0; i < re.length(); i++)
     {
         auto current = re[i];
 
         switch (current)
         {
-        case '|': // 遇到或运算符。由于它是优先级最低的双目运算符，所以直接将栈中的所有运算符弹出，然后将它压入栈中
+        case '|': // 遇到或运算符。由于它是优先级最低的双目运算符，所以直接将当前括号中的所有运算符弹出，然后将它压入栈中
         {
-            if (inBracket) // []中只能出现'-'
-                throw RegExpParserException("Unexpected operator '|'", i);
-
             readChar = false;
 
             try
             {
-                popStacks(opStack, nodeStack);
+                popStacks(opStack, nodeStack, frames.empty() ? 0 : frames.back().opBase, frames.empty() ? 0 : frames.back().nodeBase, arena);
             }
             catch (const std::exception &e)
             {
@@ -48,414 +62,481 @@ std::unique_ptr<RENode> RegExpParser::parseFrom(const std::string &re, int pos,
             opStack.push_back('|');
             break;
         }
-        case '*': // 遇到单目运算符，直接把栈中最后一个节点弹出，然后将它作为子节点，构造一个新的节点，再压入栈中
-                  // 之后的'+'和'?'的处理方式与此相同
-        {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '*'", i);
-
-            readChar = true; // 考虑类似"a*b"的情况，此时需要插入一个连接符
-            if (nodeStack.empty())
-                throw RegExpParserException("Unexpected operator '*'", i);
-
-            auto node = std::move(nodeStack.back());
-            nodeStack.pop_back();
-
-            auto newNode = std::make_unique<MonoOpNode>(RENodeType::STAR, std::move(node));
-            nodeStack.push_back(std::move(newNode));
-            break;
-        }
-        case '+':
+        case '*': // 遇到单目运算符，直接把栈中最后一个节点替换为以它为子节点的新节点
+        case '+': // 单目运算符只能出现在操作数之后，诸如"a|*"是非法的
+        case '?':
         {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '+'", i);
-
-            readChar = true;
-            if (nodeStack.empty())
-                throw RegExpParserException("Unexpected operator '+'", i);
-
-            auto node = std::move(nodeStack.back());
-            nodeStack.pop_back();
+            if (!readChar)
+                throw RegExpParserException(std::string("Unexpected operator '") + current + "'", i);
 
-            auto newNode = std::make_unique<MonoOpNode>(RENodeType::PLUS, std::move(node));
-            nodeStack.push_back(std::move(newNode));
+            auto type = current == '*' ? RENodeType::STAR : current == '+' ? RENodeType::PLUS : RENodeType::QUESTION;
+            nodeStack.back() = arena.make<MonoOpNode>(type, nodeStack.back());
             break;
         }
-        case '?':
+        case '{': // 遇到重复次数，和其他单目运算符一样替换栈中最后一个节点
         {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '?'", i);
-
-            readChar = true;
-            if (nodeStack.empty())
-                throw RegExpParserException("Unexpected operator '?'", i);
+            int min, max;
+            auto end = readChar ? parseRepeat(re, i, min, max) : -1;
+            if (end == -1) // 不是合法的重复次数，按照字符本身处理
+            {
+                pushOperand(arena.make<CharNode>(current));
+                break;
+            }
 
-            auto node = std::move(nodeStack.back());
-            nodeStack.pop_back();
+            if (min > maxRepeatCount || max > maxRepeatCount)
+                throw RegExpParserException("Repetition count too large", i);
+            if (max != -1 && min > max)
+                throw RegExpParserException("Invalid repetition count", i);
 
-            auto newNode = std::make_unique<MonoOpNode>(RENodeType::QUESTION, std::move(node));
-            nodeStack.push_back(std::move(newNode));
+            nodeStack.back() = arena.make<RepeatNode>(nodeStack.back(), min, max);
+            i = end;
             break;
         }
-        case '(': // 遇到左括号，递归调用parseFrom()，然后将返回值压入栈中
+        case '(': // 遇到左括号，记录当前栈的大小，之后的内容组装完成后作为一个操作数
         {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '('", i);
-
             if (readChar) // 考虑类似"a(b...)"的情况，此时需要插入一个连接符
-                          // 由于连接符的优先级最高，所以直接将它压入栈中
                 opStack.push_back('&');
 
-            readChar = true; // 考虑类似"(a...)b"的情况，此时需要插入一个连接符
-
-            int resultPos;
-            auto result = parseFrom(re, i + 1, resultPos, true, false);
-            nodeStack.push_back(std::move(result));
-            i = resultPos + 1;
+            readChar = false;
+            frames.push_back({static_cast<int>(opStack.size()), static_cast<int>(nodeStack.size()), i});
             break;
         }
-        case ')': // 遇到右括号，尝试清空栈并返回最终结果
+        case ')': // 遇到右括号，组装当前括号中的内容
         {
-            if (!inBrace || inBracket)
+            if (frames.empty())
                 throw RegExpParserException("Unexpected operator ')'", i);
 
             try
             {
-                popStacks(opStack, nodeStack);
+                popStacks(opStack, nodeStack, frames.back().opBase, frames.back().nodeBase, arena);
             }
             catch (const std::exception &e)
             {
                 throw RegExpParserException("Unexpected operator ')'", i);
             }
 
-            endPos = i;
-            return std::move(nodeStack.back());
-        }
-        case '[': // 遇到左中括号，递归调用parseFrom()，然后将返回值压入栈中
-        {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '['", i);
-
-            if (readChar) // 考虑类似"a[b...]"的情况，此时需要插入一个连接符
-                opStack.push_back('&');
-
-            readChar = true; // 考虑类似"[a...]b"的情况，此时需要插入一个连接符
-
-            int resultPos;
-            auto result = parseFrom(re, i + 1, resultPos, inBrace, true);
-            nodeStack.push_back(std::move(result));
-            i = resultPos + 1;
+            frames.pop_back();
+            readChar = true; // 考虑类似"(a...)b"的情况，此时需要插入一个连接符
             break;
         }
-        case ']': // 遇到右中括号，尝试清空栈并返回最终结果
-        {
-            if (!inBracket)
-                throw RegExpParserException("Unexpected operator ']'", i);
-
-            try
-            {
-                popStacks(opStack, nodeStack);
-            }
-            catch (const std::exception &e)
-            {
-                throw RegExpParserException("Unexpected operator ']'", i);
-            }
-
-            endPos = i;
-            return std::move(nodeStack.back());
-        }
-        case '-': // 遇到'-'，检查栈顶运算符
-                  // 若为'-'，说明出现类似'a-b-c'的情况，是非法的
-                  // 若为'&'，同样非法（该运算符不会出现在中括号内）
-                  // 若为'|'，把它压入栈中
-                  // 若栈为空，把它压入栈中
+        case '[': // 遇到左中括号，将其中的内容转换为一个字符集合
         {
-            if (!inBracket) // 只有在[]中才能出现'-'
-                throw RegExpParserException("Unexpected operator '-'", i);
-
-            if (nodeStack.back()->type != RENodeType::CHAR) // '-'只能出现在字符之间，诸如'\s-a'是非法的
-                throw RegExpParserException("Unexpected operator '-'", i);
-
-            readChar = false;
-
-            if (opStack.empty())
-                opStack.push_back('-');
-            else
-            {
-                auto top = opStack.back();
-
-                if (top == '|')
-                {
-                    opStack.push_back('-');
-                }
-                else
-                {
-                    throw RegExpParserException("Unexpected operator '-'", i);
-                }
-            }
+            std::bitset<256> bytes;
+            CodePointSet codePoints;
+            i = parseBracket(re, i, bytes, codePoints);
+            pushOperand(makeFromChars(bytes, codePoints, arena));
             break;
         }
-        case '.': // 遇到'.'，直接将其展开为所有字符的或运算
+        case ']': // 只有在[]中才能出现'-'和']'
+        case '-':
+            throw RegExpParserException(std::string("Unexpected operator '") + current + "'", i);
+        case '.': // 遇到'.'，将其转换为所有字符的集合
         {
-            if (inBracket)
-                throw RegExpParserException("Unexpected operator '.'", i);
-
-            if (readChar)
-                opStack.push_back('&');
-
-            readChar = true;
-            auto node = makeFromDot();
-            nodeStack.push_back(std::move(node));
+            pushOperand(makeFromChars(makeFromDot(), CodePointSet(), arena));
             break;
         }
-        case '\\': // 遇到'\'，检查下一个字符
+        case '\\': // 遇到'\'，解析转义字符
         {
-            if (readChar) // 在中括号内时，两个字符相邻代表或运算，否则代表连接
-            {
-                if (inBracket)
-                    opStack.push_back('|');
-                else
-                    opStack.push_back('&');
-            }
-
-            readChar = true;
-            i++;
-            if (i >= re.length())
-                throw RegExpParserException("Unexpected '\\'", i);
-
-            auto next = re[i];
-            switch (next)
-            {
-            case 'd': // 遇到'\d'，直接将其展开为所有数字的或运算
-            {
-                auto node = makeFromDigits();
-                nodeStack.push_back(std::move(node));
-                break;
-            }
-            case 's': // 遇到'\s'，直接将其展开为所有空白字符的或运算
-            {
-                auto node = makeFromEmpty();
-                nodeStack.push_back(std::move(node));
-                break;
-            }
-            case 'x': // 遇到'\x'，检查下两个字符
-            {
-                i++;
-                if (i >= re.length())
-                    throw RegExpParserException("Unexpected '\\x'", i);
-
-                auto c1 = re[i];
-                i++;
-                if (i >= re.length())
-                    throw RegExpParserException("Unexpected '\\x'", i);
-
-                auto c2 = re[i];
-
-                if (c1 >= '0' && c1 <= '9')
-                {
-                    c1 = c1 - '0';
-                }
-                else if (c1 >= 'a' && c1 <= 'f')
-                {
-                    c1 = c1 - 'a' + 10;
-                }
-                else if (c1 >= 'A' && c1 <= 'F')
-                {
-                    c1 = c1 - 'A' + 10;
-                }
-                else
-                {
-                    throw RegExpParserException("Unexpected '\\x'", i);
-                }
-
-                if (c2 >= '0' && c2 <= '9')
-                {
-                    c2 = c2 - '0';
-                }
-                else if (c2 >= 'a' && c2 <= 'f')
-                {
-                    c2 = c2 - 'a' + 10;
-                }
-                else if (c2 >= 'A' && c2 <= 'F')
-                {
-                    c2 = c2 - 'A' + 10;
-                }
-                else
-                {
-                    throw RegExpParserException("Unexpected '\\x'", i);
-                }
-
-                auto node = std::make_unique<CharNode>(c1 << 4 + c2);
-                nodeStack.push_back(std::move(node));
-                break;
-            }
-            case '\\': // 遇到'\\'，直接按照'\'处理
-            {
-                auto node = std::make_unique<CharNode>('\\');
-                nodeStack.push_back(std::move(node));
-                break;
-            }
-            case '"': // 遇到'\"'，直接按照'"'处理
-            {
-                auto node = std::make_unique<CharNode>('"');
-                nodeStack.push_back(std::move(node));
-                break;
-            }
-            default:
-            {
-                throw RegExpParserException("Unexpected '\\'", i);
-            }
-            }
+            std::bitset<256> bytes;
+            CodePointSet codePoints;
+            i = parseEscape(re, i, bytes, codePoints);
+            pushOperand(makeFromChars(bytes, codePoints, arena));
+            break;
         }
         default: // 遇到字符，直接将其压入栈中
         {
-            if (readChar)
-            {
-                if (inBracket)
-                    opStack.push_back('|');
-                else
-                    opStack.push_back('&');
-            }
-
-            readChar = true;
-            auto node = std::make_unique<CharNode>(current);
-            nodeStack.push_back(std::move(node));
+            pushOperand(arena.make<CharNode>(current));
+            break;
         }
         }
     }
 
-    if (inBracket)
-        throw RegExpParserException("Missing ']'", re.length() - 1);
-    if (inBrace)
-        throw RegExpParserException("Missing ')'", re.length() - 1);
+    if (!frames.empty())
+        throw RegExpParserException("Missing ')'", frames.back().pos);
 
     try
     {
-        popStacks(opStack, nodeStack);
+        popStacks(opStack, nodeStack, 0, 0, arena);
     }
     catch (const std::exception &e)
     {
         throw RegExpParserException("Unexpected end of regular expression", re.length() - 1);
     }
 
-    return std::move(nodeStack.back());
+    return nodeStack.back();
 }
 
-void RegExpParser::popStacks(std::vector<char> &opStack, std::vector<std::unique_ptr<RENode>> &nodeStack)
+void RegExpParser::popStacks(std::vector<char> &opStack, std::vector<RENode *> &nodeStack, int opBase, int nodeBase, RENodeArena &arena)
 {
-    while (!opStack.empty())
+    while (opStack.size() > opBase)
     {
         auto op = opStack.back();
         opStack.pop_back();
 
-        if (nodeStack.empty())
+        if (nodeStack.size() < nodeBase + 2)
             throw std::runtime_error("Invalid regular expression");
-        auto right = std::move(nodeStack.back());
+        auto right = nodeStack.back();
         nodeStack.pop_back();
-
-        if (nodeStack.empty())
-            throw std::runtime_error("Invalid regular expression");
-        auto left = std::move(nodeStack.back());
+        auto left = nodeStack.back();
         nodeStack.pop_back();
 
-        std::unique_ptr<RENode> node = nullptr;
-        switch (op)
-        {
-        case '&':
-            node = std::make_unique<BiOpNode>(RENodeType::CONCAT, std::move(left), std::move(right));
-            break;
-        case '|':
-            node = std::make_unique<BiOpNode>(RENodeType::OR, std::move(left), std::move(right));
-            break;
-        }
-        nodeStack.push_back(std::move(node));
+        auto type = op == '&' ? RENodeType::CONCAT : RENodeType::OR;
+        nodeStack.push_back(arena.make<BiOpNode>(type, left, right));
     }
 
-    if (nodeStack.size() != 1)
+    if (nodeStack.size() != nodeBase + 1)
         throw std::runtime_error("Invalid regular expression");
 }
 
-std::unique_ptr<RENode> RegExpParser::makeFromDot()
+int RegExpParser::parseEscape(const std::string &re, int pos, std::bitset<256> &bytes, CodePointSet &codePoints)
 {
-    std::unique_ptr<RENode> result = nullptr;
-    for (char c = 0; c < 128; c++)
+    auto i = pos + 1;
+    if (i >= re.length())
+        throw RegExpParserException("Unexpected '\\'", pos);
+
+    auto next = re[i];
+    switch (next)
     {
-        auto node = std::make_unique<CharNode>(c);
-        if (result == nullptr)
+    case 'd': // 遇到'\d'，转换为所有数字
+        bytes |= makeFromDigits();
+        return i;
+    case 's': // 遇到'\s'，转换为所有空白字符
+        bytes |= makeFromEmpty();
+        return i;
+    case 'x': // 遇到'\x'，检查下两个字符，得到一个原始字节
+    {
+        int value = 0;
+        for (int j = 0; j < 2; j++)
         {
-            result = std::move(node);
+            i++;
+            if (i >= re.length())
+                throw RegExpParserException("Unexpected '\\x'", i);
+
+            auto digit = hexValue(re[i]);
+            if (digit == -1)
+                throw RegExpParserException("Unexpected '\\x'", i);
+            value = value * 16 + digit;
         }
-        else
+
+        if (value == 0) // 0表示ε，不能作为字符
+            throw RegExpParserException("Unexpected '\\x00'", i);
+
+        bytes.set(value);
+        return i;
+    }
+    case 'u': // 遇到'\u{h...}'，得到一个码位
+    {
+        i++;
+        if (i >= re.length() || re[i] != '{')
+            throw RegExpParserException("Expected '{' after '\\u'", i);
+
+        unsigned int value = 0;
+        int digits = 0;
+        for (i++; i < re.length() && re[i] != '}'; i++)
         {
-            result = std::make_unique<BiOpNode>(RENodeType::OR, std::move(result), std::move(node));
+            auto digit = hexValue(re[i]);
+            if (digit == -1 || ++digits > 6)
+                throw RegExpParserException("Unexpected '\\u'", i);
+            value = value * 16 + digit;
         }
+
+        if (i >= re.length())
+            throw RegExpParserException("Missing '}'", re.length() - 1);
+        if (digits == 0 || value == 0 || value > CodePointSet::maxCodePoint || (value >= 0xD800 && value <= 0xDFFF))
+            throw RegExpParserException("Invalid code point", i);
+
+        codePoints.add(value, value);
+        return i;
     }
+    case 'p': // 遇到'\p{类别}'或'\P{类别}'，得到该Unicode通用类别或其补集中的所有码位
+    case 'P':
+    {
+        i++;
+        if (i >= re.length() || re[i] != '{')
+            throw RegExpParserException(std::string("Expected '{' after '\\") + next + "'", i);
 
-    return result;
+        auto nameEnd = re.find('}', i);
+        if (nameEnd == std::string::npos)
+            throw RegExpParserException("Missing '}'", re.length() - 1);
+
+        CodePointSet category;
+        if (!CodePointSet::fromCategory(re.substr(i + 1, nameEnd - i - 1), category))
+            throw RegExpParserException("Unknown Unicode category", i + 1);
+
+        codePoints.add(next == 'p' ? category : category.complement());
+        return nameEnd;
+    }
+    case '\\': // 遇到'\\'、'\"'或者转义的运算符，直接按照字符本身处理
+    case '"':
+    case '|':
+    case '*':
+    case '+':
+    case '?':
+    case '(':
+    case ')':
+    case '[':
+    case ']':
+    case '-':
+    case '.':
+    case '{':
+    case '}':
+        bytes.set(static_cast<unsigned char>(next));
+        return i;
+    default:
+        throw RegExpParserException("Unexpected '\\'", i);
+    }
 }
 
-std::unique_ptr<RENode> RegExpParser::makeFromRange(char from, char to)
+int RegExpParser::parseRepeat(const std::string &re, int pos, int &min, int &max)
 {
-    if (from > to)
+    auto i = pos + 1;
+
+    // 读取一个十进制数，超过上限的部分不再累加，只需要知道它超过了上限
+    auto readNumber = [&](int &value) {
+        auto begin = i;
+        value = 0;
+        for (; i < re.length() && re[i] >= '0' && re[i] <= '9'; i++)
+            value = std::min(value * 10 + (re[i] - '0'), maxRepeatCount + 1);
+        return i > begin;
+    };
+
+    if (!readNumber(min))
+        return -1;
+
+    if (i < re.length() && re[i] == '}') // {m}
     {
-        throw std::runtime_error("Invalid range");
+        max = min;
+        return i;
     }
 
-    std::unique_ptr<RENode> result = nullptr;
-    for (char c = from; c <= to; c++)
+    if (i >= re.length() || re[i] != ',')
+        return -1;
+    i++;
+
+    if (i < re.length() && re[i] == '}') // {m,}
     {
-        auto node = std::make_unique<CharNode>(c);
-        if (result == nullptr)
-        {
-            result = std::move(node);
-        }
-        else
-        {
-            result = std::make_unique<BiOpNode>(RENodeType::OR, std::move(result), std::move(node));
-        }
+        max = -1;
+        return i;
     }
 
-    return result;
+    if (!readNumber(max) || i >= re.length() || re[i] != '}') // {m,n}
+        return -1;
+
+    return i;
 }
 
-std::unique_ptr<RENode> RegExpParser::makeFromDigits()
+int RegExpParser::parseUtf8(const std::string &re, int pos, unsigned int &codePoint)
 {
-    std::unique_ptr<RENode> result = nullptr;
-    for (char c = '0'; c <= '9'; c++)
+    auto lead = static_cast<unsigned char>(re[pos]);
+    int length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 0;
+    if (length == 0 || lead > 0xF4 || pos + length > re.length())
+        throw RegExpParserException("Invalid UTF-8", pos);
+
+    codePoint = lead & (0x7F >> length);
+    for (int i = 1; i < length; i++)
     {
-        auto node = std::make_unique<CharNode>(c);
-        if (result == nullptr)
-        {
-            result = std::move(node);
-        }
-        else
-        {
-            result = std::make_unique<BiOpNode>(RENodeType::OR, std::move(result), std::move(node));
-        }
+        auto byte = static_cast<unsigned char>(re[pos + i]);
+        if ((byte & 0xC0) != 0x80)
+            throw RegExpParserException("Invalid UTF-8", pos + i);
+        codePoint = (codePoint << 6) | (byte & 0x3F);
     }
 
-    return result;
+    static const unsigned int minCodePoints[] = {0, 0, 0x80, 0x800, 0x10000};
+    if (codePoint < minCodePoints[length] || codePoint > CodePointSet::maxCodePoint || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        throw RegExpParserException("Invalid UTF-8", pos);
+
+    return pos + length - 1;
 }
 
-std::unique_ptr<RENode> RegExpParser::makeFromEmpty()
+int RegExpParser::parseBracket(const std::string &re, int pos, std::bitset<256> &bytes, CodePointSet &codePoints)
 {
-    std::unique_ptr<RENode> result = nullptr;
-    for (char c = 0; c < 256; c++)
+    // []中的一个元素：单个字符或码位可以作为范围的端点，其余元素（如'\d'、'\p{L}'）不可以
+    struct Item
+    {
+        std::bitset<256> bytes;  // 元素中的字节
+        CodePointSet codePoints; // 元素中的码位
+        bool rawByte = false;    // 是否是'\xhh'表示的原始字节
+    };
+
+    auto readItem = [&](int &i, Item &item) {
+        auto current = re[i];
+        switch (current)
+        {
+        case '|': // []中只能出现'-'
+        case '*':
+        case '+':
+        case '?':
+        case '(':
+        case ')':
+        case '[':
+        case '.':
+        case '-': // '-'只能出现在字符之间，诸如"[-a]"是非法的
+        case ']':
+            throw RegExpParserException(std::string("Unexpected operator '") + current + "'", i);
+        case '\\':
+            item.rawByte = i + 1 < re.length() && re[i + 1] == 'x';
+            i = parseEscape(re, i, item.bytes, item.codePoints);
+            break;
+        default:
+            if (static_cast<unsigned char>(current) >= 0x80) // []中的非ASCII字符按照UTF-8解码为一个码位
+            {
+                unsigned int codePoint;
+                i = parseUtf8(re, i, codePoint);
+                item.codePoints.add(codePoint, codePoint);
+            }
+            else
+                item.bytes.set(static_cast<unsigned char>(current));
+            break;
+        }
+        i++;
+    };
+
+    // 获取单个字符或码位的值，不是单个字符或码位则返回-1
+    auto singleValue = [](const Item &item) -> long {
+        auto &ranges = item.codePoints.getRanges();
+        if (item.bytes.count() == 1 && ranges.empty())
+        {
+            int c = 0;
+            while (!item.bytes.test(c))
+                c++;
+            return c;
+        }
+        if (item.bytes.none() && ranges.size() == 1 && ranges[0].from == ranges[0].to)
+            return ranges[0].from;
+        return -1;
+    };
+
+    int i = pos + 1;
+    bool empty = true;
+    while (true)
     {
-        if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        if (i >= re.length())
+            throw RegExpParserException("Missing ']'", re.length() - 1);
+
+        if (re[i] == ']')
         {
-            auto node = std::make_unique<CharNode>(c);
-            if (result == nullptr)
+            if (empty) // "[]"是非法的
+                throw RegExpParserException("Unexpected operator ']'", i);
+            return i;
+        }
+
+        Item item;
+        readItem(i, item);
+        empty = false;
+
+        // 如果元素之后是'-'，则它和下一个元素构成一个范围，两个元素都必须是单个字符，诸如"[\s-a]"是非法的
+        if (i < re.length() && re[i] == '-')
+        {
+            auto rangePos = i;
+            i++;
+            if (i >= re.length())
+                throw RegExpParserException("Missing ']'", re.length() - 1);
+            if (re[i] == ']')
+                throw RegExpParserException("Unexpected operator '-'", rangePos);
+
+            Item toItem;
+            readItem(i, toItem);
+
+            auto from = singleValue(item);
+            auto to = singleValue(toItem);
+            if (from == -1 || to == -1)
+                throw RegExpParserException("Unexpected operator '-'", rangePos);
+            if (from > to)
+                throw RegExpParserException("Invalid range", rangePos);
+
+            // 有一端是原始字节时表示字节的范围，否则表示码位的范围，其中的ASCII部分按字节处理
+            if (item.rawByte || toItem.rawByte)
             {
-                result = std::move(node);
+                if (to > 0xFF)
+                    throw RegExpParserException("Invalid range", rangePos);
+                bytes |= makeFromRange(static_cast<char>(from), static_cast<char>(to));
             }
             else
             {
-                result = std::make_unique<BiOpNode>(RENodeType::OR, std::move(result), std::move(node));
+                if (from < 0x80)
+                    bytes |= makeFromRange(static_cast<char>(from), static_cast<char>(std::min(to, 0x7FL)));
+                if (to >= 0x80)
+                    codePoints.add(std::max(from, 0x80L), to);
             }
         }
+        else
+        {
+            bytes |= item.bytes;
+            codePoints.add(item.codePoints);
+        }
+    }
+}
+
+int RegExpParser::hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+RENode *RegExpParser::makeFromChars(const std::bitset<256> &bytes, const CodePointSet &codePoints, RENodeArena &arena)
+{
+    // 只含有ASCII码位时，直接作为字节处理
+    std::bitset<256> chars = bytes;
+    CodePointSet nonASCII;
+    for (auto &range : codePoints.getRanges())
+    {
+        for (auto c = range.from; c <= std::min(range.to, 0x7Fu); c++)
+            chars.set(c);
+        if (range.to >= 0x80)
+            nonASCII.add(std::max(range.from, 0x80u), range.to);
     }
 
+    if (!nonASCII.empty())
+        return Utf8Compiler::getInstance().compile(nonASCII, chars, arena);
+
+    if (chars.none())
+        throw RegExpParserException("Empty character class", -1);
+
+    if (chars.count() == 1)
+    {
+        int c = 0;
+        while (!chars.test(c))
+            c++;
+        return arena.make<CharNode>(static_cast<char>(c));
+    }
+
+    return arena.make<CharSetNode>(chars);
+}
+
+std::bitset<256> RegExpParser::makeFromDot()
+{
+    std::bitset<256> result;
+    for (int c = 1; c < 128; c++) // 0表示ε，不能作为字符
+        result.set(c);
+    return result;
+}
+
+std::bitset<256> RegExpParser::makeFromRange(char from, char to)
+{
+    std::bitset<256> result;
+    for (int c = static_cast<unsigned char>(from); c <= static_cast<unsigned char>(to); c++)
+        result.set(c);
+    return result;
+}
+
+std::bitset<256> RegExpParser::makeFromDigits()
+{
+    std::bitset<256> result;
+    for (int c = '0'; c <= '9'; c++)
+        result.set(c);
+    return result;
+}
+
+std::bitset<256> RegExpParser::makeFromEmpty()
+{
+    std::bitset<256> result;
+    for (auto c : {' ', '\t', '\n', '\r'})
+        result.set(static_cast<unsigned char>(c));
     return result;
 }
 
@@ -463,12 +544,41 @@ std::unique_ptr<ParsedChlex> RegExpParser::parse(std::shared_ptr<RawChlex> raw)
 {
     auto parsedChlex = std::make_unique<ParsedChlex>();
 
+    RegExpParserScratch scratch;
     for (auto &i : raw->regExps)
     {
-        auto parsed = parse(i);
+        auto parsed = parse(i, parsedChlex->arena, scratch);
         parsedChlex->regExps.push_back(std::move(parsed));
     }
 
+    parsedChlex->rawChlex = raw;
+    return parsedChlex;
+}
+
+std::unique_ptr<ParsedChlex> RegExpParser::parse(std::shared_ptr<RawChlex> raw, int threadCount)
+{
+    std::vector<RegExpParserScratch> scratches;
+    return parse(raw, threadCount, scratches);
+}
+
+std::unique_ptr<ParsedChlex> RegExpParser::parse(std::shared_ptr<RawChlex> raw, int threadCount, std::vector<RegExpParserScratch> &scratches)
+{
+    auto parsedChlex = std::make_unique<ParsedChlex>();
+    parsedChlex->regExps.resize(raw->regExps.size());
+
+    // 每个正则表达式的解析互不相关，直接写入各自的位置
+    // 每个线程使用自己的分配器，最后全部交给parsedChlex
+    ThreadPool threadPool(threadCount);
+    std::vector<RENodeArena> arenas(threadPool.getThreadCount());
+    if (scratches.size() < threadPool.getThreadCount())
+        scratches.resize(threadPool.getThreadCount());
+    threadPool.run(raw->regExps.size(), [&](int i, int thread) {
+        parsedChlex->regExps[i] = parse(raw->regExps[i], arenas[thread], scratches[thread]);
+    });
+
+    for (auto &arena : arenas)
+        parsedChlex->arena.splice(arena);
+
     parsedChlex->rawChlex = raw;
     return parsedChlex;
 }
\ No newline at end of file
@@ -0,0 +1,137 @@
+/**
+ * @file StateLayout.cc
+ * @brief StateLayout.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "StateLayout.hh"
+
+#include <algorithm>
+
+using namespace chlex;
+
+StateLayout StateLayout::instance;
+
+std::vector<int> StateLayout::breadthFirstOrder(const DFA &dfa)
+{
+    auto &states = dfa.getStates();
+    std::vector<bool> visited(states.size(), false);
+    std::vector<int> order{static_cast<int>(dfa.getStartState().id)};
+    visited[order[0]] = true;
+    for (int i = 0; i < order.size(); i++)
+    {
+        for (auto &path : states.at(order[i])->paths)
+        {
+            if (!visited[path.second])
+            {
+                visited[path.second] = true;
+                order.push_back(path.second);
+            }
+        }
+    }
+
+    // 不可达的状态排在最后
+    for (int i = 0; i < states.size(); i++)
+    {
+        if (!visited[i])
+            order.push_back(i);
+    }
+    return order;
+}
+
+std::unique_ptr<DFA> StateLayout::renumber(const DFA &dfa, const std::vector<int> &order)
+{
+    std::vector<int> newIdOf(order.size());
+    for (int i = 0; i < order.size(); i++)
+        newIdOf[order[i]] = i;
+
+    std::vector<std::unique_ptr<DFAState>> newStates;
+    std::vector<bool> isEndState;
+    for (int i = 0; i < order.size(); i++)
+    {
+        auto &state = *dfa.getStates().at(order[i]);
+        auto it = dfa.getEndStates().find(state.id);
+
+        std::unique_ptr<DFAState> newState;
+        if (it != dfa.getEndStates().end())
+        {
+            auto endState = std::make_unique<DFAEndState>();
+            endState->rule = it->second.get().rule;
+            newState = std::move(endState);
+        }
+        else
+            newState = std::make_unique<DFAState>();
+
+        newState->id = i;
+        for (auto &path : state.paths)
+            newState->paths.emplace_hint(newState->paths.end(), path.first, newIdOf[path.second]);
+
+        isEndState.push_back(it != dfa.getEndStates().end());
+        newStates.push_back(std::move(newState));
+    }
+
+    auto newDFA = std::make_unique<DFA>(*newStates[newIdOf[dfa.getStartState().id]]);
+    for (int i = 0; i < newStates.size(); i++)
+    {
+        if (isEndState[i])
+            newDFA->getEndStates().insert({i, static_cast<DFAEndState &>(*newStates[i])});
+        newDFA->getStates().emplace_hint(newDFA->getStates().end(), i, std::move(newStates[i]));
+    }
+
+    return newDFA;
+}
+
+std::vector<std::uint64_t> StateLayout::profile(const DFA &dfa, const std::string &sample)
+{
+    auto &states = dfa.getStates();
+    std::vector<std::uint64_t> weights(states.size(), 0);
+
+    std::size_t begin = 0;
+    while (begin < sample.size())
+    {
+        auto state = static_cast<int>(dfa.getStartState().id);
+        std::size_t lastEnd = begin;
+        for (auto i = begin; i < sample.size(); i++)
+        {
+            weights[state]++;
+            auto &paths = states.at(state)->paths;
+            auto it = paths.find(sample[i]);
+            if (it == paths.end())
+                break;
+
+            state = it->second;
+            if (dfa.getEndStates().find(state) != dfa.getEndStates().end())
+                lastEnd = i + 1;
+        }
+
+        // 没有匹配时跳过一个字节，与生成的词法分析程序一样从最长匹配之后继续
+        begin = lastEnd == begin ? begin + 1 : lastEnd;
+    }
+    return weights;
+}
+
+std::unique_ptr<DFA> StateLayout::layout(const DFA &dfa, StateOrder order, const std::vector<std::uint64_t> &weights)
+{
+    auto stateOrder = breadthFirstOrder(dfa);
+    if (order == StateOrder::HOTNESS)
+    {
+        // 稳定排序使访问次数相同的状态保持广度优先的顺序，起始状态固定在最前面
+        std::stable_sort(stateOrder.begin() + 1, stateOrder.end(), [&](int a, int b) {
+            auto weightA = a < weights.size() ? weights[a] : 0;
+            auto weightB = b < weights.size() ? weights[b] : 0;
+            return weightA > weightB;
+        });
+    }
+    return renumber(dfa, stateOrder);
+}
+
+std::unique_ptr<MinimizedDFAChlex> StateLayout::layout(std::shared_ptr<MinimizedDFAChlex> chlex, StateOrder order, const std::vector<std::uint64_t> &weights)
+{
+    auto result = std::make_unique<MinimizedDFAChlex>();
+    result->dfaChlex = chlex->dfaChlex;
+    result->minimizedDFA = layout(*chlex->minimizedDFA, order, weights);
+    return result;
+}
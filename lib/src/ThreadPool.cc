@@ -0,0 +1,99 @@
+/**
+ * @file ThreadPool.cc
+ * @brief ThreadPool.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "ThreadPool.hh"
+
+#include <algorithm>
+
+using namespace chlex;
+
+ThreadPool::ThreadPool(int threadCount)
+{
+    if (threadCount <= 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        workers.emplace_back([this, i]() {
+            unsigned int seenGeneration = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wakeCondition.wait(lock, [&]() { return stopping || generation != seenGeneration; });
+                    if (stopping)
+                        return;
+                    seenGeneration = generation;
+                }
+
+                work(i);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--runningWorkers == 0)
+                    doneCondition.notify_one();
+            }
+        });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+
+    for (auto &worker : workers)
+        worker.join();
+}
+
+void ThreadPool::work(int thread)
+{
+    while (true)
+    {
+        auto task = nextTask.fetch_add(1);
+        if (task >= taskCount)
+            return;
+
+        try
+        {
+            (*job)(task, thread);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::run(int taskCount, const std::function<void(int task, int thread)> &function)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &function;
+        this->taskCount = taskCount;
+        nextTask = 0;
+        error = nullptr;
+        runningWorkers = workers.size();
+        generation++;
+    }
+    wakeCondition.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondition.wait(lock, [&]() { return runningWorkers == 0; });
+    job = nullptr;
+
+    if (error)
+        std::rethrow_exception(error);
+}
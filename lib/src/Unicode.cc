@@ -0,0 +1,300 @@
+/**
+ * @file Unicode.cc
+ * @brief Unicode.hh的实现
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "Unicode.hh"
+
+#include <algorithm>
+#include <map>
+
+using namespace chlex;
+
+Utf8Compiler Utf8Compiler::instance;
+
+void CodePointSet::add(unsigned int from, unsigned int to)
+{
+    // 去掉0和代理码位，代理码位把范围分成两段
+    from = std::max(from, 1u);
+    to = std::min(to, maxCodePoint);
+    if (from > to)
+        return;
+
+    if (from < 0xD800 && to > 0xDFFF)
+    {
+        add(from, 0xD7FF);
+        add(0xE000, to);
+        return;
+    }
+    if (from >= 0xD800 && from <= 0xDFFF)
+        from = 0xE000;
+    if (to >= 0xD800 && to <= 0xDFFF)
+        to = 0xD7FF;
+    if (from > to)
+        return;
+
+    // 合并所有与新范围相交或相邻的范围
+    auto first = std::lower_bound(ranges.begin(), ranges.end(), from, [](const CodePointRange &range, unsigned int value) {
+        return range.to + 1 < value;
+    });
+    auto last = first;
+    while (last != ranges.end() && last->from <= to + 1)
+    {
+        from = std::min(from, last->from);
+        to = std::max(to, last->to);
+        last++;
+    }
+
+    first = ranges.erase(first, last);
+    ranges.insert(first, CodePointRange{from, to});
+}
+
+void CodePointSet::add(const CodePointSet &other)
+{
+    for (auto &range : other.ranges)
+        add(range.from, range.to);
+}
+
+CodePointSet CodePointSet::complement() const
+{
+    CodePointSet result;
+    unsigned int next = 1;
+    for (auto &range : ranges)
+    {
+        if (range.from > next)
+            result.add(next, range.from - 1);
+        next = range.to + 1;
+    }
+    if (next <= maxCodePoint)
+        result.add(next, maxCodePoint);
+    return result;
+}
+
+bool CodePointSet::fromCategory(const std::string &name, CodePointSet &result)
+{
+    static const char *names[] = {
+        "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps", "Pe",
+        "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn",
+    };
+
+    // 找出名字匹配的所有类别，一个字母的名字匹配该大类中的所有类别
+    bool selected[sizeof(names) / sizeof(names[0])] = {};
+    bool found = false;
+    for (int i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        if (name.size() == 2 ? name == names[i] : name.size() == 1 && name[0] == names[i][0])
+        {
+            selected[i] = true;
+            found = true;
+        }
+    }
+    if (!found)
+        return false;
+
+    // 表中没有的码位都属于Cn
+    if (selected[static_cast<int>(UnicodeCategory::Cn)])
+    {
+        CodePointSet assigned;
+        for (int i = 0; i < unicodeCategoryRangeCount; i++)
+            assigned.add(unicodeCategoryRanges[i].from, unicodeCategoryRanges[i].to);
+        result.add(assigned.complement());
+    }
+
+    for (int i = 0; i < unicodeCategoryRangeCount; i++)
+        if (selected[static_cast<int>(unicodeCategoryRanges[i].category)])
+            result.add(unicodeCategoryRanges[i].from, unicodeCategoryRanges[i].to);
+
+    return true;
+}
+
+/**
+ * @brief 将码位编码为UTF-8
+ * @param codePoint 码位
+ * @param length 编码长度
+ * @param bytes 编码得到的字节
+ */
+static void encode(unsigned int codePoint, int length, int *bytes)
+{
+    static const int leadMarks[] = {0, 0x00, 0xC0, 0xE0, 0xF0};
+    for (int i = length - 1; i > 0; i--)
+    {
+        bytes[i] = 0x80 | (codePoint & 0x3F);
+        codePoint >>= 6;
+    }
+    bytes[0] = leadMarks[length] | codePoint;
+}
+
+void Utf8Compiler::split(unsigned int from, unsigned int to, std::vector<std::vector<std::pair<int, int>>> &sequences)
+{
+    int length = to <= 0x7F ? 1 : to <= 0x7FF ? 2 : to <= 0xFFFF ? 3 : 4;
+
+    // 如果两端在某个续字节以上的部分不同，而该续字节没有覆盖完整的[80-BF]，则在该处拆开
+    for (int i = 1; i < length; i++)
+    {
+        unsigned int mask = (1u << (6 * i)) - 1;
+        if ((from & ~mask) == (to & ~mask))
+            continue;
+        if ((from & mask) != 0)
+        {
+            split(from, from | mask, sequences);
+            split((from | mask) + 1, to, sequences);
+            return;
+        }
+        if ((to & mask) != mask)
+        {
+            split(from, (to & ~mask) - 1, sequences);
+            split(to & ~mask, to, sequences);
+            return;
+        }
+    }
+
+    int fromBytes[4], toBytes[4];
+    encode(from, length, fromBytes);
+    encode(to, length, toBytes);
+
+    std::vector<std::pair<int, int>> sequence;
+    for (int i = 0; i < length; i++)
+        sequence.push_back({fromBytes[i], toBytes[i]});
+    sequences.push_back(std::move(sequence));
+}
+
+std::vector<std::vector<std::pair<int, int>>> Utf8Compiler::split(const CodePointSet &codePoints)
+{
+    std::vector<std::vector<std::pair<int, int>>> sequences;
+    for (auto &range : codePoints.getRanges())
+    {
+        // 先按照编码长度的边界拆分
+        static const unsigned int lengthEnds[] = {0x7F, 0x7FF, 0xFFFF, 0x10FFFF};
+        auto from = range.from;
+        for (auto end : lengthEnds)
+        {
+            if (from > range.to)
+                break;
+            if (from > end)
+                continue;
+            auto to = std::min(range.to, end);
+            split(from, to, sequences);
+            from = to + 1;
+        }
+    }
+    return sequences;
+}
+
+/**
+ * @brief 创建匹配字符集合中任意一个字节的节点
+ * @param chars 字符集合
+ * @param arena 节点的分配器
+ * @return 只有一个字节时为字符节点，否则为字符集合节点
+ */
+static RENode *makeChars(const std::bitset<256> &chars, RENodeArena &arena)
+{
+    if (chars.count() == 1)
+    {
+        int c = 0;
+        while (!chars.test(c))
+            c++;
+        return arena.make<CharNode>(static_cast<char>(c));
+    }
+    return arena.make<CharSetNode>(chars);
+}
+
+RENode *Utf8Compiler::compileSuffixes(const std::vector<std::vector<std::pair<int, int>>> &suffixes, std::map<std::vector<std::vector<std::pair<int, int>>>, RENode *> &nodes, RENodeArena &arena)
+{
+    // UTF-8编码中没有互为前缀的字节序列，因此剩余部分含有空序列时只有空序列
+    if (suffixes.front().empty())
+        return nullptr;
+
+    auto it = nodes.find(suffixes);
+    if (it != nodes.end())
+        return it->second;
+
+    // 首字节范围的端点把字节划分为若干段，同一段中的字节之后剩余的部分相同
+    std::vector<int> bounds;
+    for (auto &suffix : suffixes)
+    {
+        bounds.push_back(suffix[0].first);
+        bounds.push_back(suffix[0].second + 1);
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    // 之后剩余的部分相同的段合并为一个字符集合，因此每个字节只会进入一个子树
+    std::map<std::vector<std::vector<std::pair<int, int>>>, std::bitset<256>> groups;
+    for (int i = 0; i + 1 < bounds.size(); i++)
+    {
+        std::vector<std::vector<std::pair<int, int>>> rest;
+        for (auto &suffix : suffixes)
+        {
+            if (suffix[0].first <= bounds[i] && bounds[i] <= suffix[0].second)
+                rest.emplace_back(suffix.begin() + 1, suffix.end());
+        }
+        if (rest.empty())
+            continue;
+
+        std::sort(rest.begin(), rest.end());
+        rest.erase(std::unique(rest.begin(), rest.end()), rest.end());
+        auto &chars = groups[rest];
+        for (int c = bounds[i]; c < bounds[i + 1]; c++)
+            chars.set(c);
+    }
+
+    RENode *result = nullptr;
+    for (auto group = groups.rbegin(); group != groups.rend(); group++)
+    {
+        auto node = makeChars(group->second, arena);
+        auto next = compileSuffixes(group->first, nodes, arena);
+        if (next != nullptr)
+            node = arena.make<BiOpNode>(RENodeType::CONCAT, node, next);
+        result = result == nullptr ? node : arena.make<BiOpNode>(RENodeType::OR, node, result);
+    }
+
+    nodes.insert({suffixes, result});
+    return result;
+}
+
+RENode *Utf8Compiler::compile(const CodePointSet &codePoints, const std::bitset<256> &bytes, RENodeArena &arena)
+{
+    auto sequences = split(codePoints);
+
+    // 额外的字节作为只有一个字节的序列加入前缀树，但与多字节序列的首字节相同的字节会破坏前缀树的确定性，单独匹配
+    std::bitset<256> leads, separateBytes;
+    for (auto &sequence : sequences)
+    {
+        if (sequence.size() == 1)
+            continue;
+        for (int c = sequence[0].first; c <= sequence[0].second; c++)
+            leads.set(c);
+    }
+    for (int c = 0; c < 256; c++)
+    {
+        if (!bytes.test(c))
+            continue;
+        if (leads.test(c))
+            separateBytes.set(c);
+        else
+            sequences.push_back({{c, c}});
+    }
+
+    RENode *result = nullptr;
+    if (!sequences.empty())
+    {
+        std::sort(sequences.begin(), sequences.end());
+        sequences.erase(std::unique(sequences.begin(), sequences.end()), sequences.end());
+
+        // 剩余部分相同的前缀共享同一个子树
+        std::map<std::vector<std::vector<std::pair<int, int>>>, RENode *> nodes;
+        result = compileSuffixes(sequences, nodes, arena);
+    }
+
+    if (separateBytes.any())
+    {
+        auto node = makeChars(separateBytes, arena);
+        result = result == nullptr ? node : arena.make<BiOpNode>(RENodeType::OR, result, node);
+    }
+
+    return result;
+}
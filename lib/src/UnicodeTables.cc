@@ -0,0 +1,1664 @@
+/**
+ * @file UnicodeTables.cc
+ * @brief Unicode通用类别表
+ * @details 由以下Python脚本根据Python 3.11自带的Unicode 14.0.0数据生成，不要手动修改：
+ * @code
+ * import unicodedata
+ * runs, start, cur = [], 0, unicodedata.category(chr(0))
+ * for cp in range(1, 0x110000):
+ *     c = unicodedata.category(chr(cp))
+ *     if c != cur:
+ *         runs.append((start, cp - 1, cur))
+ *         start, cur = cp, c
+ * runs.append((start, 0x10FFFF, cur))
+ * # 未分配的码位（Cn）不写入表中，表中没有的码位都属于Cn
+ * @endcode
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "Unicode.hh"
+
+using namespace chlex;
+
+const UnicodeCategoryRange chlex::unicodeCategoryRanges[] = {
+    {0x000000, 0x00001F, UnicodeCategory::Cc}, {0x000020, 0x000020, UnicodeCategory::Zs},
+    {0x000021, 0x000023, UnicodeCategory::Po}, {0x000024, 0x000024, UnicodeCategory::Sc},
+    {0x000025, 0x000027, UnicodeCategory::Po}, {0x000028, 0x000028, UnicodeCategory::Ps},
+    {0x000029, 0x000029, UnicodeCategory::Pe}, {0x00002A, 0x00002A, UnicodeCategory::Po},
+    {0x00002B, 0x00002B, UnicodeCategory::Sm}, {0x00002C, 0x00002C, UnicodeCategory::Po},
+    {0x00002D, 0x00002D, UnicodeCategory::Pd}, {0x00002E, 0x00002F, UnicodeCategory::Po},
+    {0x000030, 0x000039, UnicodeCategory::Nd}, {0x00003A, 0x00003B, UnicodeCategory::Po},
+    {0x00003C, 0x00003E, UnicodeCategory::Sm}, {0x00003F, 0x000040, UnicodeCategory::Po},
+    {0x000041, 0x00005A, UnicodeCategory::Lu}, {0x00005B, 0x00005B, UnicodeCategory::Ps},
+    {0x00005C, 0x00005C, UnicodeCategory::Po}, {0x00005D, 0x00005D, UnicodeCategory::Pe},
+    {0x00005E, 0x00005E, UnicodeCategory::Sk}, {0x00005F, 0x00005F, UnicodeCategory::Pc},
+    {0x000060, 0x000060, UnicodeCategory::Sk}, {0x000061, 0x00007A, UnicodeCategory::Ll},
+    {0x00007B, 0x00007B, UnicodeCategory::Ps}, {0x00007C, 0x00007C, UnicodeCategory::Sm},
+    {0x00007D, 0x00007D, UnicodeCategory::Pe}, {0x00007E, 0x00007E, UnicodeCategory::Sm},
+    {0x00007F, 0x00009F, UnicodeCategory::Cc}, {0x0000A0, 0x0000A0, UnicodeCategory::Zs},
+    {0x0000A1, 0x0000A1, UnicodeCategory::Po}, {0x0000A2, 0x0000A5, UnicodeCategory::Sc},
+    {0x0000A6, 0x0000A6, UnicodeCategory::So}, {0x0000A7, 0x0000A7, UnicodeCategory::Po},
+    {0x0000A8, 0x0000A8, UnicodeCategory::Sk}, {0x0000A9, 0x0000A9, UnicodeCategory::So},
+    {0x0000AA, 0x0000AA, UnicodeCategory::Lo}, {0x0000AB, 0x0000AB, UnicodeCategory::Pi},
+    {0x0000AC, 0x0000AC, UnicodeCategory::Sm}, {0x0000AD, 0x0000AD, UnicodeCategory::Cf},
+    {0x0000AE, 0x0000AE, UnicodeCategory::So}, {0x0000AF, 0x0000AF, UnicodeCategory::Sk},
+    {0x0000B0, 0x0000B0, UnicodeCategory::So}, {0x0000B1, 0x0000B1, UnicodeCategory::Sm},
+    {0x0000B2, 0x0000B3, UnicodeCategory::No}, {0x0000B4, 0x0000B4, UnicodeCategory::Sk},
+    {0x0000B5, 0x0000B5, UnicodeCategory::Ll}, {0x0000B6, 0x0000B7, UnicodeCategory::Po},
+    {0x0000B8, 0x0000B8, UnicodeCategory::Sk}, {0x0000B9, 0x0000B9, UnicodeCategory::No},
+    {0x0000BA, 0x0000BA, UnicodeCategory::Lo}, {0x0000BB, 0x0000BB, UnicodeCategory::Pf},
+    {0x0000BC, 0x0000BE, UnicodeCategory::No}, {0x0000BF, 0x0000BF, UnicodeCategory::Po},
+    {0x0000C0, 0x0000D6, UnicodeCategory::Lu}, {0x0000D7, 0x0000D7, UnicodeCategory::Sm},
+    {0x0000D8, 0x0000DE, UnicodeCategory::Lu}, {0x0000DF, 0x0000F6, UnicodeCategory::Ll},
+    {0x0000F7, 0x0000F7, UnicodeCategory::Sm}, {0x0000F8, 0x0000FF, UnicodeCategory::Ll},
+    {0x000100, 0x000100, UnicodeCategory::Lu}, {0x000101, 0x000101, UnicodeCategory::Ll},
+    {0x000102, 0x000102, UnicodeCategory::Lu}, {0x000103, 0x000103, UnicodeCategory::Ll},
+    {0x000104, 0x000104, UnicodeCategory::Lu}, {0x000105, 0x000105, UnicodeCategory::Ll},
+    {0x000106, 0x000106, UnicodeCategory::Lu}, {0x000107, 0x000107, UnicodeCategory::Ll},
+    {0x000108, 0x000108, UnicodeCategory::Lu}, {0x000109, 0x000109, UnicodeCategory::Ll},
+    {0x00010A, 0x00010A, UnicodeCategory::Lu}, {0x00010B, 0x00010B, UnicodeCategory::Ll},
+    {0x00010C, 0x00010C, UnicodeCategory::Lu}, {0x00010D, 0x00010D, UnicodeCategory::Ll},
+    {0x00010E, 0x00010E, UnicodeCategory::Lu}, {0x00010F, 0x00010F, UnicodeCategory::Ll},
+    {0x000110, 0x000110, UnicodeCategory::Lu}, {0x000111, 0x000111, UnicodeCategory::Ll},
+    {0x000112, 0x000112, UnicodeCategory::Lu}, {0x000113, 0x000113, UnicodeCategory::Ll},
+    {0x000114, 0x000114, UnicodeCategory::Lu}, {0x000115, 0x000115, UnicodeCategory::Ll},
+    {0x000116, 0x000116, UnicodeCategory::Lu}, {0x000117, 0x000117, UnicodeCategory::Ll},
+    {0x000118, 0x000118, UnicodeCategory::Lu}, {0x000119, 0x000119, UnicodeCategory::Ll},
+    {0x00011A, 0x00011A, UnicodeCategory::Lu}, {0x00011B, 0x00011B, UnicodeCategory::Ll},
+    {0x00011C, 0x00011C, UnicodeCategory::Lu}, {0x00011D, 0x00011D, UnicodeCategory::Ll},
+    {0x00011E, 0x00011E, UnicodeCategory::Lu}, {0x00011F, 0x00011F, UnicodeCategory::Ll},
+    {0x000120, 0x000120, UnicodeCategory::Lu}, {0x000121, 0x000121, UnicodeCategory::Ll},
+    {0x000122, 0x000122, UnicodeCategory::Lu}, {0x000123, 0x000123, UnicodeCategory::Ll},
+    {0x000124, 0x000124, UnicodeCategory::Lu}, {0x000125, 0x000125, UnicodeCategory::Ll},
+    {0x000126, 0x000126, UnicodeCategory::Lu}, {0x000127, 0x000127, UnicodeCategory::Ll},
+    {0x000128, 0x000128, UnicodeCategory::Lu}, {0x000129, 0x000129, UnicodeCategory::Ll},
+    {0x00012A, 0x00012A, UnicodeCategory::Lu}, {0x00012B, 0x00012B, UnicodeCategory::Ll},
+    {0x00012C, 0x00012C, UnicodeCategory::Lu}, {0x00012D, 0x00012D, UnicodeCategory::Ll},
+    {0x00012E, 0x00012E, UnicodeCategory::Lu}, {0x00012F, 0x00012F, UnicodeCategory::Ll},
+    {0x000130, 0x000130, UnicodeCategory::Lu}, {0x000131, 0x000131, UnicodeCategory::Ll},
+    {0x000132, 0x000132, UnicodeCategory::Lu}, {0x000133, 0x000133, UnicodeCategory::Ll},
+    {0x000134, 0x000134, UnicodeCategory::Lu}, {0x000135, 0x000135, UnicodeCategory::Ll},
+    {0x000136, 0x000136, UnicodeCategory::Lu}, {0x000137, 0x000138, UnicodeCategory::Ll},
+    {0x000139, 0x000139, UnicodeCategory::Lu}, {0x00013A, 0x00013A, UnicodeCategory::Ll},
+    {0x00013B, 0x00013B, UnicodeCategory::Lu}, {0x00013C, 0x00013C, UnicodeCategory::Ll},
+    {0x00013D, 0x00013D, UnicodeCategory::Lu}, {0x00013E, 0x00013E, UnicodeCategory::Ll},
+    {0x00013F, 0x00013F, UnicodeCategory::Lu}, {0x000140, 0x000140, UnicodeCategory::Ll},
+    {0x000141, 0x000141, UnicodeCategory::Lu}, {0x000142, 0x000142, UnicodeCategory::Ll},
+    {0x000143, 0x000143, UnicodeCategory::Lu}, {0x000144, 0x000144, UnicodeCategory::Ll},
+    {0x000145, 0x000145, UnicodeCategory::Lu}, {0x000146, 0x000146, UnicodeCategory::Ll},
+    {0x000147, 0x000147, UnicodeCategory::Lu}, {0x000148, 0x000149, UnicodeCategory::Ll},
+    {0x00014A, 0x00014A, UnicodeCategory::Lu}, {0x00014B, 0x00014B, UnicodeCategory::Ll},
+    {0x00014C, 0x00014C, UnicodeCategory::Lu}, {0x00014D, 0x00014D, UnicodeCategory::Ll},
+    {0x00014E, 0x00014E, UnicodeCategory::Lu}, {0x00014F, 0x00014F, UnicodeCategory::Ll},
+    {0x000150, 0x000150, UnicodeCategory::Lu}, {0x000151, 0x000151, UnicodeCategory::Ll},
+    {0x000152, 0x000152, UnicodeCategory::Lu}, {0x000153, 0x000153, UnicodeCategory::Ll},
+    {0x000154, 0x000154, UnicodeCategory::Lu}, {0x000155, 0x000155, UnicodeCategory::Ll},
+    {0x000156, 0x000156, UnicodeCategory::Lu}, {0x000157, 0x000157, UnicodeCategory::Ll},
+    {0x000158, 0x000158, UnicodeCategory::Lu}, {0x000159, 0x000159, UnicodeCategory::Ll},
+    {0x00015A, 0x00015A, UnicodeCategory::Lu}, {0x00015B, 0x00015B, UnicodeCategory::Ll},
+    {0x00015C, 0x00015C, UnicodeCategory::Lu}, {0x00015D, 0x00015D, UnicodeCategory::Ll},
+    {0x00015E, 0x00015E, UnicodeCategory::Lu}, {0x00015F, 0x00015F, UnicodeCategory::Ll},
+    {0x000160, 0x000160, UnicodeCategory::Lu}, {0x000161, 0x000161, UnicodeCategory::Ll},
+    {0x000162, 0x000162, UnicodeCategory::Lu}, {0x000163, 0x000163, UnicodeCategory::Ll},
+    {0x000164, 0x000164, UnicodeCategory::Lu}, {0x000165, 0x000165, UnicodeCategory::Ll},
+    {0x000166, 0x000166, UnicodeCategory::Lu}, {0x000167, 0x000167, UnicodeCategory::Ll},
+    {0x000168, 0x000168, UnicodeCategory::Lu}, {0x000169, 0x000169, UnicodeCategory::Ll},
+    {0x00016A, 0x00016A, UnicodeCategory::Lu}, {0x00016B, 0x00016B, UnicodeCategory::Ll},
+    {0x00016C, 0x00016C, UnicodeCategory::Lu}, {0x00016D, 0x00016D, UnicodeCategory::Ll},
+    {0x00016E, 0x00016E, UnicodeCategory::Lu}, {0x00016F, 0x00016F, UnicodeCategory::Ll},
+    {0x000170, 0x000170, UnicodeCategory::Lu}, {0x000171, 0x000171, UnicodeCategory::Ll},
+    {0x000172, 0x000172, UnicodeCategory::Lu}, {0x000173, 0x000173, UnicodeCategory::Ll},
+    {0x000174, 0x000174, UnicodeCategory::Lu}, {0x000175, 0x000175, UnicodeCategory::Ll},
+    {0x000176, 0x000176, UnicodeCategory::Lu}, {0x000177, 0x000177, UnicodeCategory::Ll},
+    {0x000178, 0x000179, UnicodeCategory::Lu}, {0x00017A, 0x00017A, UnicodeCategory::Ll},
+    {0x00017B, 0x00017B, UnicodeCategory::Lu}, {0x00017C, 0x00017C, UnicodeCategory::Ll},
+    {0x00017D, 0x00017D, UnicodeCategory::Lu}, {0x00017E, 0x000180, UnicodeCategory::Ll},
+    {0x000181, 0x000182, UnicodeCategory::Lu}, {0x000183, 0x000183, UnicodeCategory::Ll},
+    {0x000184, 0x000184, UnicodeCategory::Lu}, {0x000185, 0x000185, UnicodeCategory::Ll},
+    {0x000186, 0x000187, UnicodeCategory::Lu}, {0x000188, 0x000188, UnicodeCategory::Ll},
+    {0x000189, 0x00018B, UnicodeCategory::Lu}, {0x00018C, 0x00018D, UnicodeCategory::Ll},
+    {0x00018E, 0x000191, UnicodeCategory::Lu}, {0x000192, 0x000192, UnicodeCategory::Ll},
+    {0x000193, 0x000194, UnicodeCategory::Lu}, {0x000195, 0x000195, UnicodeCategory::Ll},
+    {0x000196, 0x000198, UnicodeCategory::Lu}, {0x000199, 0x00019B, UnicodeCategory::Ll},
+    {0x00019C, 0x00019D, UnicodeCategory::Lu}, {0x00019E, 0x00019E, UnicodeCategory::Ll},
+    {0x00019F, 0x0001A0, UnicodeCategory::Lu}, {0x0001A1, 0x0001A1, UnicodeCategory::Ll},
+    {0x0001A2, 0x0001A2, UnicodeCategory::Lu}, {0x0001A3, 0x0001A3, UnicodeCategory::Ll},
+    {0x0001A4, 0x0001A4, UnicodeCategory::Lu}, {0x0001A5, 0x0001A5, UnicodeCategory::Ll},
+    {0x0001A6, 0x0001A7, UnicodeCategory::Lu}, {0x0001A8, 0x0001A8, UnicodeCategory::Ll},
+    {0x0001A9, 0x0001A9, UnicodeCategory::Lu}, {0x0001AA, 0x0001AB, UnicodeCategory::Ll},
+    {0x0001AC, 0x0001AC, UnicodeCategory::Lu}, {0x0001AD, 0x0001AD, UnicodeCategory::Ll},
+    {0x0001AE, 0x0001AF, UnicodeCategory::Lu}, {0x0001B0, 0x0001B0, UnicodeCategory::Ll},
+    {0x0001B1, 0x0001B3, UnicodeCategory::Lu}, {0x0001B4, 0x0001B4, UnicodeCategory::Ll},
+    {0x0001B5, 0x0001B5, UnicodeCategory::Lu}, {0x0001B6, 0x0001B6, UnicodeCategory::Ll},
+    {0x0001B7, 0x0001B8, UnicodeCategory::Lu}, {0x0001B9, 0x0001BA, UnicodeCategory::Ll},
+    {0x0001BB, 0x0001BB, UnicodeCategory::Lo}, {0x0001BC, 0x0001BC, UnicodeCategory::Lu},
+    {0x0001BD, 0x0001BF, UnicodeCategory::Ll}, {0x0001C0, 0x0001C3, UnicodeCategory::Lo},
+    {0x0001C4, 0x0001C4, UnicodeCategory::Lu}, {0x0001C5, 0x0001C5, UnicodeCategory::Lt},
+    {0x0001C6, 0x0001C6, UnicodeCategory::Ll}, {0x0001C7, 0x0001C7, UnicodeCategory::Lu},
+    {0x0001C8, 0x0001C8, UnicodeCategory::Lt}, {0x0001C9, 0x0001C9, UnicodeCategory::Ll},
+    {0x0001CA, 0x0001CA, UnicodeCategory::Lu}, {0x0001CB, 0x0001CB, UnicodeCategory::Lt},
+    {0x0001CC, 0x0001CC, UnicodeCategory::Ll}, {0x0001CD, 0x0001CD, UnicodeCategory::Lu},
+    {0x0001CE, 0x0001CE, UnicodeCategory::Ll}, {0x0001CF, 0x0001CF, UnicodeCategory::Lu},
+    {0x0001D0, 0x0001D0, UnicodeCategory::Ll}, {0x0001D1, 0x0001D1, UnicodeCategory::Lu},
+    {0x0001D2, 0x0001D2, UnicodeCategory::Ll}, {0x0001D3, 0x0001D3, UnicodeCategory::Lu},
+    {0x0001D4, 0x0001D4, UnicodeCategory::Ll}, {0x0001D5, 0x0001D5, UnicodeCategory::Lu},
+    {0x0001D6, 0x0001D6, UnicodeCategory::Ll}, {0x0001D7, 0x0001D7, UnicodeCategory::Lu},
+    {0x0001D8, 0x0001D8, UnicodeCategory::Ll}, {0x0001D9, 0x0001D9, UnicodeCategory::Lu},
+    {0x0001DA, 0x0001DA, UnicodeCategory::Ll}, {0x0001DB, 0x0001DB, UnicodeCategory::Lu},
+    {0x0001DC, 0x0001DD, UnicodeCategory::Ll}, {0x0001DE, 0x0001DE, UnicodeCategory::Lu},
+    {0x0001DF, 0x0001DF, UnicodeCategory::Ll}, {0x0001E0, 0x0001E0, UnicodeCategory::Lu},
+    {0x0001E1, 0x0001E1, UnicodeCategory::Ll}, {0x0001E2, 0x0001E2, UnicodeCategory::Lu},
+    {0x0001E3, 0x0001E3, UnicodeCategory::Ll}, {0x0001E4, 0x0001E4, UnicodeCategory::Lu},
+    {0x0001E5, 0x0001E5, UnicodeCategory::Ll}, {0x0001E6, 0x0001E6, UnicodeCategory::Lu},
+    {0x0001E7, 0x0001E7, UnicodeCategory::Ll}, {0x0001E8, 0x0001E8, UnicodeCategory::Lu},
+    {0x0001E9, 0x0001E9, UnicodeCategory::Ll}, {0x0001EA, 0x0001EA, UnicodeCategory::Lu},
+    {0x0001EB, 0x0001EB, UnicodeCategory::Ll}, {0x0001EC, 0x0001EC, UnicodeCategory::Lu},
+    {0x0001ED, 0x0001ED, UnicodeCategory::Ll}, {0x0001EE, 0x0001EE, UnicodeCategory::Lu},
+    {0x0001EF, 0x0001F0, UnicodeCategory::Ll}, {0x0001F1, 0x0001F1, UnicodeCategory::Lu},
+    {0x0001F2, 0x0001F2, UnicodeCategory::Lt}, {0x0001F3, 0x0001F3, UnicodeCategory::Ll},
+    {0x0001F4, 0x0001F4, UnicodeCategory::Lu}, {0x0001F5, 0x0001F5, UnicodeCategory::Ll},
+    {0x0001F6, 0x0001F8, UnicodeCategory::Lu}, {0x0001F9, 0x0001F9, UnicodeCategory::Ll},
+    {0x0001FA, 0x0001FA, UnicodeCategory::Lu}, {0x0001FB, 0x0001FB, UnicodeCategory::Ll},
+    {0x0001FC, 0x0001FC, UnicodeCategory::Lu}, {0x0001FD, 0x0001FD, UnicodeCategory::Ll},
+    {0x0001FE, 0x0001FE, UnicodeCategory::Lu}, {0x0001FF, 0x0001FF, UnicodeCategory::Ll},
+    {0x000200, 0x000200, UnicodeCategory::Lu}, {0x000201, 0x000201, UnicodeCategory::Ll},
+    {0x000202, 0x000202, UnicodeCategory::Lu}, {0x000203, 0x000203, UnicodeCategory::Ll},
+    {0x000204, 0x000204, UnicodeCategory::Lu}, {0x000205, 0x000205, UnicodeCategory::Ll},
+    {0x000206, 0x000206, UnicodeCategory::Lu}, {0x000207, 0x000207, UnicodeCategory::Ll},
+    {0x000208, 0x000208, UnicodeCategory::Lu}, {0x000209, 0x000209, UnicodeCategory::Ll},
+    {0x00020A, 0x00020A, UnicodeCategory::Lu}, {0x00020B, 0x00020B, UnicodeCategory::Ll},
+    {0x00020C, 0x00020C, UnicodeCategory::Lu}, {0x00020D, 0x00020D, UnicodeCategory::Ll},
+    {0x00020E, 0x00020E, UnicodeCategory::Lu}, {0x00020F, 0x00020F, UnicodeCategory::Ll},
+    {0x000210, 0x000210, UnicodeCategory::Lu}, {0x000211, 0x000211, UnicodeCategory::Ll},
+    {0x000212, 0x000212, UnicodeCategory::Lu}, {0x000213, 0x000213, UnicodeCategory::Ll},
+    {0x000214, 0x000214, UnicodeCategory::Lu}, {0x000215, 0x000215, UnicodeCategory::Ll},
+    {0x000216, 0x000216, UnicodeCategory::Lu}, {0x000217, 0x000217, UnicodeCategory::Ll},
+    {0x000218, 0x000218, UnicodeCategory::Lu}, {0x000219, 0x000219, UnicodeCategory::Ll},
+    {0x00021A, 0x00021A, UnicodeCategory::Lu}, {0x00021B, 0x00021B, UnicodeCategory::Ll},
+    {0x00021C, 0x00021C, UnicodeCategory::Lu}, {0x00021D, 0x00021D, UnicodeCategory::Ll},
+    {0x00021E, 0x00021E, UnicodeCategory::Lu}, {0x00021F, 0x00021F, UnicodeCategory::Ll},
+    {0x000220, 0x000220, UnicodeCategory::Lu}, {0x000221, 0x000221, UnicodeCategory::Ll},
+    {0x000222, 0x000222, UnicodeCategory::Lu}, {0x000223, 0x000223, UnicodeCategory::Ll},
+    {0x000224, 0x000224, UnicodeCategory::Lu}, {0x000225, 0x000225, UnicodeCategory::Ll},
+    {0x000226, 0x000226, UnicodeCategory::Lu}, {0x000227, 0x000227, UnicodeCategory::Ll},
+    {0x000228, 0x000228, UnicodeCategory::Lu}, {0x000229, 0x000229, UnicodeCategory::Ll},
+    {0x00022A, 0x00022A, UnicodeCategory::Lu}, {0x00022B, 0x00022B, UnicodeCategory::Ll},
+    {0x00022C, 0x00022C, UnicodeCategory::Lu}, {0x00022D, 0x00022D, UnicodeCategory::Ll},
+    {0x00022E, 0x00022E, UnicodeCategory::Lu}, {0x00022F, 0x00022F, UnicodeCategory::Ll},
+    {0x000230, 0x000230, UnicodeCategory::Lu}, {0x000231, 0x000231, UnicodeCategory::Ll},
+    {0x000232, 0x000232, UnicodeCategory::Lu}, {0x000233, 0x000239, UnicodeCategory::Ll},
+    {0x00023A, 0x00023B, UnicodeCategory::Lu}, {0x00023C, 0x00023C, UnicodeCategory::Ll},
+    {0x00023D, 0x00023E, UnicodeCategory::Lu}, {0x00023F, 0x000240, UnicodeCategory::Ll},
+    {0x000241, 0x000241, UnicodeCategory::Lu}, {0x000242, 0x000242, UnicodeCategory::Ll},
+    {0x000243, 0x000246, UnicodeCategory::Lu}, {0x000247, 0x000247, UnicodeCategory::Ll},
+    {0x000248, 0x000248, UnicodeCategory::Lu}, {0x000249, 0x000249, UnicodeCategory::Ll},
+    {0x00024A, 0x00024A, UnicodeCategory::Lu}, {0x00024B, 0x00024B, UnicodeCategory::Ll},
+    {0x00024C, 0x00024C, UnicodeCategory::Lu}, {0x00024D, 0x00024D, UnicodeCategory::Ll},
+    {0x00024E, 0x00024E, UnicodeCategory::Lu}, {0x00024F, 0x000293, UnicodeCategory::Ll},
+    {0x000294, 0x000294, UnicodeCategory::Lo}, {0x000295, 0x0002AF, UnicodeCategory::Ll},
+    {0x0002B0, 0x0002C1, UnicodeCategory::Lm}, {0x0002C2, 0x0002C5, UnicodeCategory::Sk},
+    {0x0002C6, 0x0002D1, UnicodeCategory::Lm}, {0x0002D2, 0x0002DF, UnicodeCategory::Sk},
+    {0x0002E0, 0x0002E4, UnicodeCategory::Lm}, {0x0002E5, 0x0002EB, UnicodeCategory::Sk},
+    {0x0002EC, 0x0002EC, UnicodeCategory::Lm}, {0x0002ED, 0x0002ED, UnicodeCategory::Sk},
+    {0x0002EE, 0x0002EE, UnicodeCategory::Lm}, {0x0002EF, 0x0002FF, UnicodeCategory::Sk},
+    {0x000300, 0x00036F, UnicodeCategory::Mn}, {0x000370, 0x000370, UnicodeCategory::Lu},
+    {0x000371, 0x000371, UnicodeCategory::Ll}, {0x000372, 0x000372, UnicodeCategory::Lu},
+    {0x000373, 0x000373, UnicodeCategory::Ll}, {0x000374, 0x000374, UnicodeCategory::Lm},
+    {0x000375, 0x000375, UnicodeCategory::Sk}, {0x000376, 0x000376, UnicodeCategory::Lu},
+    {0x000377, 0x000377, UnicodeCategory::Ll}, {0x00037A, 0x00037A, UnicodeCategory::Lm},
+    {0x00037B, 0x00037D, UnicodeCategory::Ll}, {0x00037E, 0x00037E, UnicodeCategory::Po},
+    {0x00037F, 0x00037F, UnicodeCategory::Lu}, {0x000384, 0x000385, UnicodeCategory::Sk},
+    {0x000386, 0x000386, UnicodeCategory::Lu}, {0x000387, 0x000387, UnicodeCategory::Po},
+    {0x000388, 0x00038A, UnicodeCategory::Lu}, {0x00038C, 0x00038C, UnicodeCategory::Lu},
+    {0x00038E, 0x00038F, UnicodeCategory::Lu}, {0x000390, 0x000390, UnicodeCategory::Ll},
+    {0x000391, 0x0003A1, UnicodeCategory::Lu}, {0x0003A3, 0x0003AB, UnicodeCategory::Lu},
+    {0x0003AC, 0x0003CE, UnicodeCategory::Ll}, {0x0003CF, 0x0003CF, UnicodeCategory::Lu},
+    {0x0003D0, 0x0003D1, UnicodeCategory::Ll}, {0x0003D2, 0x0003D4, UnicodeCategory::Lu},
+    {0x0003D5, 0x0003D7, UnicodeCategory::Ll}, {0x0003D8, 0x0003D8, UnicodeCategory::Lu},
+    {0x0003D9, 0x0003D9, UnicodeCategory::Ll}, {0x0003DA, 0x0003DA, UnicodeCategory::Lu},
+    {0x0003DB, 0x0003DB, UnicodeCategory::Ll}, {0x0003DC, 0x0003DC, UnicodeCategory::Lu},
+    {0x0003DD, 0x0003DD, UnicodeCategory::Ll}, {0x0003DE, 0x0003DE, UnicodeCategory::Lu},
+    {0x0003DF, 0x0003DF, UnicodeCategory::Ll}, {0x0003E0, 0x0003E0, UnicodeCategory::Lu},
+    {0x0003E1, 0x0003E1, UnicodeCategory::Ll}, {0x0003E2, 0x0003E2, UnicodeCategory::Lu},
+    {0x0003E3, 0x0003E3, UnicodeCategory::Ll}, {0x0003E4, 0x0003E4, UnicodeCategory::Lu},
+    {0x0003E5, 0x0003E5, UnicodeCategory::Ll}, {0x0003E6, 0x0003E6, UnicodeCategory::Lu},
+    {0x0003E7, 0x0003E7, UnicodeCategory::Ll}, {0x0003E8, 0x0003E8, UnicodeCategory::Lu},
+    {0x0003E9, 0x0003E9, UnicodeCategory::Ll}, {0x0003EA, 0x0003EA, UnicodeCategory::Lu},
+    {0x0003EB, 0x0003EB, UnicodeCategory::Ll}, {0x0003EC, 0x0003EC, UnicodeCategory::Lu},
+    {0x0003ED, 0x0003ED, UnicodeCategory::Ll}, {0x0003EE, 0x0003EE, UnicodeCategory::Lu},
+    {0x0003EF, 0x0003F3, UnicodeCategory::Ll}, {0x0003F4, 0x0003F4, UnicodeCategory::Lu},
+    {0x0003F5, 0x0003F5, UnicodeCategory::Ll}, {0x0003F6, 0x0003F6, UnicodeCategory::Sm},
+    {0x0003F7, 0x0003F7, UnicodeCategory::Lu}, {0x0003F8, 0x0003F8, UnicodeCategory::Ll},
+    {0x0003F9, 0x0003FA, UnicodeCategory::Lu}, {0x0003FB, 0x0003FC, UnicodeCategory::Ll},
+    {0x0003FD, 0x00042F, UnicodeCategory::Lu}, {0x000430, 0x00045F, UnicodeCategory::Ll},
+    {0x000460, 0x000460, UnicodeCategory::Lu}, {0x000461, 0x000461, UnicodeCategory::Ll},
+    {0x000462, 0x000462, UnicodeCategory::Lu}, {0x000463, 0x000463, UnicodeCategory::Ll},
+    {0x000464, 0x000464, UnicodeCategory::Lu}, {0x000465, 0x000465, UnicodeCategory::Ll},
+    {0x000466, 0x000466, UnicodeCategory::Lu}, {0x000467, 0x000467, UnicodeCategory::Ll},
+    {0x000468, 0x000468, UnicodeCategory::Lu}, {0x000469, 0x000469, UnicodeCategory::Ll},
+    {0x00046A, 0x00046A, UnicodeCategory::Lu}, {0x00046B, 0x00046B, UnicodeCategory::Ll},
+    {0x00046C, 0x00046C, UnicodeCategory::Lu}, {0x00046D, 0x00046D, UnicodeCategory::Ll},
+    {0x00046E, 0x00046E, UnicodeCategory::Lu}, {0x00046F, 0x00046F, UnicodeCategory::Ll},
+    {0x000470, 0x000470, UnicodeCategory::Lu}, {0x000471, 0x000471, UnicodeCategory::Ll},
+    {0x000472, 0x000472, UnicodeCategory::Lu}, {0x000473, 0x000473, UnicodeCategory::Ll},
+    {0x000474, 0x000474, UnicodeCategory::Lu}, {0x000475, 0x000475, UnicodeCategory::Ll},
+    {0x000476, 0x000476, UnicodeCategory::Lu}, {0x000477, 0x000477, UnicodeCategory::Ll},
+    {0x000478, 0x000478, UnicodeCategory::Lu}, {0x000479, 0x000479, UnicodeCategory::Ll},
+    {0x00047A, 0x00047A, UnicodeCategory::Lu}, {0x00047B, 0x00047B, UnicodeCategory::Ll},
+    {0x00047C, 0x00047C, UnicodeCategory::Lu}, {0x00047D, 0x00047D, UnicodeCategory::Ll},
+    {0x00047E, 0x00047E, UnicodeCategory::Lu}, {0x00047F, 0x00047F, UnicodeCategory::Ll},
+    {0x000480, 0x000480, UnicodeCategory::Lu}, {0x000481, 0x000481, UnicodeCategory::Ll},
+    {0x000482, 0x000482, UnicodeCategory::So}, {0x000483, 0x000487, UnicodeCategory::Mn},
+    {0x000488, 0x000489, UnicodeCategory::Me}, {0x00048A, 0x00048A, UnicodeCategory::Lu},
+    {0x00048B, 0x00048B, UnicodeCategory::Ll}, {0x00048C, 0x00048C, UnicodeCategory::Lu},
+    {0x00048D, 0x00048D, UnicodeCategory::Ll}, {0x00048E, 0x00048E, UnicodeCategory::Lu},
+    {0x00048F, 0x00048F, UnicodeCategory::Ll}, {0x000490, 0x000490, UnicodeCategory::Lu},
+    {0x000491, 0x000491, UnicodeCategory::Ll}, {0x000492, 0x000492, UnicodeCategory::Lu},
+    {0x000493, 0x000493, UnicodeCategory::Ll}, {0x000494, 0x000494, UnicodeCategory::Lu},
+    {0x000495, 0x000495, UnicodeCategory::Ll}, {0x000496, 0x000496, UnicodeCategory::Lu},
+    {0x000497, 0x000497, UnicodeCategory::Ll}, {0x000498, 0x000498, UnicodeCategory::Lu},
+    {0x000499, 0x000499, UnicodeCategory::Ll}, {0x00049A, 0x00049A, UnicodeCategory::Lu},
+    {0x00049B, 0x00049B, UnicodeCategory::Ll}, {0x00049C, 0x00049C, UnicodeCategory::Lu},
+    {0x00049D, 0x00049D, UnicodeCategory::Ll}, {0x00049E, 0x00049E, UnicodeCategory::Lu},
+    {0x00049F, 0x00049F, UnicodeCategory::Ll}, {0x0004A0, 0x0004A0, UnicodeCategory::Lu},
+    {0x0004A1, 0x0004A1, UnicodeCategory::Ll}, {0x0004A2, 0x0004A2, UnicodeCategory::Lu},
+    {0x0004A3, 0x0004A3, UnicodeCategory::Ll}, {0x0004A4, 0x0004A4, UnicodeCategory::Lu},
+    {0x0004A5, 0x0004A5, UnicodeCategory::Ll}, {0x0004A6, 0x0004A6, UnicodeCategory::Lu},
+    {0x0004A7, 0x0004A7, UnicodeCategory::Ll}, {0x0004A8, 0x0004A8, UnicodeCategory::Lu},
+    {0x0004A9, 0x0004A9, UnicodeCategory::Ll}, {0x0004AA, 0x0004AA, UnicodeCategory::Lu},
+    {0x0004AB, 0x0004AB, UnicodeCategory::Ll}, {0x0004AC, 0x0004AC, UnicodeCategory::Lu},
+    {0x0004AD, 0x0004AD, UnicodeCategory::Ll}, {0x0004AE, 0x0004AE, UnicodeCategory::Lu},
+    {0x0004AF, 0x0004AF, UnicodeCategory::Ll}, {0x0004B0, 0x0004B0, UnicodeCategory::Lu},
+    {0x0004B1, 0x0004B1, UnicodeCategory::Ll}, {0x0004B2, 0x0004B2, UnicodeCategory::Lu},
+    {0x0004B3, 0x0004B3, UnicodeCategory::Ll}, {0x0004B4, 0x0004B4, UnicodeCategory::Lu},
+    {0x0004B5, 0x0004B5, UnicodeCategory::Ll}, {0x0004B6, 0x0004B6, UnicodeCategory::Lu},
+    {0x0004B7, 0x0004B7, UnicodeCategory::Ll}, {0x0004B8, 0x0004B8, UnicodeCategory::Lu},
+    {0x0004B9, 0x0004B9, UnicodeCategory::Ll}, {0x0004BA, 0x0004BA, UnicodeCategory::Lu},
+    {0x0004BB, 0x0004BB, UnicodeCategory::Ll}, {0x0004BC, 0x0004BC, UnicodeCategory::Lu},
+    {0x0004BD, 0x0004BD, UnicodeCategory::Ll}, {0x0004BE, 0x0004BE, UnicodeCategory::Lu},
+    {0x0004BF, 0x0004BF, UnicodeCategory::Ll}, {0x0004C0, 0x0004C1, UnicodeCategory::Lu},
+    {0x0004C2, 0x0004C2, UnicodeCategory::Ll}, {0x0004C3, 0x0004C3, UnicodeCategory::Lu},
+    {0x0004C4, 0x0004C4, UnicodeCategory::Ll}, {0x0004C5, 0x0004C5, UnicodeCategory::Lu},
+    {0x0004C6, 0x0004C6, UnicodeCategory::Ll}, {0x0004C7, 0x0004C7, UnicodeCategory::Lu},
+    {0x0004C8, 0x0004C8, UnicodeCategory::Ll}, {0x0004C9, 0x0004C9, UnicodeCategory::Lu},
+    {0x0004CA, 0x0004CA, UnicodeCategory::Ll}, {0x0004CB, 0x0004CB, UnicodeCategory::Lu},
+    {0x0004CC, 0x0004CC, UnicodeCategory::Ll}, {0x0004CD, 0x0004CD, UnicodeCategory::Lu},
+    {0x0004CE, 0x0004CF, UnicodeCategory::Ll}, {0x0004D0, 0x0004D0, UnicodeCategory::Lu},
+    {0x0004D1, 0x0004D1, UnicodeCategory::Ll}, {0x0004D2, 0x0004D2, UnicodeCategory::Lu},
+    {0x0004D3, 0x0004D3, UnicodeCategory::Ll}, {0x0004D4, 0x0004D4, UnicodeCategory::Lu},
+    {0x0004D5, 0x0004D5, UnicodeCategory::Ll}, {0x0004D6, 0x0004D6, UnicodeCategory::Lu},
+    {0x0004D7, 0x0004D7, UnicodeCategory::Ll}, {0x0004D8, 0x0004D8, UnicodeCategory::Lu},
+    {0x0004D9, 0x0004D9, UnicodeCategory::Ll}, {0x0004DA, 0x0004DA, UnicodeCategory::Lu},
+    {0x0004DB, 0x0004DB, UnicodeCategory::Ll}, {0x0004DC, 0x0004DC, UnicodeCategory::Lu},
+    {0x0004DD, 0x0004DD, UnicodeCategory::Ll}, {0x0004DE, 0x0004DE, UnicodeCategory::Lu},
+    {0x0004DF, 0x0004DF, UnicodeCategory::Ll}, {0x0004E0, 0x0004E0, UnicodeCategory::Lu},
+    {0x0004E1, 0x0004E1, UnicodeCategory::Ll}, {0x0004E2, 0x0004E2, UnicodeCategory::Lu},
+    {0x0004E3, 0x0004E3, UnicodeCategory::Ll}, {0x0004E4, 0x0004E4, UnicodeCategory::Lu},
+    {0x0004E5, 0x0004E5, UnicodeCategory::Ll}, {0x0004E6, 0x0004E6, UnicodeCategory::Lu},
+    {0x0004E7, 0x0004E7, UnicodeCategory::Ll}, {0x0004E8, 0x0004E8, UnicodeCategory::Lu},
+    {0x0004E9, 0x0004E9, UnicodeCategory::Ll}, {0x0004EA, 0x0004EA, UnicodeCategory::Lu},
+    {0x0004EB, 0x0004EB, UnicodeCategory::Ll}, {0x0004EC, 0x0004EC, UnicodeCategory::Lu},
+    {0x0004ED, 0x0004ED, UnicodeCategory::Ll}, {0x0004EE, 0x0004EE, UnicodeCategory::Lu},
+    {0x0004EF, 0x0004EF, UnicodeCategory::Ll}, {0x0004F0, 0x0004F0, UnicodeCategory::Lu},
+    {0x0004F1, 0x0004F1, UnicodeCategory::Ll}, {0x0004F2, 0x0004F2, UnicodeCategory::Lu},
+    {0x0004F3, 0x0004F3, UnicodeCategory::Ll}, {0x0004F4, 0x0004F4, UnicodeCategory::Lu},
+    {0x0004F5, 0x0004F5, UnicodeCategory::Ll}, {0x0004F6, 0x0004F6, UnicodeCategory::Lu},
+    {0x0004F7, 0x0004F7, UnicodeCategory::Ll}, {0x0004F8, 0x0004F8, UnicodeCategory::Lu},
+    {0x0004F9, 0x0004F9, UnicodeCategory::Ll}, {0x0004FA, 0x0004FA, UnicodeCategory::Lu},
+    {0x0004FB, 0x0004FB, UnicodeCategory::Ll}, {0x0004FC, 0x0004FC, UnicodeCategory::Lu},
+    {0x0004FD, 0x0004FD, UnicodeCategory::Ll}, {0x0004FE, 0x0004FE, UnicodeCategory::Lu},
+    {0x0004FF, 0x0004FF, UnicodeCategory::Ll}, {0x000500, 0x000500, UnicodeCategory::Lu},
+    {0x000501, 0x000501, UnicodeCategory::Ll}, {0x000502, 0x000502, UnicodeCategory::Lu},
+    {0x000503, 0x000503, UnicodeCategory::Ll}, {0x000504, 0x000504, UnicodeCategory::Lu},
+    {0x000505, 0x000505, UnicodeCategory::Ll}, {0x000506, 0x000506, UnicodeCategory::Lu},
+    {0x000507, 0x000507, UnicodeCategory::Ll}, {0x000508, 0x000508, UnicodeCategory::Lu},
+    {0x000509, 0x000509, UnicodeCategory::Ll}, {0x00050A, 0x00050A, UnicodeCategory::Lu},
+    {0x00050B, 0x00050B, UnicodeCategory::Ll}, {0x00050C, 0x00050C, UnicodeCategory::Lu},
+    {0x00050D, 0x00050D, UnicodeCategory::Ll}, {0x00050E, 0x00050E, UnicodeCategory::Lu},
+    {0x00050F, 0x00050F, UnicodeCategory::Ll}, {0x000510, 0x000510, UnicodeCategory::Lu},
+    {0x000511, 0x000511, UnicodeCategory::Ll}, {0x000512, 0x000512, UnicodeCategory::Lu},
+    {0x000513, 0x000513, UnicodeCategory::Ll}, {0x000514, 0x000514, UnicodeCategory::Lu},
+    {0x000515, 0x000515, UnicodeCategory::Ll}, {0x000516, 0x000516, UnicodeCategory::Lu},
+    {0x000517, 0x000517, UnicodeCategory::Ll}, {0x000518, 0x000518, UnicodeCategory::Lu},
+    {0x000519, 0x000519, UnicodeCategory::Ll}, {0x00051A, 0x00051A, UnicodeCategory::Lu},
+    {0x00051B, 0x00051B, UnicodeCategory::Ll}, {0x00051C, 0x00051C, UnicodeCategory::Lu},
+    {0x00051D, 0x00051D, UnicodeCategory::Ll}, {0x00051E, 0x00051E, UnicodeCategory::Lu},
+    {0x00051F, 0x00051F, UnicodeCategory::Ll}, {0x000520, 0x000520, UnicodeCategory::Lu},
+    {0x000521, 0x000521, UnicodeCategory::Ll}, {0x000522, 0x000522, UnicodeCategory::Lu},
+    {0x000523, 0x000523, UnicodeCategory::Ll}, {0x000524, 0x000524, UnicodeCategory::Lu},
+    {0x000525, 0x000525, UnicodeCategory::Ll}, {0x000526, 0x000526, UnicodeCategory::Lu},
+    {0x000527, 0x000527, UnicodeCategory::Ll}, {0x000528, 0x000528, UnicodeCategory::Lu},
+    {0x000529, 0x000529, UnicodeCategory::Ll}, {0x00052A, 0x00052A, UnicodeCategory::Lu},
+    {0x00052B, 0x00052B, UnicodeCategory::Ll}, {0x00052C, 0x00052C, UnicodeCategory::Lu},
+    {0x00052D, 0x00052D, UnicodeCategory::Ll}, {0x00052E, 0x00052E, UnicodeCategory::Lu},
+    {0x00052F, 0x00052F, UnicodeCategory::Ll}, {0x000531, 0x000556, UnicodeCategory::Lu},
+    {0x000559, 0x000559, UnicodeCategory::Lm}, {0x00055A, 0x00055F, UnicodeCategory::Po},
+    {0x000560, 0x000588, UnicodeCategory::Ll}, {0x000589, 0x000589, UnicodeCategory::Po},
+    {0x00058A, 0x00058A, UnicodeCategory::Pd}, {0x00058D, 0x00058E, UnicodeCategory::So},
+    {0x00058F, 0x00058F, UnicodeCategory::Sc}, {0x000591, 0x0005BD, UnicodeCategory::Mn},
+    {0x0005BE, 0x0005BE, UnicodeCategory::Pd}, {0x0005BF, 0x0005BF, UnicodeCategory::Mn},
+    {0x0005C0, 0x0005C0, UnicodeCategory::Po}, {0x0005C1, 0x0005C2, UnicodeCategory::Mn},
+    {0x0005C3, 0x0005C3, UnicodeCategory::Po}, {0x0005C4, 0x0005C5, UnicodeCategory::Mn},
+    {0x0005C6, 0x0005C6, UnicodeCategory::Po}, {0x0005C7, 0x0005C7, UnicodeCategory::Mn},
+    {0x0005D0, 0x0005EA, UnicodeCategory::Lo}, {0x0005EF, 0x0005F2, UnicodeCategory::Lo},
+    {0x0005F3, 0x0005F4, UnicodeCategory::Po}, {0x000600, 0x000605, UnicodeCategory::Cf},
+    {0x000606, 0x000608, UnicodeCategory::Sm}, {0x000609, 0x00060A, UnicodeCategory::Po},
+    {0x00060B, 0x00060B, UnicodeCategory::Sc}, {0x00060C, 0x00060D, UnicodeCategory::Po},
+    {0x00060E, 0x00060F, UnicodeCategory::So}, {0x000610, 0x00061A, UnicodeCategory::Mn},
+    {0x00061B, 0x00061B, UnicodeCategory::Po}, {0x00061C, 0x00061C, UnicodeCategory::Cf},
+    {0x00061D, 0x00061F, UnicodeCategory::Po}, {0x000620, 0x00063F, UnicodeCategory::Lo},
+    {0x000640, 0x000640, UnicodeCategory::Lm}, {0x000641, 0x00064A, UnicodeCategory::Lo},
+    {0x00064B, 0x00065F, UnicodeCategory::Mn}, {0x000660, 0x000669, UnicodeCategory::Nd},
+    {0x00066A, 0x00066D, UnicodeCategory::Po}, {0x00066E, 0x00066F, UnicodeCategory::Lo},
+    {0x000670, 0x000670, UnicodeCategory::Mn}, {0x000671, 0x0006D3, UnicodeCategory::Lo},
+    {0x0006D4, 0x0006D4, UnicodeCategory::Po}, {0x0006D5, 0x0006D5, UnicodeCategory::Lo},
+    {0x0006D6, 0x0006DC, UnicodeCategory::Mn}, {0x0006DD, 0x0006DD, UnicodeCategory::Cf},
+    {0x0006DE, 0x0006DE, UnicodeCategory::So}, {0x0006DF, 0x0006E4, UnicodeCategory::Mn},
+    {0x0006E5, 0x0006E6, UnicodeCategory::Lm}, {0x0006E7, 0x0006E8, UnicodeCategory::Mn},
+    {0x0006E9, 0x0006E9, UnicodeCategory::So}, {0x0006EA, 0x0006ED, UnicodeCategory::Mn},
+    {0x0006EE, 0x0006EF, UnicodeCategory::Lo}, {0x0006F0, 0x0006F9, UnicodeCategory::Nd},
+    {0x0006FA, 0x0006FC, UnicodeCategory::Lo}, {0x0006FD, 0x0006FE, UnicodeCategory::So},
+    {0x0006FF, 0x0006FF, UnicodeCategory::Lo}, {0x000700, 0x00070D, UnicodeCategory::Po},
+    {0x00070F, 0x00070F, UnicodeCategory::Cf}, {0x000710, 0x000710, UnicodeCategory::Lo},
+    {0x000711, 0x000711, UnicodeCategory::Mn}, {0x000712, 0x00072F, UnicodeCategory::Lo},
+    {0x000730, 0x00074A, UnicodeCategory::Mn}, {0x00074D, 0x0007A5, UnicodeCategory::Lo},
+    {0x0007A6, 0x0007B0, UnicodeCategory::Mn}, {0x0007B1, 0x0007B1, UnicodeCategory::Lo},
+    {0x0007C0, 0x0007C9, UnicodeCategory::Nd}, {0x0007CA, 0x0007EA, UnicodeCategory::Lo},
+    {0x0007EB, 0x0007F3, UnicodeCategory::Mn}, {0x0007F4, 0x0007F5, UnicodeCategory::Lm},
+    {0x0007F6, 0x0007F6, UnicodeCategory::So}, {0x0007F7, 0x0007F9, UnicodeCategory::Po},
+    {0x0007FA, 0x0007FA, UnicodeCategory::Lm}, {0x0007FD, 0x0007FD, UnicodeCategory::Mn},
+    {0x0007FE, 0x0007FF, UnicodeCategory::Sc}, {0x000800, 0x000815, UnicodeCategory::Lo},
+    {0x000816, 0x000819, UnicodeCategory::Mn}, {0x00081A, 0x00081A, UnicodeCategory::Lm},
+    {0x00081B, 0x000823, UnicodeCategory::Mn}, {0x000824, 0x000824, UnicodeCategory::Lm},
+    {0x000825, 0x000827, UnicodeCategory::Mn}, {0x000828, 0x000828, UnicodeCategory::Lm},
+    {0x000829, 0x00082D, UnicodeCategory::Mn}, {0x000830, 0x00083E, UnicodeCategory::Po},
+    {0x000840, 0x000858, UnicodeCategory::Lo}, {0x000859, 0x00085B, UnicodeCategory::Mn},
+    {0x00085E, 0x00085E, UnicodeCategory::Po}, {0x000860, 0x00086A, UnicodeCategory::Lo},
+    {0x000870, 0x000887, UnicodeCategory::Lo}, {0x000888, 0x000888, UnicodeCategory::Sk},
+    {0x000889, 0x00088E, UnicodeCategory::Lo}, {0x000890, 0x000891, UnicodeCategory::Cf},
+    {0x000898, 0x00089F, UnicodeCategory::Mn}, {0x0008A0, 0x0008C8, UnicodeCategory::Lo},
+    {0x0008C9, 0x0008C9, UnicodeCategory::Lm}, {0x0008CA, 0x0008E1, UnicodeCategory::Mn},
+    {0x0008E2, 0x0008E2, UnicodeCategory::Cf}, {0x0008E3, 0x000902, UnicodeCategory::Mn},
+    {0x000903, 0x000903, UnicodeCategory::Mc}, {0x000904, 0x000939, UnicodeCategory::Lo},
+    {0x00093A, 0x00093A, UnicodeCategory::Mn}, {0x00093B, 0x00093B, UnicodeCategory::Mc},
+    {0x00093C, 0x00093C, UnicodeCategory::Mn}, {0x00093D, 0x00093D, UnicodeCategory::Lo},
+    {0x00093E, 0x000940, UnicodeCategory::Mc}, {0x000941, 0x000948, UnicodeCategory::Mn},
+    {0x000949, 0x00094C, UnicodeCategory::Mc}, {0x00094D, 0x00094D, UnicodeCategory::Mn},
+    {0x00094E, 0x00094F, UnicodeCategory::Mc}, {0x000950, 0x000950, UnicodeCategory::Lo},
+    {0x000951, 0x000957, UnicodeCategory::Mn}, {0x000958, 0x000961, UnicodeCategory::Lo},
+    {0x000962, 0x000963, UnicodeCategory::Mn}, {0x000964, 0x000965, UnicodeCategory::Po},
+    {0x000966, 0x00096F, UnicodeCategory::Nd}, {0x000970, 0x000970, UnicodeCategory::Po},
+    {0x000971, 0x000971, UnicodeCategory::Lm}, {0x000972, 0x000980, UnicodeCategory::Lo},
+    {0x000981, 0x000981, UnicodeCategory::Mn}, {0x000982, 0x000983, UnicodeCategory::Mc},
+    {0x000985, 0x00098C, UnicodeCategory::Lo}, {0x00098F, 0x000990, UnicodeCategory::Lo},
+    {0x000993, 0x0009A8, UnicodeCategory::Lo}, {0x0009AA, 0x0009B0, UnicodeCategory::Lo},
+    {0x0009B2, 0x0009B2, UnicodeCategory::Lo}, {0x0009B6, 0x0009B9, UnicodeCategory::Lo},
+    {0x0009BC, 0x0009BC, UnicodeCategory::Mn}, {0x0009BD, 0x0009BD, UnicodeCategory::Lo},
+    {0x0009BE, 0x0009C0, UnicodeCategory::Mc}, {0x0009C1, 0x0009C4, UnicodeCategory::Mn},
+    {0x0009C7, 0x0009C8, UnicodeCategory::Mc}, {0x0009CB, 0x0009CC, UnicodeCategory::Mc},
+    {0x0009CD, 0x0009CD, UnicodeCategory::Mn}, {0x0009CE, 0x0009CE, UnicodeCategory::Lo},
+    {0x0009D7, 0x0009D7, UnicodeCategory::Mc}, {0x0009DC, 0x0009DD, UnicodeCategory::Lo},
+    {0x0009DF, 0x0009E1, UnicodeCategory::Lo}, {0x0009E2, 0x0009E3, UnicodeCategory::Mn},
+    {0x0009E6, 0x0009EF, UnicodeCategory::Nd}, {0x0009F0, 0x0009F1, UnicodeCategory::Lo},
+    {0x0009F2, 0x0009F3, UnicodeCategory::Sc}, {0x0009F4, 0x0009F9, UnicodeCategory::No},
+    {0x0009FA, 0x0009FA, UnicodeCategory::So}, {0x0009FB, 0x0009FB, UnicodeCategory::Sc},
+    {0x0009FC, 0x0009FC, UnicodeCategory::Lo}, {0x0009FD, 0x0009FD, UnicodeCategory::Po},
+    {0x0009FE, 0x0009FE, UnicodeCategory::Mn}, {0x000A01, 0x000A02, UnicodeCategory::Mn},
+    {0x000A03, 0x000A03, UnicodeCategory::Mc}, {0x000A05, 0x000A0A, UnicodeCategory::Lo},
+    {0x000A0F, 0x000A10, UnicodeCategory::Lo}, {0x000A13, 0x000A28, UnicodeCategory::Lo},
+    {0x000A2A, 0x000A30, UnicodeCategory::Lo}, {0x000A32, 0x000A33, UnicodeCategory::Lo},
+    {0x000A35, 0x000A36, UnicodeCategory::Lo}, {0x000A38, 0x000A39, UnicodeCategory::Lo},
+    {0x000A3C, 0x000A3C, UnicodeCategory::Mn}, {0x000A3E, 0x000A40, UnicodeCategory::Mc},
+    {0x000A41, 0x000A42, UnicodeCategory::Mn}, {0x000A47, 0x000A48, UnicodeCategory::Mn},
+    {0x000A4B, 0x000A4D, UnicodeCategory::Mn}, {0x000A51, 0x000A51, UnicodeCategory::Mn},
+    {0x000A59, 0x000A5C, UnicodeCategory::Lo}, {0x000A5E, 0x000A5E, UnicodeCategory::Lo},
+    {0x000A66, 0x000A6F, UnicodeCategory::Nd}, {0x000A70, 0x000A71, UnicodeCategory::Mn},
+    {0x000A72, 0x000A74, UnicodeCategory::Lo}, {0x000A75, 0x000A75, UnicodeCategory::Mn},
+    {0x000A76, 0x000A76, UnicodeCategory::Po}, {0x000A81, 0x000A82, UnicodeCategory::Mn},
+    {0x000A83, 0x000A83, UnicodeCategory::Mc}, {0x000A85, 0x000A8D, UnicodeCategory::Lo},
+    {0x000A8F, 0x000A91, UnicodeCategory::Lo}, {0x000A93, 0x000AA8, UnicodeCategory::Lo},
+    {0x000AAA, 0x000AB0, UnicodeCategory::Lo}, {0x000AB2, 0x000AB3, UnicodeCategory::Lo},
+    {0x000AB5, 0x000AB9, UnicodeCategory::Lo}, {0x000ABC, 0x000ABC, UnicodeCategory::Mn},
+    {0x000ABD, 0x000ABD, UnicodeCategory::Lo}, {0x000ABE, 0x000AC0, UnicodeCategory::Mc},
+    {0x000AC1, 0x000AC5, UnicodeCategory::Mn}, {0x000AC7, 0x000AC8, UnicodeCategory::Mn},
+    {0x000AC9, 0x000AC9, UnicodeCategory::Mc}, {0x000ACB, 0x000ACC, UnicodeCategory::Mc},
+    {0x000ACD, 0x000ACD, UnicodeCategory::Mn}, {0x000AD0, 0x000AD0, UnicodeCategory::Lo},
+    {0x000AE0, 0x000AE1, UnicodeCategory::Lo}, {0x000AE2, 0x000AE3, UnicodeCategory::Mn},
+    {0x000AE6, 0x000AEF, UnicodeCategory::Nd}, {0x000AF0, 0x000AF0, UnicodeCategory::Po},
+    {0x000AF1, 0x000AF1, UnicodeCategory::Sc}, {0x000AF9, 0x000AF9, UnicodeCategory::Lo},
+    {0x000AFA, 0x000AFF, UnicodeCategory::Mn}, {0x000B01, 0x000B01, UnicodeCategory::Mn},
+    {0x000B02, 0x000B03, UnicodeCategory::Mc}, {0x000B05, 0x000B0C, UnicodeCategory::Lo},
+    {0x000B0F, 0x000B10, UnicodeCategory::Lo}, {0x000B13, 0x000B28, UnicodeCategory::Lo},
+    {0x000B2A, 0x000B30, UnicodeCategory::Lo}, {0x000B32, 0x000B33, UnicodeCategory::Lo},
+    {0x000B35, 0x000B39, UnicodeCategory::Lo}, {0x000B3C, 0x000B3C, UnicodeCategory::Mn},
+    {0x000B3D, 0x000B3D, UnicodeCategory::Lo}, {0x000B3E, 0x000B3E, UnicodeCategory::Mc},
+    {0x000B3F, 0x000B3F, UnicodeCategory::Mn}, {0x000B40, 0x000B40, UnicodeCategory::Mc},
+    {0x000B41, 0x000B44, UnicodeCategory::Mn}, {0x000B47, 0x000B48, UnicodeCategory::Mc},
+    {0x000B4B, 0x000B4C, UnicodeCategory::Mc}, {0x000B4D, 0x000B4D, UnicodeCategory::Mn},
+    {0x000B55, 0x000B56, UnicodeCategory::Mn}, {0x000B57, 0x000B57, UnicodeCategory::Mc},
+    {0x000B5C, 0x000B5D, UnicodeCategory::Lo}, {0x000B5F, 0x000B61, UnicodeCategory::Lo},
+    {0x000B62, 0x000B63, UnicodeCategory::Mn}, {0x000B66, 0x000B6F, UnicodeCategory::Nd},
+    {0x000B70, 0x000B70, UnicodeCategory::So}, {0x000B71, 0x000B71, UnicodeCategory::Lo},
+    {0x000B72, 0x000B77, UnicodeCategory::No}, {0x000B82, 0x000B82, UnicodeCategory::Mn},
+    {0x000B83, 0x000B83, UnicodeCategory::Lo}, {0x000B85, 0x000B8A, UnicodeCategory::Lo},
+    {0x000B8E, 0x000B90, UnicodeCategory::Lo}, {0x000B92, 0x000B95, UnicodeCategory::Lo},
+    {0x000B99, 0x000B9A, UnicodeCategory::Lo}, {0x000B9C, 0x000B9C, UnicodeCategory::Lo},
+    {0x000B9E, 0x000B9F, UnicodeCategory::Lo}, {0x000BA3, 0x000BA4, UnicodeCategory::Lo},
+    {0x000BA8, 0x000BAA, UnicodeCategory::Lo}, {0x000BAE, 0x000BB9, UnicodeCategory::Lo},
+    {0x000BBE, 0x000BBF, UnicodeCategory::Mc}, {0x000BC0, 0x000BC0, UnicodeCategory::Mn},
+    {0x000BC1, 0x000BC2, UnicodeCategory::Mc}, {0x000BC6, 0x000BC8, UnicodeCategory::Mc},
+    {0x000BCA, 0x000BCC, UnicodeCategory::Mc}, {0x000BCD, 0x000BCD, UnicodeCategory::Mn},
+    {0x000BD0, 0x000BD0, UnicodeCategory::Lo}, {0x000BD7, 0x000BD7, UnicodeCategory::Mc},
+    {0x000BE6, 0x000BEF, UnicodeCategory::Nd}, {0x000BF0, 0x000BF2, UnicodeCategory::No},
+    {0x000BF3, 0x000BF8, UnicodeCategory::So}, {0x000BF9, 0x000BF9, UnicodeCategory::Sc},
+    {0x000BFA, 0x000BFA, UnicodeCategory::So}, {0x000C00, 0x000C00, UnicodeCategory::Mn},
+    {0x000C01, 0x000C03, UnicodeCategory::Mc}, {0x000C04, 0x000C04, UnicodeCategory::Mn},
+    {0x000C05, 0x000C0C, UnicodeCategory::Lo}, {0x000C0E, 0x000C10, UnicodeCategory::Lo},
+    {0x000C12, 0x000C28, UnicodeCategory::Lo}, {0x000C2A, 0x000C39, UnicodeCategory::Lo},
+    {0x000C3C, 0x000C3C, UnicodeCategory::Mn}, {0x000C3D, 0x000C3D, UnicodeCategory::Lo},
+    {0x000C3E, 0x000C40, UnicodeCategory::Mn}, {0x000C41, 0x000C44, UnicodeCategory::Mc},
+    {0x000C46, 0x000C48, UnicodeCategory::Mn}, {0x000C4A, 0x000C4D, UnicodeCategory::Mn},
+    {0x000C55, 0x000C56, UnicodeCategory::Mn}, {0x000C58, 0x000C5A, UnicodeCategory::Lo},
+    {0x000C5D, 0x000C5D, UnicodeCategory::Lo}, {0x000C60, 0x000C61, UnicodeCategory::Lo},
+    {0x000C62, 0x000C63, UnicodeCategory::Mn}, {0x000C66, 0x000C6F, UnicodeCategory::Nd},
+    {0x000C77, 0x000C77, UnicodeCategory::Po}, {0x000C78, 0x000C7E, UnicodeCategory::No},
+    {0x000C7F, 0x000C7F, UnicodeCategory::So}, {0x000C80, 0x000C80, UnicodeCategory::Lo},
+    {0x000C81, 0x000C81, UnicodeCategory::Mn}, {0x000C82, 0x000C83, UnicodeCategory::Mc},
+    {0x000C84, 0x000C84, UnicodeCategory::Po}, {0x000C85, 0x000C8C, UnicodeCategory::Lo},
+    {0x000C8E, 0x000C90, UnicodeCategory::Lo}, {0x000C92, 0x000CA8, UnicodeCategory::Lo},
+    {0x000CAA, 0x000CB3, UnicodeCategory::Lo}, {0x000CB5, 0x000CB9, UnicodeCategory::Lo},
+    {0x000CBC, 0x000CBC, UnicodeCategory::Mn}, {0x000CBD, 0x000CBD, UnicodeCategory::Lo},
+    {0x000CBE, 0x000CBE, UnicodeCategory::Mc}, {0x000CBF, 0x000CBF, UnicodeCategory::Mn},
+    {0x000CC0, 0x000CC4, UnicodeCategory::Mc}, {0x000CC6, 0x000CC6, UnicodeCategory::Mn},
+    {0x000CC7, 0x000CC8, UnicodeCategory::Mc}, {0x000CCA, 0x000CCB, UnicodeCategory::Mc},
+    {0x000CCC, 0x000CCD, UnicodeCategory::Mn}, {0x000CD5, 0x000CD6, UnicodeCategory::Mc},
+    {0x000CDD, 0x000CDE, UnicodeCategory::Lo}, {0x000CE0, 0x000CE1, UnicodeCategory::Lo},
+    {0x000CE2, 0x000CE3, UnicodeCategory::Mn}, {0x000CE6, 0x000CEF, UnicodeCategory::Nd},
+    {0x000CF1, 0x000CF2, UnicodeCategory::Lo}, {0x000D00, 0x000D01, UnicodeCategory::Mn},
+    {0x000D02, 0x000D03, UnicodeCategory::Mc}, {0x000D04, 0x000D0C, UnicodeCategory::Lo},
+    {0x000D0E, 0x000D10, UnicodeCategory::Lo}, {0x000D12, 0x000D3A, UnicodeCategory::Lo},
+    {0x000D3B, 0x000D3C, UnicodeCategory::Mn}, {0x000D3D, 0x000D3D, UnicodeCategory::Lo},
+    {0x000D3E, 0x000D40, UnicodeCategory::Mc}, {0x000D41, 0x000D44, UnicodeCategory::Mn},
+    {0x000D46, 0x000D48, UnicodeCategory::Mc}, {0x000D4A, 0x000D4C, UnicodeCategory::Mc},
+    {0x000D4D, 0x000D4D, UnicodeCategory::Mn}, {0x000D4E, 0x000D4E, UnicodeCategory::Lo},
+    {0x000D4F, 0x000D4F, UnicodeCategory::So}, {0x000D54, 0x000D56, UnicodeCategory::Lo},
+    {0x000D57, 0x000D57, UnicodeCategory::Mc}, {0x000D58, 0x000D5E, UnicodeCategory::No},
+    {0x000D5F, 0x000D61, UnicodeCategory::Lo}, {0x000D62, 0x000D63, UnicodeCategory::Mn},
+    {0x000D66, 0x000D6F, UnicodeCategory::Nd}, {0x000D70, 0x000D78, UnicodeCategory::No},
+    {0x000D79, 0x000D79, UnicodeCategory::So}, {0x000D7A, 0x000D7F, UnicodeCategory::Lo},
+    {0x000D81, 0x000D81, UnicodeCategory::Mn}, {0x000D82, 0x000D83, UnicodeCategory::Mc},
+    {0x000D85, 0x000D96, UnicodeCategory::Lo}, {0x000D9A, 0x000DB1, UnicodeCategory::Lo},
+    {0x000DB3, 0x000DBB, UnicodeCategory::Lo}, {0x000DBD, 0x000DBD, UnicodeCategory::Lo},
+    {0x000DC0, 0x000DC6, UnicodeCategory::Lo}, {0x000DCA, 0x000DCA, UnicodeCategory::Mn},
+    {0x000DCF, 0x000DD1, UnicodeCategory::Mc}, {0x000DD2, 0x000DD4, UnicodeCategory::Mn},
+    {0x000DD6, 0x000DD6, UnicodeCategory::Mn}, {0x000DD8, 0x000DDF, UnicodeCategory::Mc},
+    {0x000DE6, 0x000DEF, UnicodeCategory::Nd}, {0x000DF2, 0x000DF3, UnicodeCategory::Mc},
+    {0x000DF4, 0x000DF4, UnicodeCategory::Po}, {0x000E01, 0x000E30, UnicodeCategory::Lo},
+    {0x000E31, 0x000E31, UnicodeCategory::Mn}, {0x000E32, 0x000E33, UnicodeCategory::Lo},
+    {0x000E34, 0x000E3A, UnicodeCategory::Mn}, {0x000E3F, 0x000E3F, UnicodeCategory::Sc},
+    {0x000E40, 0x000E45, UnicodeCategory::Lo}, {0x000E46, 0x000E46, UnicodeCategory::Lm},
+    {0x000E47, 0x000E4E, UnicodeCategory::Mn}, {0x000E4F, 0x000E4F, UnicodeCategory::Po},
+    {0x000E50, 0x000E59, UnicodeCategory::Nd}, {0x000E5A, 0x000E5B, UnicodeCategory::Po},
+    {0x000E81, 0x000E82, UnicodeCategory::Lo}, {0x000E84, 0x000E84, UnicodeCategory::Lo},
+    {0x000E86, 0x000E8A, UnicodeCategory::Lo}, {0x000E8C, 0x000EA3, UnicodeCategory::Lo},
+    {0x000EA5, 0x000EA5, UnicodeCategory::Lo}, {0x000EA7, 0x000EB0, UnicodeCategory::Lo},
+    {0x000EB1, 0x000EB1, UnicodeCategory::Mn}, {0x000EB2, 0x000EB3, UnicodeCategory::Lo},
+    {0x000EB4, 0x000EBC, UnicodeCategory::Mn}, {0x000EBD, 0x000EBD, UnicodeCategory::Lo},
+    {0x000EC0, 0x000EC4, UnicodeCategory::Lo}, {0x000EC6, 0x000EC6, UnicodeCategory::Lm},
+    {0x000EC8, 0x000ECD, UnicodeCategory::Mn}, {0x000ED0, 0x000ED9, UnicodeCategory::Nd},
+    {0x000EDC, 0x000EDF, UnicodeCategory::Lo}, {0x000F00, 0x000F00, UnicodeCategory::Lo},
+    {0x000F01, 0x000F03, UnicodeCategory::So}, {0x000F04, 0x000F12, UnicodeCategory::Po},
+    {0x000F13, 0x000F13, UnicodeCategory::So}, {0x000F14, 0x000F14, UnicodeCategory::Po},
+    {0x000F15, 0x000F17, UnicodeCategory::So}, {0x000F18, 0x000F19, UnicodeCategory::Mn},
+    {0x000F1A, 0x000F1F, UnicodeCategory::So}, {0x000F20, 0x000F29, UnicodeCategory::Nd},
+    {0x000F2A, 0x000F33, UnicodeCategory::No}, {0x000F34, 0x000F34, UnicodeCategory::So},
+    {0x000F35, 0x000F35, UnicodeCategory::Mn}, {0x000F36, 0x000F36, UnicodeCategory::So},
+    {0x000F37, 0x000F37, UnicodeCategory::Mn}, {0x000F38, 0x000F38, UnicodeCategory::So},
+    {0x000F39, 0x000F39, UnicodeCategory::Mn}, {0x000F3A, 0x000F3A, UnicodeCategory::Ps},
+    {0x000F3B, 0x000F3B, UnicodeCategory::Pe}, {0x000F3C, 0x000F3C, UnicodeCategory::Ps},
+    {0x000F3D, 0x000F3D, UnicodeCategory::Pe}, {0x000F3E, 0x000F3F, UnicodeCategory::Mc},
+    {0x000F40, 0x000F47, UnicodeCategory::Lo}, {0x000F49, 0x000F6C, UnicodeCategory::Lo},
+    {0x000F71, 0x000F7E, UnicodeCategory::Mn}, {0x000F7F, 0x000F7F, UnicodeCategory::Mc},
+    {0x000F80, 0x000F84, UnicodeCategory::Mn}, {0x000F85, 0x000F85, UnicodeCategory::Po},
+    {0x000F86, 0x000F87, UnicodeCategory::Mn}, {0x000F88, 0x000F8C, UnicodeCategory::Lo},
+    {0x000F8D, 0x000F97, UnicodeCategory::Mn}, {0x000F99, 0x000FBC, UnicodeCategory::Mn},
+    {0x000FBE, 0x000FC5, UnicodeCategory::So}, {0x000FC6, 0x000FC6, UnicodeCategory::Mn},
+    {0x000FC7, 0x000FCC, UnicodeCategory::So}, {0x000FCE, 0x000FCF, UnicodeCategory::So},
+    {0x000FD0, 0x000FD4, UnicodeCategory::Po}, {0x000FD5, 0x000FD8, UnicodeCategory::So},
+    {0x000FD9, 0x000FDA, UnicodeCategory::Po}, {0x001000, 0x00102A, UnicodeCategory::Lo},
+    {0x00102B, 0x00102C, UnicodeCategory::Mc}, {0x00102D, 0x001030, UnicodeCategory::Mn},
+    {0x001031, 0x001031, UnicodeCategory::Mc}, {0x001032, 0x001037, UnicodeCategory::Mn},
+    {0x001038, 0x001038, UnicodeCategory::Mc}, {0x001039, 0x00103A, UnicodeCategory::Mn},
+    {0x00103B, 0x00103C, UnicodeCategory::Mc}, {0x00103D, 0x00103E, UnicodeCategory::Mn},
+    {0x00103F, 0x00103F, UnicodeCategory::Lo}, {0x001040, 0x001049, UnicodeCategory::Nd},
+    {0x00104A, 0x00104F, UnicodeCategory::Po}, {0x001050, 0x001055, UnicodeCategory::Lo},
+    {0x001056, 0x001057, UnicodeCategory::Mc}, {0x001058, 0x001059, UnicodeCategory::Mn},
+    {0x00105A, 0x00105D, UnicodeCategory::Lo}, {0x00105E, 0x001060, UnicodeCategory::Mn},
+    {0x001061, 0x001061, UnicodeCategory::Lo}, {0x001062, 0x001064, UnicodeCategory::Mc},
+    {0x001065, 0x001066, UnicodeCategory::Lo}, {0x001067, 0x00106D, UnicodeCategory::Mc},
+    {0x00106E, 0x001070, UnicodeCategory::Lo}, {0x001071, 0x001074, UnicodeCategory::Mn},
+    {0x001075, 0x001081, UnicodeCategory::Lo}, {0x001082, 0x001082, UnicodeCategory::Mn},
+    {0x001083, 0x001084, UnicodeCategory::Mc}, {0x001085, 0x001086, UnicodeCategory::Mn},
+    {0x001087, 0x00108C, UnicodeCategory::Mc}, {0x00108D, 0x00108D, UnicodeCategory::Mn},
+    {0x00108E, 0x00108E, UnicodeCategory::Lo}, {0x00108F, 0x00108F, UnicodeCategory::Mc},
+    {0x001090, 0x001099, UnicodeCategory::Nd}, {0x00109A, 0x00109C, UnicodeCategory::Mc},
+    {0x00109D, 0x00109D, UnicodeCategory::Mn}, {0x00109E, 0x00109F, UnicodeCategory::So},
+    {0x0010A0, 0x0010C5, UnicodeCategory::Lu}, {0x0010C7, 0x0010C7, UnicodeCategory::Lu},
+    {0x0010CD, 0x0010CD, UnicodeCategory::Lu}, {0x0010D0, 0x0010FA, UnicodeCategory::Ll},
+    {0x0010FB, 0x0010FB, UnicodeCategory::Po}, {0x0010FC, 0x0010FC, UnicodeCategory::Lm},
+    {0x0010FD, 0x0010FF, UnicodeCategory::Ll}, {0x001100, 0x001248, UnicodeCategory::Lo},
+    {0x00124A, 0x00124D, UnicodeCategory::Lo}, {0x001250, 0x001256, UnicodeCategory::Lo},
+    {0x001258, 0x001258, UnicodeCategory::Lo}, {0x00125A, 0x00125D, UnicodeCategory::Lo},
+    {0x001260, 0x001288, UnicodeCategory::Lo}, {0x00128A, 0x00128D, UnicodeCategory::Lo},
+    {0x001290, 0x0012B0, UnicodeCategory::Lo}, {0x0012B2, 0x0012B5, UnicodeCategory::Lo},
+    {0x0012B8, 0x0012BE, UnicodeCategory::Lo}, {0x0012C0, 0x0012C0, UnicodeCategory::Lo},
+    {0x0012C2, 0x0012C5, UnicodeCategory::Lo}, {0x0012C8, 0x0012D6, UnicodeCategory::Lo},
+    {0x0012D8, 0x001310, UnicodeCategory::Lo}, {0x001312, 0x001315, UnicodeCategory::Lo},
+    {0x001318, 0x00135A, UnicodeCategory::Lo}, {0x00135D, 0x00135F, UnicodeCategory::Mn},
+    {0x001360, 0x001368, UnicodeCategory::Po}, {0x001369, 0x00137C, UnicodeCategory::No},
+    {0x001380, 0x00138F, UnicodeCategory::Lo}, {0x001390, 0x001399, UnicodeCategory::So},
+    {0x0013A0, 0x0013F5, UnicodeCategory::Lu}, {0x0013F8, 0x0013FD, UnicodeCategory::Ll},
+    {0x001400, 0x001400, UnicodeCategory::Pd}, {0x001401, 0x00166C, UnicodeCategory::Lo},
+    {0x00166D, 0x00166D, UnicodeCategory::So}, {0x00166E, 0x00166E, UnicodeCategory::Po},
+    {0x00166F, 0x00167F, UnicodeCategory::Lo}, {0x001680, 0x001680, UnicodeCategory::Zs},
+    {0x001681, 0x00169A, UnicodeCategory::Lo}, {0x00169B, 0x00169B, UnicodeCategory::Ps},
+    {0x00169C, 0x00169C, UnicodeCategory::Pe}, {0x0016A0, 0x0016EA, UnicodeCategory::Lo},
+    {0x0016EB, 0x0016ED, UnicodeCategory::Po}, {0x0016EE, 0x0016F0, UnicodeCategory::Nl},
+    {0x0016F1, 0x0016F8, UnicodeCategory::Lo}, {0x001700, 0x001711, UnicodeCategory::Lo},
+    {0x001712, 0x001714, UnicodeCategory::Mn}, {0x001715, 0x001715, UnicodeCategory::Mc},
+    {0x00171F, 0x001731, UnicodeCategory::Lo}, {0x001732, 0x001733, UnicodeCategory::Mn},
+    {0x001734, 0x001734, UnicodeCategory::Mc}, {0x001735, 0x001736, UnicodeCategory::Po},
+    {0x001740, 0x001751, UnicodeCategory::Lo}, {0x001752, 0x001753, UnicodeCategory::Mn},
+    {0x001760, 0x00176C, UnicodeCategory::Lo}, {0x00176E, 0x001770, UnicodeCategory::Lo},
+    {0x001772, 0x001773, UnicodeCategory::Mn}, {0x001780, 0x0017B3, UnicodeCategory::Lo},
+    {0x0017B4, 0x0017B5, UnicodeCategory::Mn}, {0x0017B6, 0x0017B6, UnicodeCategory::Mc},
+    {0x0017B7, 0x0017BD, UnicodeCategory::Mn}, {0x0017BE, 0x0017C5, UnicodeCategory::Mc},
+    {0x0017C6, 0x0017C6, UnicodeCategory::Mn}, {0x0017C7, 0x0017C8, UnicodeCategory::Mc},
+    {0x0017C9, 0x0017D3, UnicodeCategory::Mn}, {0x0017D4, 0x0017D6, UnicodeCategory::Po},
+    {0x0017D7, 0x0017D7, UnicodeCategory::Lm}, {0x0017D8, 0x0017DA, UnicodeCategory::Po},
+    {0x0017DB, 0x0017DB, UnicodeCategory::Sc}, {0x0017DC, 0x0017DC, UnicodeCategory::Lo},
+    {0x0017DD, 0x0017DD, UnicodeCategory::Mn}, {0x0017E0, 0x0017E9, UnicodeCategory::Nd},
+    {0x0017F0, 0x0017F9, UnicodeCategory::No}, {0x001800, 0x001805, UnicodeCategory::Po},
+    {0x001806, 0x001806, UnicodeCategory::Pd}, {0x001807, 0x00180A, UnicodeCategory::Po},
+    {0x00180B, 0x00180D, UnicodeCategory::Mn}, {0x00180E, 0x00180E, UnicodeCategory::Cf},
+    {0x00180F, 0x00180F, UnicodeCategory::Mn}, {0x001810, 0x001819, UnicodeCategory::Nd},
+    {0x001820, 0x001842, UnicodeCategory::Lo}, {0x001843, 0x001843, UnicodeCategory::Lm},
+    {0x001844, 0x001878, UnicodeCategory::Lo}, {0x001880, 0x001884, UnicodeCategory::Lo},
+    {0x001885, 0x001886, UnicodeCategory::Mn}, {0x001887, 0x0018A8, UnicodeCategory::Lo},
+    {0x0018A9, 0x0018A9, UnicodeCategory::Mn}, {0x0018AA, 0x0018AA, UnicodeCategory::Lo},
+    {0x0018B0, 0x0018F5, UnicodeCategory::Lo}, {0x001900, 0x00191E, UnicodeCategory::Lo},
+    {0x001920, 0x001922, UnicodeCategory::Mn}, {0x001923, 0x001926, UnicodeCategory::Mc},
+    {0x001927, 0x001928, UnicodeCategory::Mn}, {0x001929, 0x00192B, UnicodeCategory::Mc},
+    {0x001930, 0x001931, UnicodeCategory::Mc}, {0x001932, 0x001932, UnicodeCategory::Mn},
+    {0x001933, 0x001938, UnicodeCategory::Mc}, {0x001939, 0x00193B, UnicodeCategory::Mn},
+    {0x001940, 0x001940, UnicodeCategory::So}, {0x001944, 0x001945, UnicodeCategory::Po},
+    {0x001946, 0x00194F, UnicodeCategory::Nd}, {0x001950, 0x00196D, UnicodeCategory::Lo},
+    {0x001970, 0x001974, UnicodeCategory::Lo}, {0x001980, 0x0019AB, UnicodeCategory::Lo},
+    {0x0019B0, 0x0019C9, UnicodeCategory::Lo}, {0x0019D0, 0x0019D9, UnicodeCategory::Nd},
+    {0x0019DA, 0x0019DA, UnicodeCategory::No}, {0x0019DE, 0x0019FF, UnicodeCategory::So},
+    {0x001A00, 0x001A16, UnicodeCategory::Lo}, {0x001A17, 0x001A18, UnicodeCategory::Mn},
+    {0x001A19, 0x001A1A, UnicodeCategory::Mc}, {0x001A1B, 0x001A1B, UnicodeCategory::Mn},
+    {0x001A1E, 0x001A1F, UnicodeCategory::Po}, {0x001A20, 0x001A54, UnicodeCategory::Lo},
+    {0x001A55, 0x001A55, UnicodeCategory::Mc}, {0x001A56, 0x001A56, UnicodeCategory::Mn},
+    {0x001A57, 0x001A57, UnicodeCategory::Mc}, {0x001A58, 0x001A5E, UnicodeCategory::Mn},
+    {0x001A60, 0x001A60, UnicodeCategory::Mn}, {0x001A61, 0x001A61, UnicodeCategory::Mc},
+    {0x001A62, 0x001A62, UnicodeCategory::Mn}, {0x001A63, 0x001A64, UnicodeCategory::Mc},
+    {0x001A65, 0x001A6C, UnicodeCategory::Mn}, {0x001A6D, 0x001A72, UnicodeCategory::Mc},
+    {0x001A73, 0x001A7C, UnicodeCategory::Mn}, {0x001A7F, 0x001A7F, UnicodeCategory::Mn},
+    {0x001A80, 0x001A89, UnicodeCategory::Nd}, {0x001A90, 0x001A99, UnicodeCategory::Nd},
+    {0x001AA0, 0x001AA6, UnicodeCategory::Po}, {0x001AA7, 0x001AA7, UnicodeCategory::Lm},
+    {0x001AA8, 0x001AAD, UnicodeCategory::Po}, {0x001AB0, 0x001ABD, UnicodeCategory::Mn},
+    {0x001ABE, 0x001ABE, UnicodeCategory::Me}, {0x001ABF, 0x001ACE, UnicodeCategory::Mn},
+    {0x001B00, 0x001B03, UnicodeCategory::Mn}, {0x001B04, 0x001B04, UnicodeCategory::Mc},
+    {0x001B05, 0x001B33, UnicodeCategory::Lo}, {0x001B34, 0x001B34, UnicodeCategory::Mn},
+    {0x001B35, 0x001B35, UnicodeCategory::Mc}, {0x001B36, 0x001B3A, UnicodeCategory::Mn},
+    {0x001B3B, 0x001B3B, UnicodeCategory::Mc}, {0x001B3C, 0x001B3C, UnicodeCategory::Mn},
+    {0x001B3D, 0x001B41, UnicodeCategory::Mc}, {0x001B42, 0x001B42, UnicodeCategory::Mn},
+    {0x001B43, 0x001B44, UnicodeCategory::Mc}, {0x001B45, 0x001B4C, UnicodeCategory::Lo},
+    {0x001B50, 0x001B59, UnicodeCategory::Nd}, {0x001B5A, 0x001B60, UnicodeCategory::Po},
+    {0x001B61, 0x001B6A, UnicodeCategory::So}, {0x001B6B, 0x001B73, UnicodeCategory::Mn},
+    {0x001B74, 0x001B7C, UnicodeCategory::So}, {0x001B7D, 0x001B7E, UnicodeCategory::Po},
+    {0x001B80, 0x001B81, UnicodeCategory::Mn}, {0x001B82, 0x001B82, UnicodeCategory::Mc},
+    {0x001B83, 0x001BA0, UnicodeCategory::Lo}, {0x001BA1, 0x001BA1, UnicodeCategory::Mc},
+    {0x001BA2, 0x001BA5, UnicodeCategory::Mn}, {0x001BA6, 0x001BA7, UnicodeCategory::Mc},
+    {0x001BA8, 0x001BA9, UnicodeCategory::Mn}, {0x001BAA, 0x001BAA, UnicodeCategory::Mc},
+    {0x001BAB, 0x001BAD, UnicodeCategory::Mn}, {0x001BAE, 0x001BAF, UnicodeCategory::Lo},
+    {0x001BB0, 0x001BB9, UnicodeCategory::Nd}, {0x001BBA, 0x001BE5, UnicodeCategory::Lo},
+    {0x001BE6, 0x001BE6, UnicodeCategory::Mn}, {0x001BE7, 0x001BE7, UnicodeCategory::Mc},
+    {0x001BE8, 0x001BE9, UnicodeCategory::Mn}, {0x001BEA, 0x001BEC, UnicodeCategory::Mc},
+    {0x001BED, 0x001BED, UnicodeCategory::Mn}, {0x001BEE, 0x001BEE, UnicodeCategory::Mc},
+    {0x001BEF, 0x001BF1, UnicodeCategory::Mn}, {0x001BF2, 0x001BF3, UnicodeCategory::Mc},
+    {0x001BFC, 0x001BFF, UnicodeCategory::Po}, {0x001C00, 0x001C23, UnicodeCategory::Lo},
+    {0x001C24, 0x001C2B, UnicodeCategory::Mc}, {0x001C2C, 0x001C33, UnicodeCategory::Mn},
+    {0x001C34, 0x001C35, UnicodeCategory::Mc}, {0x001C36, 0x001C37, UnicodeCategory::Mn},
+    {0x001C3B, 0x001C3F, UnicodeCategory::Po}, {0x001C40, 0x001C49, UnicodeCategory::Nd},
+    {0x001C4D, 0x001C4F, UnicodeCategory::Lo}, {0x001C50, 0x001C59, UnicodeCategory::Nd},
+    {0x001C5A, 0x001C77, UnicodeCategory::Lo}, {0x001C78, 0x001C7D, UnicodeCategory::Lm},
+    {0x001C7E, 0x001C7F, UnicodeCategory::Po}, {0x001C80, 0x001C88, UnicodeCategory::Ll},
+    {0x001C90, 0x001CBA, UnicodeCategory::Lu}, {0x001CBD, 0x001CBF, UnicodeCategory::Lu},
+    {0x001CC0, 0x001CC7, UnicodeCategory::Po}, {0x001CD0, 0x001CD2, UnicodeCategory::Mn},
+    {0x001CD3, 0x001CD3, UnicodeCategory::Po}, {0x001CD4, 0x001CE0, UnicodeCategory::Mn},
+    {0x001CE1, 0x001CE1, UnicodeCategory::Mc}, {0x001CE2, 0x001CE8, UnicodeCategory::Mn},
+    {0x001CE9, 0x001CEC, UnicodeCategory::Lo}, {0x001CED, 0x001CED, UnicodeCategory::Mn},
+    {0x001CEE, 0x001CF3, UnicodeCategory::Lo}, {0x001CF4, 0x001CF4, UnicodeCategory::Mn},
+    {0x001CF5, 0x001CF6, UnicodeCategory::Lo}, {0x001CF7, 0x001CF7, UnicodeCategory::Mc},
+    {0x001CF8, 0x001CF9, UnicodeCategory::Mn}, {0x001CFA, 0x001CFA, UnicodeCategory::Lo},
+    {0x001D00, 0x001D2B, UnicodeCategory::Ll}, {0x001D2C, 0x001D6A, UnicodeCategory::Lm},
+    {0x001D6B, 0x001D77, UnicodeCategory::Ll}, {0x001D78, 0x001D78, UnicodeCategory::Lm},
+    {0x001D79, 0x001D9A, UnicodeCategory::Ll}, {0x001D9B, 0x001DBF, UnicodeCategory::Lm},
+    {0x001DC0, 0x001DFF, UnicodeCategory::Mn}, {0x001E00, 0x001E00, UnicodeCategory::Lu},
+    {0x001E01, 0x001E01, UnicodeCategory::Ll}, {0x001E02, 0x001E02, UnicodeCategory::Lu},
+    {0x001E03, 0x001E03, UnicodeCategory::Ll}, {0x001E04, 0x001E04, UnicodeCategory::Lu},
+    {0x001E05, 0x001E05, UnicodeCategory::Ll}, {0x001E06, 0x001E06, UnicodeCategory::Lu},
+    {0x001E07, 0x001E07, UnicodeCategory::Ll}, {0x001E08, 0x001E08, UnicodeCategory::Lu},
+    {0x001E09, 0x001E09, UnicodeCategory::Ll}, {0x001E0A, 0x001E0A, UnicodeCategory::Lu},
+    {0x001E0B, 0x001E0B, UnicodeCategory::Ll}, {0x001E0C, 0x001E0C, UnicodeCategory::Lu},
+    {0x001E0D, 0x001E0D, UnicodeCategory::Ll}, {0x001E0E, 0x001E0E, UnicodeCategory::Lu},
+    {0x001E0F, 0x001E0F, UnicodeCategory::Ll}, {0x001E10, 0x001E10, UnicodeCategory::Lu},
+    {0x001E11, 0x001E11, UnicodeCategory::Ll}, {0x001E12, 0x001E12, UnicodeCategory::Lu},
+    {0x001E13, 0x001E13, UnicodeCategory::Ll}, {0x001E14, 0x001E14, UnicodeCategory::Lu},
+    {0x001E15, 0x001E15, UnicodeCategory::Ll}, {0x001E16, 0x001E16, UnicodeCategory::Lu},
+    {0x001E17, 0x001E17, UnicodeCategory::Ll}, {0x001E18, 0x001E18, UnicodeCategory::Lu},
+    {0x001E19, 0x001E19, UnicodeCategory::Ll}, {0x001E1A, 0x001E1A, UnicodeCategory::Lu},
+    {0x001E1B, 0x001E1B, UnicodeCategory::Ll}, {0x001E1C, 0x001E1C, UnicodeCategory::Lu},
+    {0x001E1D, 0x001E1D, UnicodeCategory::Ll}, {0x001E1E, 0x001E1E, UnicodeCategory::Lu},
+    {0x001E1F, 0x001E1F, UnicodeCategory::Ll}, {0x001E20, 0x001E20, UnicodeCategory::Lu},
+    {0x001E21, 0x001E21, UnicodeCategory::Ll}, {0x001E22, 0x001E22, UnicodeCategory::Lu},
+    {0x001E23, 0x001E23, UnicodeCategory::Ll}, {0x001E24, 0x001E24, UnicodeCategory::Lu},
+    {0x001E25, 0x001E25, UnicodeCategory::Ll}, {0x001E26, 0x001E26, UnicodeCategory::Lu},
+    {0x001E27, 0x001E27, UnicodeCategory::Ll}, {0x001E28, 0x001E28, UnicodeCategory::Lu},
+    {0x001E29, 0x001E29, UnicodeCategory::Ll}, {0x001E2A, 0x001E2A, UnicodeCategory::Lu},
+    {0x001E2B, 0x001E2B, UnicodeCategory::Ll}, {0x001E2C, 0x001E2C, UnicodeCategory::Lu},
+    {0x001E2D, 0x001E2D, UnicodeCategory::Ll}, {0x001E2E, 0x001E2E, UnicodeCategory::Lu},
+    {0x001E2F, 0x001E2F, UnicodeCategory::Ll}, {0x001E30, 0x001E30, UnicodeCategory::Lu},
+    {0x001E31, 0x001E31, UnicodeCategory::Ll}, {0x001E32, 0x001E32, UnicodeCategory::Lu},
+    {0x001E33, 0x001E33, UnicodeCategory::Ll}, {0x001E34, 0x001E34, UnicodeCategory::Lu},
+    {0x001E35, 0x001E35, UnicodeCategory::Ll}, {0x001E36, 0x001E36, UnicodeCategory::Lu},
+    {0x001E37, 0x001E37, UnicodeCategory::Ll}, {0x001E38, 0x001E38, UnicodeCategory::Lu},
+    {0x001E39, 0x001E39, UnicodeCategory::Ll}, {0x001E3A, 0x001E3A, UnicodeCategory::Lu},
+    {0x001E3B, 0x001E3B, UnicodeCategory::Ll}, {0x001E3C, 0x001E3C, UnicodeCategory::Lu},
+    {0x001E3D, 0x001E3D, UnicodeCategory::Ll}, {0x001E3E, 0x001E3E, UnicodeCategory::Lu},
+    {0x001E3F, 0x001E3F, UnicodeCategory::Ll}, {0x001E40, 0x001E40, UnicodeCategory::Lu},
+    {0x001E41, 0x001E41, UnicodeCategory::Ll}, {0x001E42, 0x001E42, UnicodeCategory::Lu},
+    {0x001E43, 0x001E43, UnicodeCategory::Ll}, {0x001E44, 0x001E44, UnicodeCategory::Lu},
+    {0x001E45, 0x001E45, UnicodeCategory::Ll}, {0x001E46, 0x001E46, UnicodeCategory::Lu},
+    {0x001E47, 0x001E47, UnicodeCategory::Ll}, {0x001E48, 0x001E48, UnicodeCategory::Lu},
+    {0x001E49, 0x001E49, UnicodeCategory::Ll}, {0x001E4A, 0x001E4A, UnicodeCategory::Lu},
+    {0x001E4B, 0x001E4B, UnicodeCategory::Ll}, {0x001E4C, 0x001E4C, UnicodeCategory::Lu},
+    {0x001E4D, 0x001E4D, UnicodeCategory::Ll}, {0x001E4E, 0x001E4E, UnicodeCategory::Lu},
+    {0x001E4F, 0x001E4F, UnicodeCategory::Ll}, {0x001E50, 0x001E50, UnicodeCategory::Lu},
+    {0x001E51, 0x001E51, UnicodeCategory::Ll}, {0x001E52, 0x001E52, UnicodeCategory::Lu},
+    {0x001E53, 0x001E53, UnicodeCategory::Ll}, {0x001E54, 0x001E54, UnicodeCategory::Lu},
+    {0x001E55, 0x001E55, UnicodeCategory::Ll}, {0x001E56, 0x001E56, UnicodeCategory::Lu},
+    {0x001E57, 0x001E57, UnicodeCategory::Ll}, {0x001E58, 0x001E58, UnicodeCategory::Lu},
+    {0x001E59, 0x001E59, UnicodeCategory::Ll}, {0x001E5A, 0x001E5A, UnicodeCategory::Lu},
+    {0x001E5B, 0x001E5B, UnicodeCategory::Ll}, {0x001E5C, 0x001E5C, UnicodeCategory::Lu},
+    {0x001E5D, 0x001E5D, UnicodeCategory::Ll}, {0x001E5E, 0x001E5E, UnicodeCategory::Lu},
+    {0x001E5F, 0x001E5F, UnicodeCategory::Ll}, {0x001E60, 0x001E60, UnicodeCategory::Lu},
+    {0x001E61, 0x001E61, UnicodeCategory::Ll}, {0x001E62, 0x001E62, UnicodeCategory::Lu},
+    {0x001E63, 0x001E63, UnicodeCategory::Ll}, {0x001E64, 0x001E64, UnicodeCategory::Lu},
+    {0x001E65, 0x001E65, UnicodeCategory::Ll}, {0x001E66, 0x001E66, UnicodeCategory::Lu},
+    {0x001E67, 0x001E67, UnicodeCategory::Ll}, {0x001E68, 0x001E68, UnicodeCategory::Lu},
+    {0x001E69, 0x001E69, UnicodeCategory::Ll}, {0x001E6A, 0x001E6A, UnicodeCategory::Lu},
+    {0x001E6B, 0x001E6B, UnicodeCategory::Ll}, {0x001E6C, 0x001E6C, UnicodeCategory::Lu},
+    {0x001E6D, 0x001E6D, UnicodeCategory::Ll}, {0x001E6E, 0x001E6E, UnicodeCategory::Lu},
+    {0x001E6F, 0x001E6F, UnicodeCategory::Ll}, {0x001E70, 0x001E70, UnicodeCategory::Lu},
+    {0x001E71, 0x001E71, UnicodeCategory::Ll}, {0x001E72, 0x001E72, UnicodeCategory::Lu},
+    {0x001E73, 0x001E73, UnicodeCategory::Ll}, {0x001E74, 0x001E74, UnicodeCategory::Lu},
+    {0x001E75, 0x001E75, UnicodeCategory::Ll}, {0x001E76, 0x001E76, UnicodeCategory::Lu},
+    {0x001E77, 0x001E77, UnicodeCategory::Ll}, {0x001E78, 0x001E78, UnicodeCategory::Lu},
+    {0x001E79, 0x001E79, UnicodeCategory::Ll}, {0x001E7A, 0x001E7A, UnicodeCategory::Lu},
+    {0x001E7B, 0x001E7B, UnicodeCategory::Ll}, {0x001E7C, 0x001E7C, UnicodeCategory::Lu},
+    {0x001E7D, 0x001E7D, UnicodeCategory::Ll}, {0x001E7E, 0x001E7E, UnicodeCategory::Lu},
+    {0x001E7F, 0x001E7F, UnicodeCategory::Ll}, {0x001E80, 0x001E80, UnicodeCategory::Lu},
+    {0x001E81, 0x001E81, UnicodeCategory::Ll}, {0x001E82, 0x001E82, UnicodeCategory::Lu},
+    {0x001E83, 0x001E83, UnicodeCategory::Ll}, {0x001E84, 0x001E84, UnicodeCategory::Lu},
+    {0x001E85, 0x001E85, UnicodeCategory::Ll}, {0x001E86, 0x001E86, UnicodeCategory::Lu},
+    {0x001E87, 0x001E87, UnicodeCategory::Ll}, {0x001E88, 0x001E88, UnicodeCategory::Lu},
+    {0x001E89, 0x001E89, UnicodeCategory::Ll}, {0x001E8A, 0x001E8A, UnicodeCategory::Lu},
+    {0x001E8B, 0x001E8B, UnicodeCategory::Ll}, {0x001E8C, 0x001E8C, UnicodeCategory::Lu},
+    {0x001E8D, 0x001E8D, UnicodeCategory::Ll}, {0x001E8E, 0x001E8E, UnicodeCategory::Lu},
+    {0x001E8F, 0x001E8F, UnicodeCategory::Ll}, {0x001E90, 0x001E90, UnicodeCategory::Lu},
+    {0x001E91, 0x001E91, UnicodeCategory::Ll}, {0x001E92, 0x001E92, UnicodeCategory::Lu},
+    {0x001E93, 0x001E93, UnicodeCategory::Ll}, {0x001E94, 0x001E94, UnicodeCategory::Lu},
+    {0x001E95, 0x001E9D, UnicodeCategory::Ll}, {0x001E9E, 0x001E9E, UnicodeCategory::Lu},
+    {0x001E9F, 0x001E9F, UnicodeCategory::Ll}, {0x001EA0, 0x001EA0, UnicodeCategory::Lu},
+    {0x001EA1, 0x001EA1, UnicodeCategory::Ll}, {0x001EA2, 0x001EA2, UnicodeCategory::Lu},
+    {0x001EA3, 0x001EA3, UnicodeCategory::Ll}, {0x001EA4, 0x001EA4, UnicodeCategory::Lu},
+    {0x001EA5, 0x001EA5, UnicodeCategory::Ll}, {0x001EA6, 0x001EA6, UnicodeCategory::Lu},
+    {0x001EA7, 0x001EA7, UnicodeCategory::Ll}, {0x001EA8, 0x001EA8, UnicodeCategory::Lu},
+    {0x001EA9, 0x001EA9, UnicodeCategory::Ll}, {0x001EAA, 0x001EAA, UnicodeCategory::Lu},
+    {0x001EAB, 0x001EAB, UnicodeCategory::Ll}, {0x001EAC, 0x001EAC, UnicodeCategory::Lu},
+    {0x001EAD, 0x001EAD, UnicodeCategory::Ll}, {0x001EAE, 0x001EAE, UnicodeCategory::Lu},
+    {0x001EAF, 0x001EAF, UnicodeCategory::Ll}, {0x001EB0, 0x001EB0, UnicodeCategory::Lu},
+    {0x001EB1, 0x001EB1, UnicodeCategory::Ll}, {0x001EB2, 0x001EB2, UnicodeCategory::Lu},
+    {0x001EB3, 0x001EB3, UnicodeCategory::Ll}, {0x001EB4, 0x001EB4, UnicodeCategory::Lu},
+    {0x001EB5, 0x001EB5, UnicodeCategory::Ll}, {0x001EB6, 0x001EB6, UnicodeCategory::Lu},
+    {0x001EB7, 0x001EB7, UnicodeCategory::Ll}, {0x001EB8, 0x001EB8, UnicodeCategory::Lu},
+    {0x001EB9, 0x001EB9, UnicodeCategory::Ll}, {0x001EBA, 0x001EBA, UnicodeCategory::Lu},
+    {0x001EBB, 0x001EBB, UnicodeCategory::Ll}, {0x001EBC, 0x001EBC, UnicodeCategory::Lu},
+    {0x001EBD, 0x001EBD, UnicodeCategory::Ll}, {0x001EBE, 0x001EBE, UnicodeCategory::Lu},
+    {0x001EBF, 0x001EBF, UnicodeCategory::Ll}, {0x001EC0, 0x001EC0, UnicodeCategory::Lu},
+    {0x001EC1, 0x001EC1, UnicodeCategory::Ll}, {0x001EC2, 0x001EC2, UnicodeCategory::Lu},
+    {0x001EC3, 0x001EC3, UnicodeCategory::Ll}, {0x001EC4, 0x001EC4, UnicodeCategory::Lu},
+    {0x001EC5, 0x001EC5, UnicodeCategory::Ll}, {0x001EC6, 0x001EC6, UnicodeCategory::Lu},
+    {0x001EC7, 0x001EC7, UnicodeCategory::Ll}, {0x001EC8, 0x001EC8, UnicodeCategory::Lu},
+    {0x001EC9, 0x001EC9, UnicodeCategory::Ll}, {0x001ECA, 0x001ECA, UnicodeCategory::Lu},
+    {0x001ECB, 0x001ECB, UnicodeCategory::Ll}, {0x001ECC, 0x001ECC, UnicodeCategory::Lu},
+    {0x001ECD, 0x001ECD, UnicodeCategory::Ll}, {0x001ECE, 0x001ECE, UnicodeCategory::Lu},
+    {0x001ECF, 0x001ECF, UnicodeCategory::Ll}, {0x001ED0, 0x001ED0, UnicodeCategory::Lu},
+    {0x001ED1, 0x001ED1, UnicodeCategory::Ll}, {0x001ED2, 0x001ED2, UnicodeCategory::Lu},
+    {0x001ED3, 0x001ED3, UnicodeCategory::Ll}, {0x001ED4, 0x001ED4, UnicodeCategory::Lu},
+    {0x001ED5, 0x001ED5, UnicodeCategory::Ll}, {0x001ED6, 0x001ED6, UnicodeCategory::Lu},
+    {0x001ED7, 0x001ED7, UnicodeCategory::Ll}, {0x001ED8, 0x001ED8, UnicodeCategory::Lu},
+    {0x001ED9, 0x001ED9, UnicodeCategory::Ll}, {0x001EDA, 0x001EDA, UnicodeCategory::Lu},
+    {0x001EDB, 0x001EDB, UnicodeCategory::Ll}, {0x001EDC, 0x001EDC, UnicodeCategory::Lu},
+    {0x001EDD, 0x001EDD, UnicodeCategory::Ll}, {0x001EDE, 0x001EDE, UnicodeCategory::Lu},
+    {0x001EDF, 0x001EDF, UnicodeCategory::Ll}, {0x001EE0, 0x001EE0, UnicodeCategory::Lu},
+    {0x001EE1, 0x001EE1, UnicodeCategory::Ll}, {0x001EE2, 0x001EE2, UnicodeCategory::Lu},
+    {0x001EE3, 0x001EE3, UnicodeCategory::Ll}, {0x001EE4, 0x001EE4, UnicodeCategory::Lu},
+    {0x001EE5, 0x001EE5, UnicodeCategory::Ll}, {0x001EE6, 0x001EE6, UnicodeCategory::Lu},
+    {0x001EE7, 0x001EE7, UnicodeCategory::Ll}, {0x001EE8, 0x001EE8, UnicodeCategory::Lu},
+    {0x001EE9, 0x001EE9, UnicodeCategory::Ll}, {0x001EEA, 0x001EEA, UnicodeCategory::Lu},
+    {0x001EEB, 0x001EEB, UnicodeCategory::Ll}, {0x001EEC, 0x001EEC, UnicodeCategory::Lu},
+    {0x001EED, 0x001EED, UnicodeCategory::Ll}, {0x001EEE, 0x001EEE, UnicodeCategory::Lu},
+    {0x001EEF, 0x001EEF, UnicodeCategory::Ll}, {0x001EF0, 0x001EF0, UnicodeCategory::Lu},
+    {0x001EF1, 0x001EF1, UnicodeCategory::Ll}, {0x001EF2, 0x001EF2, UnicodeCategory::Lu},
+    {0x001EF3, 0x001EF3, UnicodeCategory::Ll}, {0x001EF4, 0x001EF4, UnicodeCategory::Lu},
+    {0x001EF5, 0x001EF5, UnicodeCategory::Ll}, {0x001EF6, 0x001EF6, UnicodeCategory::Lu},
+    {0x001EF7, 0x001EF7, UnicodeCategory::Ll}, {0x001EF8, 0x001EF8, UnicodeCategory::Lu},
+    {0x001EF9, 0x001EF9, UnicodeCategory::Ll}, {0x001EFA, 0x001EFA, UnicodeCategory::Lu},
+    {0x001EFB, 0x001EFB, UnicodeCategory::Ll}, {0x001EFC, 0x001EFC, UnicodeCategory::Lu},
+    {0x001EFD, 0x001EFD, UnicodeCategory::Ll}, {0x001EFE, 0x001EFE, UnicodeCategory::Lu},
+    {0x001EFF, 0x001F07, UnicodeCategory::Ll}, {0x001F08, 0x001F0F, UnicodeCategory::Lu},
+    {0x001F10, 0x001F15, UnicodeCategory::Ll}, {0x001F18, 0x001F1D, UnicodeCategory::Lu},
+    {0x001F20, 0x001F27, UnicodeCategory::Ll}, {0x001F28, 0x001F2F, UnicodeCategory::Lu},
+    {0x001F30, 0x001F37, UnicodeCategory::Ll}, {0x001F38, 0x001F3F, UnicodeCategory::Lu},
+    {0x001F40, 0x001F45, UnicodeCategory::Ll}, {0x001F48, 0x001F4D, UnicodeCategory::Lu},
+    {0x001F50, 0x001F57, UnicodeCategory::Ll}, {0x001F59, 0x001F59, UnicodeCategory::Lu},
+    {0x001F5B, 0x001F5B, UnicodeCategory::Lu}, {0x001F5D, 0x001F5D, UnicodeCategory::Lu},
+    {0x001F5F, 0x001F5F, UnicodeCategory::Lu}, {0x001F60, 0x001F67, UnicodeCategory::Ll},
+    {0x001F68, 0x001F6F, UnicodeCategory::Lu}, {0x001F70, 0x001F7D, UnicodeCategory::Ll},
+    {0x001F80, 0x001F87, UnicodeCategory::Ll}, {0x001F88, 0x001F8F, UnicodeCategory::Lt},
+    {0x001F90, 0x001F97, UnicodeCategory::Ll}, {0x001F98, 0x001F9F, UnicodeCategory::Lt},
+    {0x001FA0, 0x001FA7, UnicodeCategory::Ll}, {0x001FA8, 0x001FAF, UnicodeCategory::Lt},
+    {0x001FB0, 0x001FB4, UnicodeCategory::Ll}, {0x001FB6, 0x001FB7, UnicodeCategory::Ll},
+    {0x001FB8, 0x001FBB, UnicodeCategory::Lu}, {0x001FBC, 0x001FBC, UnicodeCategory::Lt},
+    {0x001FBD, 0x001FBD, UnicodeCategory::Sk}, {0x001FBE, 0x001FBE, UnicodeCategory::Ll},
+    {0x001FBF, 0x001FC1, UnicodeCategory::Sk}, {0x001FC2, 0x001FC4, UnicodeCategory::Ll},
+    {0x001FC6, 0x001FC7, UnicodeCategory::Ll}, {0x001FC8, 0x001FCB, UnicodeCategory::Lu},
+    {0x001FCC, 0x001FCC, UnicodeCategory::Lt}, {0x001FCD, 0x001FCF, UnicodeCategory::Sk},
+    {0x001FD0, 0x001FD3, UnicodeCategory::Ll}, {0x001FD6, 0x001FD7, UnicodeCategory::Ll},
+    {0x001FD8, 0x001FDB, UnicodeCategory::Lu}, {0x001FDD, 0x001FDF, UnicodeCategory::Sk},
+    {0x001FE0, 0x001FE7, UnicodeCategory::Ll}, {0x001FE8, 0x001FEC, UnicodeCategory::Lu},
+    {0x001FED, 0x001FEF, UnicodeCategory::Sk}, {0x001FF2, 0x001FF4, UnicodeCategory::Ll},
+    {0x001FF6, 0x001FF7, UnicodeCategory::Ll}, {0x001FF8, 0x001FFB, UnicodeCategory::Lu},
+    {0x001FFC, 0x001FFC, UnicodeCategory::Lt}, {0x001FFD, 0x001FFE, UnicodeCategory::Sk},
+    {0x002000, 0x00200A, UnicodeCategory::Zs}, {0x00200B, 0x00200F, UnicodeCategory::Cf},
+    {0x002010, 0x002015, UnicodeCategory::Pd}, {0x002016, 0x002017, UnicodeCategory::Po},
+    {0x002018, 0x002018, UnicodeCategory::Pi}, {0x002019, 0x002019, UnicodeCategory::Pf},
+    {0x00201A, 0x00201A, UnicodeCategory::Ps}, {0x00201B, 0x00201C, UnicodeCategory::Pi},
+    {0x00201D, 0x00201D, UnicodeCategory::Pf}, {0x00201E, 0x00201E, UnicodeCategory::Ps},
+    {0x00201F, 0x00201F, UnicodeCategory::Pi}, {0x002020, 0x002027, UnicodeCategory::Po},
+    {0x002028, 0x002028, UnicodeCategory::Zl}, {0x002029, 0x002029, UnicodeCategory::Zp},
+    {0x00202A, 0x00202E, UnicodeCategory::Cf}, {0x00202F, 0x00202F, UnicodeCategory::Zs},
+    {0x002030, 0x002038, UnicodeCategory::Po}, {0x002039, 0x002039, UnicodeCategory::Pi},
+    {0x00203A, 0x00203A, UnicodeCategory::Pf}, {0x00203B, 0x00203E, UnicodeCategory::Po},
+    {0x00203F, 0x002040, UnicodeCategory::Pc}, {0x002041, 0x002043, UnicodeCategory::Po},
+    {0x002044, 0x002044, UnicodeCategory::Sm}, {0x002045, 0x002045, UnicodeCategory::Ps},
+    {0x002046, 0x002046, UnicodeCategory::Pe}, {0x002047, 0x002051, UnicodeCategory::Po},
+    {0x002052, 0x002052, UnicodeCategory::Sm}, {0x002053, 0x002053, UnicodeCategory::Po},
+    {0x002054, 0x002054, UnicodeCategory::Pc}, {0x002055, 0x00205E, UnicodeCategory::Po},
+    {0x00205F, 0x00205F, UnicodeCategory::Zs}, {0x002060, 0x002064, UnicodeCategory::Cf},
+    {0x002066, 0x00206F, UnicodeCategory::Cf}, {0x002070, 0x002070, UnicodeCategory::No},
+    {0x002071, 0x002071, UnicodeCategory::Lm}, {0x002074, 0x002079, UnicodeCategory::No},
+    {0x00207A, 0x00207C, UnicodeCategory::Sm}, {0x00207D, 0x00207D, UnicodeCategory::Ps},
+    {0x00207E, 0x00207E, UnicodeCategory::Pe}, {0x00207F, 0x00207F, UnicodeCategory::Lm},
+    {0x002080, 0x002089, UnicodeCategory::No}, {0x00208A, 0x00208C, UnicodeCategory::Sm},
+    {0x00208D, 0x00208D, UnicodeCategory::Ps}, {0x00208E, 0x00208E, UnicodeCategory::Pe},
+    {0x002090, 0x00209C, UnicodeCategory::Lm}, {0x0020A0, 0x0020C0, UnicodeCategory::Sc},
+    {0x0020D0, 0x0020DC, UnicodeCategory::Mn}, {0x0020DD, 0x0020E0, UnicodeCategory::Me},
+    {0x0020E1, 0x0020E1, UnicodeCategory::Mn}, {0x0020E2, 0x0020E4, UnicodeCategory::Me},
+    {0x0020E5, 0x0020F0, UnicodeCategory::Mn}, {0x002100, 0x002101, UnicodeCategory::So},
+    {0x002102, 0x002102, UnicodeCategory::Lu}, {0x002103, 0x002106, UnicodeCategory::So},
+    {0x002107, 0x002107, UnicodeCategory::Lu}, {0x002108, 0x002109, UnicodeCategory::So},
+    {0x00210A, 0x00210A, UnicodeCategory::Ll}, {0x00210B, 0x00210D, UnicodeCategory::Lu},
+    {0x00210E, 0x00210F, UnicodeCategory::Ll}, {0x002110, 0x002112, UnicodeCategory::Lu},
+    {0x002113, 0x002113, UnicodeCategory::Ll}, {0x002114, 0x002114, UnicodeCategory::So},
+    {0x002115, 0x002115, UnicodeCategory::Lu}, {0x002116, 0x002117, UnicodeCategory::So},
+    {0x002118, 0x002118, UnicodeCategory::Sm}, {0x002119, 0x00211D, UnicodeCategory::Lu},
+    {0x00211E, 0x002123, UnicodeCategory::So}, {0x002124, 0x002124, UnicodeCategory::Lu},
+    {0x002125, 0x002125, UnicodeCategory::So}, {0x002126, 0x002126, UnicodeCategory::Lu},
+    {0x002127, 0x002127, UnicodeCategory::So}, {0x002128, 0x002128, UnicodeCategory::Lu},
+    {0x002129, 0x002129, UnicodeCategory::So}, {0x00212A, 0x00212D, UnicodeCategory::Lu},
+    {0x00212E, 0x00212E, UnicodeCategory::So}, {0x00212F, 0x00212F, UnicodeCategory::Ll},
+    {0x002130, 0x002133, UnicodeCategory::Lu}, {0x002134, 0x002134, UnicodeCategory::Ll},
+    {0x002135, 0x002138, UnicodeCategory::Lo}, {0x002139, 0x002139, UnicodeCategory::Ll},
+    {0x00213A, 0x00213B, UnicodeCategory::So}, {0x00213C, 0x00213D, UnicodeCategory::Ll},
+    {0x00213E, 0x00213F, UnicodeCategory::Lu}, {0x002140, 0x002144, UnicodeCategory::Sm},
+    {0x002145, 0x002145, UnicodeCategory::Lu}, {0x002146, 0x002149, UnicodeCategory::Ll},
+    {0x00214A, 0x00214A, UnicodeCategory::So}, {0x00214B, 0x00214B, UnicodeCategory::Sm},
+    {0x00214C, 0x00214D, UnicodeCategory::So}, {0x00214E, 0x00214E, UnicodeCategory::Ll},
+    {0x00214F, 0x00214F, UnicodeCategory::So}, {0x002150, 0x00215F, UnicodeCategory::No},
+    {0x002160, 0x002182, UnicodeCategory::Nl}, {0x002183, 0x002183, UnicodeCategory::Lu},
+    {0x002184, 0x002184, UnicodeCategory::Ll}, {0x002185, 0x002188, UnicodeCategory::Nl},
+    {0x002189, 0x002189, UnicodeCategory::No}, {0x00218A, 0x00218B, UnicodeCategory::So},
+    {0x002190, 0x002194, UnicodeCategory::Sm}, {0x002195, 0x002199, UnicodeCategory::So},
+    {0x00219A, 0x00219B, UnicodeCategory::Sm}, {0x00219C, 0x00219F, UnicodeCategory::So},
+    {0x0021A0, 0x0021A0, UnicodeCategory::Sm}, {0x0021A1, 0x0021A2, UnicodeCategory::So},
+    {0x0021A3, 0x0021A3, UnicodeCategory::Sm}, {0x0021A4, 0x0021A5, UnicodeCategory::So},
+    {0x0021A6, 0x0021A6, UnicodeCategory::Sm}, {0x0021A7, 0x0021AD, UnicodeCategory::So},
+    {0x0021AE, 0x0021AE, UnicodeCategory::Sm}, {0x0021AF, 0x0021CD, UnicodeCategory::So},
+    {0x0021CE, 0x0021CF, UnicodeCategory::Sm}, {0x0021D0, 0x0021D1, UnicodeCategory::So},
+    {0x0021D2, 0x0021D2, UnicodeCategory::Sm}, {0x0021D3, 0x0021D3, UnicodeCategory::So},
+    {0x0021D4, 0x0021D4, UnicodeCategory::Sm}, {0x0021D5, 0x0021F3, UnicodeCategory::So},
+    {0x0021F4, 0x0022FF, UnicodeCategory::Sm}, {0x002300, 0x002307, UnicodeCategory::So},
+    {0x002308, 0x002308, UnicodeCategory::Ps}, {0x002309, 0x002309, UnicodeCategory::Pe},
+    {0x00230A, 0x00230A, UnicodeCategory::Ps}, {0x00230B, 0x00230B, UnicodeCategory::Pe},
+    {0x00230C, 0x00231F, UnicodeCategory::So}, {0x002320, 0x002321, UnicodeCategory::Sm},
+    {0x002322, 0x002328, UnicodeCategory::So}, {0x002329, 0x002329, UnicodeCategory::Ps},
+    {0x00232A, 0x00232A, UnicodeCategory::Pe}, {0x00232B, 0x00237B, UnicodeCategory::So},
+    {0x00237C, 0x00237C, UnicodeCategory::Sm}, {0x00237D, 0x00239A, UnicodeCategory::So},
+    {0x00239B, 0x0023B3, UnicodeCategory::Sm}, {0x0023B4, 0x0023DB, UnicodeCategory::So},
+    {0x0023DC, 0x0023E1, UnicodeCategory::Sm}, {0x0023E2, 0x002426, UnicodeCategory::So},
+    {0x002440, 0x00244A, UnicodeCategory::So}, {0x002460, 0x00249B, UnicodeCategory::No},
+    {0x00249C, 0x0024E9, UnicodeCategory::So}, {0x0024EA, 0x0024FF, UnicodeCategory::No},
+    {0x002500, 0x0025B6, UnicodeCategory::So}, {0x0025B7, 0x0025B7, UnicodeCategory::Sm},
+    {0x0025B8, 0x0025C0, UnicodeCategory::So}, {0x0025C1, 0x0025C1, UnicodeCategory::Sm},
+    {0x0025C2, 0x0025F7, UnicodeCategory::So}, {0x0025F8, 0x0025FF, UnicodeCategory::Sm},
+    {0x002600, 0x00266E, UnicodeCategory::So}, {0x00266F, 0x00266F, UnicodeCategory::Sm},
+    {0x002670, 0x002767, UnicodeCategory::So}, {0x002768, 0x002768, UnicodeCategory::Ps},
+    {0x002769, 0x002769, UnicodeCategory::Pe}, {0x00276A, 0x00276A, UnicodeCategory::Ps},
+    {0x00276B, 0x00276B, UnicodeCategory::Pe}, {0x00276C, 0x00276C, UnicodeCategory::Ps},
+    {0x00276D, 0x00276D, UnicodeCategory::Pe}, {0x00276E, 0x00276E, UnicodeCategory::Ps},
+    {0x00276F, 0x00276F, UnicodeCategory::Pe}, {0x002770, 0x002770, UnicodeCategory::Ps},
+    {0x002771, 0x002771, UnicodeCategory::Pe}, {0x002772, 0x002772, UnicodeCategory::Ps},
+    {0x002773, 0x002773, UnicodeCategory::Pe}, {0x002774, 0x002774, UnicodeCategory::Ps},
+    {0x002775, 0x002775, UnicodeCategory::Pe}, {0x002776, 0x002793, UnicodeCategory::No},
+    {0x002794, 0x0027BF, UnicodeCategory::So}, {0x0027C0, 0x0027C4, UnicodeCategory::Sm},
+    {0x0027C5, 0x0027C5, UnicodeCategory::Ps}, {0x0027C6, 0x0027C6, UnicodeCategory::Pe},
+    {0x0027C7, 0x0027E5, UnicodeCategory::Sm}, {0x0027E6, 0x0027E6, UnicodeCategory::Ps},
+    {0x0027E7, 0x0027E7, UnicodeCategory::Pe}, {0x0027E8, 0x0027E8, UnicodeCategory::Ps},
+    {0x0027E9, 0x0027E9, UnicodeCategory::Pe}, {0x0027EA, 0x0027EA, UnicodeCategory::Ps},
+    {0x0027EB, 0x0027EB, UnicodeCategory::Pe}, {0x0027EC, 0x0027EC, UnicodeCategory::Ps},
+    {0x0027ED, 0x0027ED, UnicodeCategory::Pe}, {0x0027EE, 0x0027EE, UnicodeCategory::Ps},
+    {0x0027EF, 0x0027EF, UnicodeCategory::Pe}, {0x0027F0, 0x0027FF, UnicodeCategory::Sm},
+    {0x002800, 0x0028FF, UnicodeCategory::So}, {0x002900, 0x002982, UnicodeCategory::Sm},
+    {0x002983, 0x002983, UnicodeCategory::Ps}, {0x002984, 0x002984, UnicodeCategory::Pe},
+    {0x002985, 0x002985, UnicodeCategory::Ps}, {0x002986, 0x002986, UnicodeCategory::Pe},
+    {0x002987, 0x002987, UnicodeCategory::Ps}, {0x002988, 0x002988, UnicodeCategory::Pe},
+    {0x002989, 0x002989, UnicodeCategory::Ps}, {0x00298A, 0x00298A, UnicodeCategory::Pe},
+    {0x00298B, 0x00298B, UnicodeCategory::Ps}, {0x00298C, 0x00298C, UnicodeCategory::Pe},
+    {0x00298D, 0x00298D, UnicodeCategory::Ps}, {0x00298E, 0x00298E, UnicodeCategory::Pe},
+    {0x00298F, 0x00298F, UnicodeCategory::Ps}, {0x002990, 0x002990, UnicodeCategory::Pe},
+    {0x002991, 0x002991, UnicodeCategory::Ps}, {0x002992, 0x002992, UnicodeCategory::Pe},
+    {0x002993, 0x002993, UnicodeCategory::Ps}, {0x002994, 0x002994, UnicodeCategory::Pe},
+    {0x002995, 0x002995, UnicodeCategory::Ps}, {0x002996, 0x002996, UnicodeCategory::Pe},
+    {0x002997, 0x002997, UnicodeCategory::Ps}, {0x002998, 0x002998, UnicodeCategory::Pe},
+    {0x002999, 0x0029D7, UnicodeCategory::Sm}, {0x0029D8, 0x0029D8, UnicodeCategory::Ps},
+    {0x0029D9, 0x0029D9, UnicodeCategory::Pe}, {0x0029DA, 0x0029DA, UnicodeCategory::Ps},
+    {0x0029DB, 0x0029DB, UnicodeCategory::Pe}, {0x0029DC, 0x0029FB, UnicodeCategory::Sm},
+    {0x0029FC, 0x0029FC, UnicodeCategory::Ps}, {0x0029FD, 0x0029FD, UnicodeCategory::Pe},
+    {0x0029FE, 0x002AFF, UnicodeCategory::Sm}, {0x002B00, 0x002B2F, UnicodeCategory::So},
+    {0x002B30, 0x002B44, UnicodeCategory::Sm}, {0x002B45, 0x002B46, UnicodeCategory::So},
+    {0x002B47, 0x002B4C, UnicodeCategory::Sm}, {0x002B4D, 0x002B73, UnicodeCategory::So},
+    {0x002B76, 0x002B95, UnicodeCategory::So}, {0x002B97, 0x002BFF, UnicodeCategory::So},
+    {0x002C00, 0x002C2F, UnicodeCategory::Lu}, {0x002C30, 0x002C5F, UnicodeCategory::Ll},
+    {0x002C60, 0x002C60, UnicodeCategory::Lu}, {0x002C61, 0x002C61, UnicodeCategory::Ll},
+    {0x002C62, 0x002C64, UnicodeCategory::Lu}, {0x002C65, 0x002C66, UnicodeCategory::Ll},
+    {0x002C67, 0x002C67, UnicodeCategory::Lu}, {0x002C68, 0x002C68, UnicodeCategory::Ll},
+    {0x002C69, 0x002C69, UnicodeCategory::Lu}, {0x002C6A, 0x002C6A, UnicodeCategory::Ll},
+    {0x002C6B, 0x002C6B, UnicodeCategory::Lu}, {0x002C6C, 0x002C6C, UnicodeCategory::Ll},
+    {0x002C6D, 0x002C70, UnicodeCategory::Lu}, {0x002C71, 0x002C71, UnicodeCategory::Ll},
+    {0x002C72, 0x002C72, UnicodeCategory::Lu}, {0x002C73, 0x002C74, UnicodeCategory::Ll},
+    {0x002C75, 0x002C75, UnicodeCategory::Lu}, {0x002C76, 0x002C7B, UnicodeCategory::Ll},
+    {0x002C7C, 0x002C7D, UnicodeCategory::Lm}, {0x002C7E, 0x002C80, UnicodeCategory::Lu},
+    {0x002C81, 0x002C81, UnicodeCategory::Ll}, {0x002C82, 0x002C82, UnicodeCategory::Lu},
+    {0x002C83, 0x002C83, UnicodeCategory::Ll}, {0x002C84, 0x002C84, UnicodeCategory::Lu},
+    {0x002C85, 0x002C85, UnicodeCategory::Ll}, {0x002C86, 0x002C86, UnicodeCategory::Lu},
+    {0x002C87, 0x002C87, UnicodeCategory::Ll}, {0x002C88, 0x002C88, UnicodeCategory::Lu},
+    {0x002C89, 0x002C89, UnicodeCategory::Ll}, {0x002C8A, 0x002C8A, UnicodeCategory::Lu},
+    {0x002C8B, 0x002C8B, UnicodeCategory::Ll}, {0x002C8C, 0x002C8C, UnicodeCategory::Lu},
+    {0x002C8D, 0x002C8D, UnicodeCategory::Ll}, {0x002C8E, 0x002C8E, UnicodeCategory::Lu},
+    {0x002C8F, 0x002C8F, UnicodeCategory::Ll}, {0x002C90, 0x002C90, UnicodeCategory::Lu},
+    {0x002C91, 0x002C91, UnicodeCategory::Ll}, {0x002C92, 0x002C92, UnicodeCategory::Lu},
+    {0x002C93, 0x002C93, UnicodeCategory::Ll}, {0x002C94, 0x002C94, UnicodeCategory::Lu},
+    {0x002C95, 0x002C95, UnicodeCategory::Ll}, {0x002C96, 0x002C96, UnicodeCategory::Lu},
+    {0x002C97, 0x002C97, UnicodeCategory::Ll}, {0x002C98, 0x002C98, UnicodeCategory::Lu},
+    {0x002C99, 0x002C99, UnicodeCategory::Ll}, {0x002C9A, 0x002C9A, UnicodeCategory::Lu},
+    {0x002C9B, 0x002C9B, UnicodeCategory::Ll}, {0x002C9C, 0x002C9C, UnicodeCategory::Lu},
+    {0x002C9D, 0x002C9D, UnicodeCategory::Ll}, {0x002C9E, 0x002C9E, UnicodeCategory::Lu},
+    {0x002C9F, 0x002C9F, UnicodeCategory::Ll}, {0x002CA0, 0x002CA0, UnicodeCategory::Lu},
+    {0x002CA1, 0x002CA1, UnicodeCategory::Ll}, {0x002CA2, 0x002CA2, UnicodeCategory::Lu},
+    {0x002CA3, 0x002CA3, UnicodeCategory::Ll}, {0x002CA4, 0x002CA4, UnicodeCategory::Lu},
+    {0x002CA5, 0x002CA5, UnicodeCategory::Ll}, {0x002CA6, 0x002CA6, UnicodeCategory::Lu},
+    {0x002CA7, 0x002CA7, UnicodeCategory::Ll}, {0x002CA8, 0x002CA8, UnicodeCategory::Lu},
+    {0x002CA9, 0x002CA9, UnicodeCategory::Ll}, {0x002CAA, 0x002CAA, UnicodeCategory::Lu},
+    {0x002CAB, 0x002CAB, UnicodeCategory::Ll}, {0x002CAC, 0x002CAC, UnicodeCategory::Lu},
+    {0x002CAD, 0x002CAD, UnicodeCategory::Ll}, {0x002CAE, 0x002CAE, UnicodeCategory::Lu},
+    {0x002CAF, 0x002CAF, UnicodeCategory::Ll}, {0x002CB0, 0x002CB0, UnicodeCategory::Lu},
+    {0x002CB1, 0x002CB1, UnicodeCategory::Ll}, {0x002CB2, 0x002CB2, UnicodeCategory::Lu},
+    {0x002CB3, 0x002CB3, UnicodeCategory::Ll}, {0x002CB4, 0x002CB4, UnicodeCategory::Lu},
+    {0x002CB5, 0x002CB5, UnicodeCategory::Ll}, {0x002CB6, 0x002CB6, UnicodeCategory::Lu},
+    {0x002CB7, 0x002CB7, UnicodeCategory::Ll}, {0x002CB8, 0x002CB8, UnicodeCategory::Lu},
+    {0x002CB9, 0x002CB9, UnicodeCategory::Ll}, {0x002CBA, 0x002CBA, UnicodeCategory::Lu},
+    {0x002CBB, 0x002CBB, UnicodeCategory::Ll}, {0x002CBC, 0x002CBC, UnicodeCategory::Lu},
+    {0x002CBD, 0x002CBD, UnicodeCategory::Ll}, {0x002CBE, 0x002CBE, UnicodeCategory::Lu},
+    {0x002CBF, 0x002CBF, UnicodeCategory::Ll}, {0x002CC0, 0x002CC0, UnicodeCategory::Lu},
+    {0x002CC1, 0x002CC1, UnicodeCategory::Ll}, {0x002CC2, 0x002CC2, UnicodeCategory::Lu},
+    {0x002CC3, 0x002CC3, UnicodeCategory::Ll}, {0x002CC4, 0x002CC4, UnicodeCategory::Lu},
+    {0x002CC5, 0x002CC5, UnicodeCategory::Ll}, {0x002CC6, 0x002CC6, UnicodeCategory::Lu},
+    {0x002CC7, 0x002CC7, UnicodeCategory::Ll}, {0x002CC8, 0x002CC8, UnicodeCategory::Lu},
+    {0x002CC9, 0x002CC9, UnicodeCategory::Ll}, {0x002CCA, 0x002CCA, UnicodeCategory::Lu},
+    {0x002CCB, 0x002CCB, UnicodeCategory::Ll}, {0x002CCC, 0x002CCC, UnicodeCategory::Lu},
+    {0x002CCD, 0x002CCD, UnicodeCategory::Ll}, {0x002CCE, 0x002CCE, UnicodeCategory::Lu},
+    {0x002CCF, 0x002CCF, UnicodeCategory::Ll}, {0x002CD0, 0x002CD0, UnicodeCategory::Lu},
+    {0x002CD1, 0x002CD1, UnicodeCategory::Ll}, {0x002CD2, 0x002CD2, UnicodeCategory::Lu},
+    {0x002CD3, 0x002CD3, UnicodeCategory::Ll}, {0x002CD4, 0x002CD4, UnicodeCategory::Lu},
+    {0x002CD5, 0x002CD5, UnicodeCategory::Ll}, {0x002CD6, 0x002CD6, UnicodeCategory::Lu},
+    {0x002CD7, 0x002CD7, UnicodeCategory::Ll}, {0x002CD8, 0x002CD8, UnicodeCategory::Lu},
+    {0x002CD9, 0x002CD9, UnicodeCategory::Ll}, {0x002CDA, 0x002CDA, UnicodeCategory::Lu},
+    {0x002CDB, 0x002CDB, UnicodeCategory::Ll}, {0x002CDC, 0x002CDC, UnicodeCategory::Lu},
+    {0x002CDD, 0x002CDD, UnicodeCategory::Ll}, {0x002CDE, 0x002CDE, UnicodeCategory::Lu},
+    {0x002CDF, 0x002CDF, UnicodeCategory::Ll}, {0x002CE0, 0x002CE0, UnicodeCategory::Lu},
+    {0x002CE1, 0x002CE1, UnicodeCategory::Ll}, {0x002CE2, 0x002CE2, UnicodeCategory::Lu},
+    {0x002CE3, 0x002CE4, UnicodeCategory::Ll}, {0x002CE5, 0x002CEA, UnicodeCategory::So},
+    {0x002CEB, 0x002CEB, UnicodeCategory::Lu}, {0x002CEC, 0x002CEC, UnicodeCategory::Ll},
+    {0x002CED, 0x002CED, UnicodeCategory::Lu}, {0x002CEE, 0x002CEE, UnicodeCategory::Ll},
+    {0x002CEF, 0x002CF1, UnicodeCategory::Mn}, {0x002CF2, 0x002CF2, UnicodeCategory::Lu},
+    {0x002CF3, 0x002CF3, UnicodeCategory::Ll}, {0x002CF9, 0x002CFC, UnicodeCategory::Po},
+    {0x002CFD, 0x002CFD, UnicodeCategory::No}, {0x002CFE, 0x002CFF, UnicodeCategory::Po},
+    {0x002D00, 0x002D25, UnicodeCategory::Ll}, {0x002D27, 0x002D27, UnicodeCategory::Ll},
+    {0x002D2D, 0x002D2D, UnicodeCategory::Ll}, {0x002D30, 0x002D67, UnicodeCategory::Lo},
+    {0x002D6F, 0x002D6F, UnicodeCategory::Lm}, {0x002D70, 0x002D70, UnicodeCategory::Po},
+    {0x002D7F, 0x002D7F, UnicodeCategory::Mn}, {0x002D80, 0x002D96, UnicodeCategory::Lo},
+    {0x002DA0, 0x002DA6, UnicodeCategory::Lo}, {0x002DA8, 0x002DAE, UnicodeCategory::Lo},
+    {0x002DB0, 0x002DB6, UnicodeCategory::Lo}, {0x002DB8, 0x002DBE, UnicodeCategory::Lo},
+    {0x002DC0, 0x002DC6, UnicodeCategory::Lo}, {0x002DC8, 0x002DCE, UnicodeCategory::Lo},
+    {0x002DD0, 0x002DD6, UnicodeCategory::Lo}, {0x002DD8, 0x002DDE, UnicodeCategory::Lo},
+    {0x002DE0, 0x002DFF, UnicodeCategory::Mn}, {0x002E00, 0x002E01, UnicodeCategory::Po},
+    {0x002E02, 0x002E02, UnicodeCategory::Pi}, {0x002E03, 0x002E03, UnicodeCategory::Pf},
+    {0x002E04, 0x002E04, UnicodeCategory::Pi}, {0x002E05, 0x002E05, UnicodeCategory::Pf},
+    {0x002E06, 0x002E08, UnicodeCategory::Po}, {0x002E09, 0x002E09, UnicodeCategory::Pi},
+    {0x002E0A, 0x002E0A, UnicodeCategory::Pf}, {0x002E0B, 0x002E0B, UnicodeCategory::Po},
+    {0x002E0C, 0x002E0C, UnicodeCategory::Pi}, {0x002E0D, 0x002E0D, UnicodeCategory::Pf},
+    {0x002E0E, 0x002E16, UnicodeCategory::Po}, {0x002E17, 0x002E17, UnicodeCategory::Pd},
+    {0x002E18, 0x002E19, UnicodeCategory::Po}, {0x002E1A, 0x002E1A, UnicodeCategory::Pd},
+    {0x002E1B, 0x002E1B, UnicodeCategory::Po}, {0x002E1C, 0x002E1C, UnicodeCategory::Pi},
+    {0x002E1D, 0x002E1D, UnicodeCategory::Pf}, {0x002E1E, 0x002E1F, UnicodeCategory::Po},
+    {0x002E20, 0x002E20, UnicodeCategory::Pi}, {0x002E21, 0x002E21, UnicodeCategory::Pf},
+    {0x002E22, 0x002E22, UnicodeCategory::Ps}, {0x002E23, 0x002E23, UnicodeCategory::Pe},
+    {0x002E24, 0x002E24, UnicodeCategory::Ps}, {0x002E25, 0x002E25, UnicodeCategory::Pe},
+    {0x002E26, 0x002E26, UnicodeCategory::Ps}, {0x002E27, 0x002E27, UnicodeCategory::Pe},
+    {0x002E28, 0x002E28, UnicodeCategory::Ps}, {0x002E29, 0x002E29, UnicodeCategory::Pe},
+    {0x002E2A, 0x002E2E, UnicodeCategory::Po}, {0x002E2F, 0x002E2F, UnicodeCategory::Lm},
+    {0x002E30, 0x002E39, UnicodeCategory::Po}, {0x002E3A, 0x002E3B, UnicodeCategory::Pd},
+    {0x002E3C, 0x002E3F, UnicodeCategory::Po}, {0x002E40, 0x002E40, UnicodeCategory::Pd},
+    {0x002E41, 0x002E41, UnicodeCategory::Po}, {0x002E42, 0x002E42, UnicodeCategory::Ps},
+    {0x002E43, 0x002E4F, UnicodeCategory::Po}, {0x002E50, 0x002E51, UnicodeCategory::So},
+    {0x002E52, 0x002E54, UnicodeCategory::Po}, {0x002E55, 0x002E55, UnicodeCategory::Ps},
+    {0x002E56, 0x002E56, UnicodeCategory::Pe}, {0x002E57, 0x002E57, UnicodeCategory::Ps},
+    {0x002E58, 0x002E58, UnicodeCategory::Pe}, {0x002E59, 0x002E59, UnicodeCategory::Ps},
+    {0x002E5A, 0x002E5A, UnicodeCategory::Pe}, {0x002E5B, 0x002E5B, UnicodeCategory::Ps},
+    {0x002E5C, 0x002E5C, UnicodeCategory::Pe}, {0x002E5D, 0x002E5D, UnicodeCategory::Pd},
+    {0x002E80, 0x002E99, UnicodeCategory::So}, {0x002E9B, 0x002EF3, UnicodeCategory::So},
+    {0x002F00, 0x002FD5, UnicodeCategory::So}, {0x002FF0, 0x002FFB, UnicodeCategory::So},
+    {0x003000, 0x003000, UnicodeCategory::Zs}, {0x003001, 0x003003, UnicodeCategory::Po},
+    {0x003004, 0x003004, UnicodeCategory::So}, {0x003005, 0x003005, UnicodeCategory::Lm},
+    {0x003006, 0x003006, UnicodeCategory::Lo}, {0x003007, 0x003007, UnicodeCategory::Nl},
+    {0x003008, 0x003008, UnicodeCategory::Ps}, {0x003009, 0x003009, UnicodeCategory::Pe},
+    {0x00300A, 0x00300A, UnicodeCategory::Ps}, {0x00300B, 0x00300B, UnicodeCategory::Pe},
+    {0x00300C, 0x00300C, UnicodeCategory::Ps}, {0x00300D, 0x00300D, UnicodeCategory::Pe},
+    {0x00300E, 0x00300E, UnicodeCategory::Ps}, {0x00300F, 0x00300F, UnicodeCategory::Pe},
+    {0x003010, 0x003010, UnicodeCategory::Ps}, {0x003011, 0x003011, UnicodeCategory::Pe},
+    {0x003012, 0x003013, UnicodeCategory::So}, {0x003014, 0x003014, UnicodeCategory::Ps},
+    {0x003015, 0x003015, UnicodeCategory::Pe}, {0x003016, 0x003016, UnicodeCategory::Ps},
+    {0x003017, 0x003017, UnicodeCategory::Pe}, {0x003018, 0x003018, UnicodeCategory::Ps},
+    {0x003019, 0x003019, UnicodeCategory::Pe}, {0x00301A, 0x00301A, UnicodeCategory::Ps},
+    {0x00301B, 0x00301B, UnicodeCategory::Pe}, {0x00301C, 0x00301C, UnicodeCategory::Pd},
+    {0x00301D, 0x00301D, UnicodeCategory::Ps}, {0x00301E, 0x00301F, UnicodeCategory::Pe},
+    {0x003020, 0x003020, UnicodeCategory::So}, {0x003021, 0x003029, UnicodeCategory::Nl},
+    {0x00302A, 0x00302D, UnicodeCategory::Mn}, {0x00302E, 0x00302F, UnicodeCategory::Mc},
+    {0x003030, 0x003030, UnicodeCategory::Pd}, {0x003031, 0x003035, UnicodeCategory::Lm},
+    {0x003036, 0x003037, UnicodeCategory::So}, {0x003038, 0x00303A, UnicodeCategory::Nl},
+    {0x00303B, 0x00303B, UnicodeCategory::Lm}, {0x00303C, 0x00303C, UnicodeCategory::Lo},
+    {0x00303D, 0x00303D, UnicodeCategory::Po}, {0x00303E, 0x00303F, UnicodeCategory::So},
+    {0x003041, 0x003096, UnicodeCategory::Lo}, {0x003099, 0x00309A, UnicodeCategory::Mn},
+    {0x00309B, 0x00309C, UnicodeCategory::Sk}, {0x00309D, 0x00309E, UnicodeCategory::Lm},
+    {0x00309F, 0x00309F, UnicodeCategory::Lo}, {0x0030A0, 0x0030A0, UnicodeCategory::Pd},
+    {0x0030A1, 0x0030FA, UnicodeCategory::Lo}, {0x0030FB, 0x0030FB, UnicodeCategory::Po},
+    {0x0030FC, 0x0030FE, UnicodeCategory::Lm}, {0x0030FF, 0x0030FF, UnicodeCategory::Lo},
+    {0x003105, 0x00312F, UnicodeCategory::Lo}, {0x003131, 0x00318E, UnicodeCategory::Lo},
+    {0x003190, 0x003191, UnicodeCategory::So}, {0x003192, 0x003195, UnicodeCategory::No},
+    {0x003196, 0x00319F, UnicodeCategory::So}, {0x0031A0, 0x0031BF, UnicodeCategory::Lo},
+    {0x0031C0, 0x0031E3, UnicodeCategory::So}, {0x0031F0, 0x0031FF, UnicodeCategory::Lo},
+    {0x003200, 0x00321E, UnicodeCategory::So}, {0x003220, 0x003229, UnicodeCategory::No},
+    {0x00322A, 0x003247, UnicodeCategory::So}, {0x003248, 0x00324F, UnicodeCategory::No},
+    {0x003250, 0x003250, UnicodeCategory::So}, {0x003251, 0x00325F, UnicodeCategory::No},
+    {0x003260, 0x00327F, UnicodeCategory::So}, {0x003280, 0x003289, UnicodeCategory::No},
+    {0x00328A, 0x0032B0, UnicodeCategory::So}, {0x0032B1, 0x0032BF, UnicodeCategory::No},
+    {0x0032C0, 0x0033FF, UnicodeCategory::So}, {0x003400, 0x004DBF, UnicodeCategory::Lo},
+    {0x004DC0, 0x004DFF, UnicodeCategory::So}, {0x004E00, 0x00A014, UnicodeCategory::Lo},
+    {0x00A015, 0x00A015, UnicodeCategory::Lm}, {0x00A016, 0x00A48C, UnicodeCategory::Lo},
+    {0x00A490, 0x00A4C6, UnicodeCategory::So}, {0x00A4D0, 0x00A4F7, UnicodeCategory::Lo},
+    {0x00A4F8, 0x00A4FD, UnicodeCategory::Lm}, {0x00A4FE, 0x00A4FF, UnicodeCategory::Po},
+    {0x00A500, 0x00A60B, UnicodeCategory::Lo}, {0x00A60C, 0x00A60C, UnicodeCategory::Lm},
+    {0x00A60D, 0x00A60F, UnicodeCategory::Po}, {0x00A610, 0x00A61F, UnicodeCategory::Lo},
+    {0x00A620, 0x00A629, UnicodeCategory::Nd}, {0x00A62A, 0x00A62B, UnicodeCategory::Lo},
+    {0x00A640, 0x00A640, UnicodeCategory::Lu}, {0x00A641, 0x00A641, UnicodeCategory::Ll},
+    {0x00A642, 0x00A642, UnicodeCategory::Lu}, {0x00A643, 0x00A643, UnicodeCategory::Ll},
+    {0x00A644, 0x00A644, UnicodeCategory::Lu}, {0x00A645, 0x00A645, UnicodeCategory::Ll},
+    {0x00A646, 0x00A646, UnicodeCategory::Lu}, {0x00A647, 0x00A647, UnicodeCategory::Ll},
+    {0x00A648, 0x00A648, UnicodeCategory::Lu}, {0x00A649, 0x00A649, UnicodeCategory::Ll},
+    {0x00A64A, 0x00A64A, UnicodeCategory::Lu}, {0x00A64B, 0x00A64B, UnicodeCategory::Ll},
+    {0x00A64C, 0x00A64C, UnicodeCategory::Lu}, {0x00A64D, 0x00A64D, UnicodeCategory::Ll},
+    {0x00A64E, 0x00A64E, UnicodeCategory::Lu}, {0x00A64F, 0x00A64F, UnicodeCategory::Ll},
+    {0x00A650, 0x00A650, UnicodeCategory::Lu}, {0x00A651, 0x00A651, UnicodeCategory::Ll},
+    {0x00A652, 0x00A652, UnicodeCategory::Lu}, {0x00A653, 0x00A653, UnicodeCategory::Ll},
+    {0x00A654, 0x00A654, UnicodeCategory::Lu}, {0x00A655, 0x00A655, UnicodeCategory::Ll},
+    {0x00A656, 0x00A656, UnicodeCategory::Lu}, {0x00A657, 0x00A657, UnicodeCategory::Ll},
+    {0x00A658, 0x00A658, UnicodeCategory::Lu}, {0x00A659, 0x00A659, UnicodeCategory::Ll},
+    {0x00A65A, 0x00A65A, UnicodeCategory::Lu}, {0x00A65B, 0x00A65B, UnicodeCategory::Ll},
+    {0x00A65C, 0x00A65C, UnicodeCategory::Lu}, {0x00A65D, 0x00A65D, UnicodeCategory::Ll},
+    {0x00A65E, 0x00A65E, UnicodeCategory::Lu}, {0x00A65F, 0x00A65F, UnicodeCategory::Ll},
+    {0x00A660, 0x00A660, UnicodeCategory::Lu}, {0x00A661, 0x00A661, UnicodeCategory::Ll},
+    {0x00A662, 0x00A662, UnicodeCategory::Lu}, {0x00A663, 0x00A663, UnicodeCategory::Ll},
+    {0x00A664, 0x00A664, UnicodeCategory::Lu}, {0x00A665, 0x00A665, UnicodeCategory::Ll},
+    {0x00A666, 0x00A666, UnicodeCategory::Lu}, {0x00A667, 0x00A667, UnicodeCategory::Ll},
+    {0x00A668, 0x00A668, UnicodeCategory::Lu}, {0x00A669, 0x00A669, UnicodeCategory::Ll},
+    {0x00A66A, 0x00A66A, UnicodeCategory::Lu}, {0x00A66B, 0x00A66B, UnicodeCategory::Ll},
+    {0x00A66C, 0x00A66C, UnicodeCategory::Lu}, {0x00A66D, 0x00A66D, UnicodeCategory::Ll},
+    {0x00A66E, 0x00A66E, UnicodeCategory::Lo}, {0x00A66F, 0x00A66F, UnicodeCategory::Mn},
+    {0x00A670, 0x00A672, UnicodeCategory::Me}, {0x00A673, 0x00A673, UnicodeCategory::Po},
+    {0x00A674, 0x00A67D, UnicodeCategory::Mn}, {0x00A67E, 0x00A67E, UnicodeCategory::Po},
+    {0x00A67F, 0x00A67F, UnicodeCategory::Lm}, {0x00A680, 0x00A680, UnicodeCategory::Lu},
+    {0x00A681, 0x00A681, UnicodeCategory::Ll}, {0x00A682, 0x00A682, UnicodeCategory::Lu},
+    {0x00A683, 0x00A683, UnicodeCategory::Ll}, {0x00A684, 0x00A684, UnicodeCategory::Lu},
+    {0x00A685, 0x00A685, UnicodeCategory::Ll}, {0x00A686, 0x00A686, UnicodeCategory::Lu},
+    {0x00A687, 0x00A687, UnicodeCategory::Ll}, {0x00A688, 0x00A688, UnicodeCategory::Lu},
+    {0x00A689, 0x00A689, UnicodeCategory::Ll}, {0x00A68A, 0x00A68A, UnicodeCategory::Lu},
+    {0x00A68B, 0x00A68B, UnicodeCategory::Ll}, {0x00A68C, 0x00A68C, UnicodeCategory::Lu},
+    {0x00A68D, 0x00A68D, UnicodeCategory::Ll}, {0x00A68E, 0x00A68E, UnicodeCategory::Lu},
+    {0x00A68F, 0x00A68F, UnicodeCategory::Ll}, {0x00A690, 0x00A690, UnicodeCategory::Lu},
+    {0x00A691, 0x00A691, UnicodeCategory::Ll}, {0x00A692, 0x00A692, UnicodeCategory::Lu},
+    {0x00A693, 0x00A693, UnicodeCategory::Ll}, {0x00A694, 0x00A694, UnicodeCategory::Lu},
+    {0x00A695, 0x00A695, UnicodeCategory::Ll}, {0x00A696, 0x00A696, UnicodeCategory::Lu},
+    {0x00A697, 0x00A697, UnicodeCategory::Ll}, {0x00A698, 0x00A698, UnicodeCategory::Lu},
+    {0x00A699, 0x00A699, UnicodeCategory::Ll}, {0x00A69A, 0x00A69A, UnicodeCategory::Lu},
+    {0x00A69B, 0x00A69B, UnicodeCategory::Ll}, {0x00A69C, 0x00A69D, UnicodeCategory::Lm},
+    {0x00A69E, 0x00A69F, UnicodeCategory::Mn}, {0x00A6A0, 0x00A6E5, UnicodeCategory::Lo},
+    {0x00A6E6, 0x00A6EF, UnicodeCategory::Nl}, {0x00A6F0, 0x00A6F1, UnicodeCategory::Mn},
+    {0x00A6F2, 0x00A6F7, UnicodeCategory::Po}, {0x00A700, 0x00A716, UnicodeCategory::Sk},
+    {0x00A717, 0x00A71F, UnicodeCategory::Lm}, {0x00A720, 0x00A721, UnicodeCategory::Sk},
+    {0x00A722, 0x00A722, UnicodeCategory::Lu}, {0x00A723, 0x00A723, UnicodeCategory::Ll},
+    {0x00A724, 0x00A724, UnicodeCategory::Lu}, {0x00A725, 0x00A725, UnicodeCategory::Ll},
+    {0x00A726, 0x00A726, UnicodeCategory::Lu}, {0x00A727, 0x00A727, UnicodeCategory::Ll},
+    {0x00A728, 0x00A728, UnicodeCategory::Lu}, {0x00A729, 0x00A729, UnicodeCategory::Ll},
+    {0x00A72A, 0x00A72A, UnicodeCategory::Lu}, {0x00A72B, 0x00A72B, UnicodeCategory::Ll},
+    {0x00A72C, 0x00A72C, UnicodeCategory::Lu}, {0x00A72D, 0x00A72D, UnicodeCategory::Ll},
+    {0x00A72E, 0x00A72E, UnicodeCategory::Lu}, {0x00A72F, 0x00A731, UnicodeCategory::Ll},
+    {0x00A732, 0x00A732, UnicodeCategory::Lu}, {0x00A733, 0x00A733, UnicodeCategory::Ll},
+    {0x00A734, 0x00A734, UnicodeCategory::Lu}, {0x00A735, 0x00A735, UnicodeCategory::Ll},
+    {0x00A736, 0x00A736, UnicodeCategory::Lu}, {0x00A737, 0x00A737, UnicodeCategory::Ll},
+    {0x00A738, 0x00A738, UnicodeCategory::Lu}, {0x00A739, 0x00A739, UnicodeCategory::Ll},
+    {0x00A73A, 0x00A73A, UnicodeCategory::Lu}, {0x00A73B, 0x00A73B, UnicodeCategory::Ll},
+    {0x00A73C, 0x00A73C, UnicodeCategory::Lu}, {0x00A73D, 0x00A73D, UnicodeCategory::Ll},
+    {0x00A73E, 0x00A73E, UnicodeCategory::Lu}, {0x00A73F, 0x00A73F, UnicodeCategory::Ll},
+    {0x00A740, 0x00A740, UnicodeCategory::Lu}, {0x00A741, 0x00A741, UnicodeCategory::Ll},
+    {0x00A742, 0x00A742, UnicodeCategory::Lu}, {0x00A743, 0x00A743, UnicodeCategory::Ll},
+    {0x00A744, 0x00A744, UnicodeCategory::Lu}, {0x00A745, 0x00A745, UnicodeCategory::Ll},
+    {0x00A746, 0x00A746, UnicodeCategory::Lu}, {0x00A747, 0x00A747, UnicodeCategory::Ll},
+    {0x00A748, 0x00A748, UnicodeCategory::Lu}, {0x00A749, 0x00A749, UnicodeCategory::Ll},
+    {0x00A74A, 0x00A74A, UnicodeCategory::Lu}, {0x00A74B, 0x00A74B, UnicodeCategory::Ll},
+    {0x00A74C, 0x00A74C, UnicodeCategory::Lu}, {0x00A74D, 0x00A74D, UnicodeCategory::Ll},
+    {0x00A74E, 0x00A74E, UnicodeCategory::Lu}, {0x00A74F, 0x00A74F, UnicodeCategory::Ll},
+    {0x00A750, 0x00A750, UnicodeCategory::Lu}, {0x00A751, 0x00A751, UnicodeCategory::Ll},
+    {0x00A752, 0x00A752, UnicodeCategory::Lu}, {0x00A753, 0x00A753, UnicodeCategory::Ll},
+    {0x00A754, 0x00A754, UnicodeCategory::Lu}, {0x00A755, 0x00A755, UnicodeCategory::Ll},
+    {0x00A756, 0x00A756, UnicodeCategory::Lu}, {0x00A757, 0x00A757, UnicodeCategory::Ll},
+    {0x00A758, 0x00A758, UnicodeCategory::Lu}, {0x00A759, 0x00A759, UnicodeCategory::Ll},
+    {0x00A75A, 0x00A75A, UnicodeCategory::Lu}, {0x00A75B, 0x00A75B, UnicodeCategory::Ll},
+    {0x00A75C, 0x00A75C, UnicodeCategory::Lu}, {0x00A75D, 0x00A75D, UnicodeCategory::Ll},
+    {0x00A75E, 0x00A75E, UnicodeCategory::Lu}, {0x00A75F, 0x00A75F, UnicodeCategory::Ll},
+    {0x00A760, 0x00A760, UnicodeCategory::Lu}, {0x00A761, 0x00A761, UnicodeCategory::Ll},
+    {0x00A762, 0x00A762, UnicodeCategory::Lu}, {0x00A763, 0x00A763, UnicodeCategory::Ll},
+    {0x00A764, 0x00A764, UnicodeCategory::Lu}, {0x00A765, 0x00A765, UnicodeCategory::Ll},
+    {0x00A766, 0x00A766, UnicodeCategory::Lu}, {0x00A767, 0x00A767, UnicodeCategory::Ll},
+    {0x00A768, 0x00A768, UnicodeCategory::Lu}, {0x00A769, 0x00A769, UnicodeCategory::Ll},
+    {0x00A76A, 0x00A76A, UnicodeCategory::Lu}, {0x00A76B, 0x00A76B, UnicodeCategory::Ll},
+    {0x00A76C, 0x00A76C, UnicodeCategory::Lu}, {0x00A76D, 0x00A76D, UnicodeCategory::Ll},
+    {0x00A76E, 0x00A76E, UnicodeCategory::Lu}, {0x00A76F, 0x00A76F, UnicodeCategory::Ll},
+    {0x00A770, 0x00A770, UnicodeCategory::Lm}, {0x00A771, 0x00A778, UnicodeCategory::Ll},
+    {0x00A779, 0x00A779, UnicodeCategory::Lu}, {0x00A77A, 0x00A77A, UnicodeCategory::Ll},
+    {0x00A77B, 0x00A77B, UnicodeCategory::Lu}, {0x00A77C, 0x00A77C, UnicodeCategory::Ll},
+    {0x00A77D, 0x00A77E, UnicodeCategory::Lu}, {0x00A77F, 0x00A77F, UnicodeCategory::Ll},
+    {0x00A780, 0x00A780, UnicodeCategory::Lu}, {0x00A781, 0x00A781, UnicodeCategory::Ll},
+    {0x00A782, 0x00A782, UnicodeCategory::Lu}, {0x00A783, 0x00A783, UnicodeCategory::Ll},
+    {0x00A784, 0x00A784, UnicodeCategory::Lu}, {0x00A785, 0x00A785, UnicodeCategory::Ll},
+    {0x00A786, 0x00A786, UnicodeCategory::Lu}, {0x00A787, 0x00A787, UnicodeCategory::Ll},
+    {0x00A788, 0x00A788, UnicodeCategory::Lm}, {0x00A789, 0x00A78A, UnicodeCategory::Sk},
+    {0x00A78B, 0x00A78B, UnicodeCategory::Lu}, {0x00A78C, 0x00A78C, UnicodeCategory::Ll},
+    {0x00A78D, 0x00A78D, UnicodeCategory::Lu}, {0x00A78E, 0x00A78E, UnicodeCategory::Ll},
+    {0x00A78F, 0x00A78F, UnicodeCategory::Lo}, {0x00A790, 0x00A790, UnicodeCategory::Lu},
+    {0x00A791, 0x00A791, UnicodeCategory::Ll}, {0x00A792, 0x00A792, UnicodeCategory::Lu},
+    {0x00A793, 0x00A795, UnicodeCategory::Ll}, {0x00A796, 0x00A796, UnicodeCategory::Lu},
+    {0x00A797, 0x00A797, UnicodeCategory::Ll}, {0x00A798, 0x00A798, UnicodeCategory::Lu},
+    {0x00A799, 0x00A799, UnicodeCategory::Ll}, {0x00A79A, 0x00A79A, UnicodeCategory::Lu},
+    {0x00A79B, 0x00A79B, UnicodeCategory::Ll}, {0x00A79C, 0x00A79C, UnicodeCategory::Lu},
+    {0x00A79D, 0x00A79D, UnicodeCategory::Ll}, {0x00A79E, 0x00A79E, UnicodeCategory::Lu},
+    {0x00A79F, 0x00A79F, UnicodeCategory::Ll}, {0x00A7A0, 0x00A7A0, UnicodeCategory::Lu},
+    {0x00A7A1, 0x00A7A1, UnicodeCategory::Ll}, {0x00A7A2, 0x00A7A2, UnicodeCategory::Lu},
+    {0x00A7A3, 0x00A7A3, UnicodeCategory::Ll}, {0x00A7A4, 0x00A7A4, UnicodeCategory::Lu},
+    {0x00A7A5, 0x00A7A5, UnicodeCategory::Ll}, {0x00A7A6, 0x00A7A6, UnicodeCategory::Lu},
+    {0x00A7A7, 0x00A7A7, UnicodeCategory::Ll}, {0x00A7A8, 0x00A7A8, UnicodeCategory::Lu},
+    {0x00A7A9, 0x00A7A9, UnicodeCategory::Ll}, {0x00A7AA, 0x00A7AE, UnicodeCategory::Lu},
+    {0x00A7AF, 0x00A7AF, UnicodeCategory::Ll}, {0x00A7B0, 0x00A7B4, UnicodeCategory::Lu},
+    {0x00A7B5, 0x00A7B5, UnicodeCategory::Ll}, {0x00A7B6, 0x00A7B6, UnicodeCategory::Lu},
+    {0x00A7B7, 0x00A7B7, UnicodeCategory::Ll}, {0x00A7B8, 0x00A7B8, UnicodeCategory::Lu},
+    {0x00A7B9, 0x00A7B9, UnicodeCategory::Ll}, {0x00A7BA, 0x00A7BA, UnicodeCategory::Lu},
+    {0x00A7BB, 0x00A7BB, UnicodeCategory::Ll}, {0x00A7BC, 0x00A7BC, UnicodeCategory::Lu},
+    {0x00A7BD, 0x00A7BD, UnicodeCategory::Ll}, {0x00A7BE, 0x00A7BE, UnicodeCategory::Lu},
+    {0x00A7BF, 0x00A7BF, UnicodeCategory::Ll}, {0x00A7C0, 0x00A7C0, UnicodeCategory::Lu},
+    {0x00A7C1, 0x00A7C1, UnicodeCategory::Ll}, {0x00A7C2, 0x00A7C2, UnicodeCategory::Lu},
+    {0x00A7C3, 0x00A7C3, UnicodeCategory::Ll}, {0x00A7C4, 0x00A7C7, UnicodeCategory::Lu},
+    {0x00A7C8, 0x00A7C8, UnicodeCategory::Ll}, {0x00A7C9, 0x00A7C9, UnicodeCategory::Lu},
+    {0x00A7CA, 0x00A7CA, UnicodeCategory::Ll}, {0x00A7D0, 0x00A7D0, UnicodeCategory::Lu},
+    {0x00A7D1, 0x00A7D1, UnicodeCategory::Ll}, {0x00A7D3, 0x00A7D3, UnicodeCategory::Ll},
+    {0x00A7D5, 0x00A7D5, UnicodeCategory::Ll}, {0x00A7D6, 0x00A7D6, UnicodeCategory::Lu},
+    {0x00A7D7, 0x00A7D7, UnicodeCategory::Ll}, {0x00A7D8, 0x00A7D8, UnicodeCategory::Lu},
+    {0x00A7D9, 0x00A7D9, UnicodeCategory::Ll}, {0x00A7F2, 0x00A7F4, UnicodeCategory::Lm},
+    {0x00A7F5, 0x00A7F5, UnicodeCategory::Lu}, {0x00A7F6, 0x00A7F6, UnicodeCategory::Ll},
+    {0x00A7F7, 0x00A7F7, UnicodeCategory::Lo}, {0x00A7F8, 0x00A7F9, UnicodeCategory::Lm},
+    {0x00A7FA, 0x00A7FA, UnicodeCategory::Ll}, {0x00A7FB, 0x00A801, UnicodeCategory::Lo},
+    {0x00A802, 0x00A802, UnicodeCategory::Mn}, {0x00A803, 0x00A805, UnicodeCategory::Lo},
+    {0x00A806, 0x00A806, UnicodeCategory::Mn}, {0x00A807, 0x00A80A, UnicodeCategory::Lo},
+    {0x00A80B, 0x00A80B, UnicodeCategory::Mn}, {0x00A80C, 0x00A822, UnicodeCategory::Lo},
+    {0x00A823, 0x00A824, UnicodeCategory::Mc}, {0x00A825, 0x00A826, UnicodeCategory::Mn},
+    {0x00A827, 0x00A827, UnicodeCategory::Mc}, {0x00A828, 0x00A82B, UnicodeCategory::So},
+    {0x00A82C, 0x00A82C, UnicodeCategory::Mn}, {0x00A830, 0x00A835, UnicodeCategory::No},
+    {0x00A836, 0x00A837, UnicodeCategory::So}, {0x00A838, 0x00A838, UnicodeCategory::Sc},
+    {0x00A839, 0x00A839, UnicodeCategory::So}, {0x00A840, 0x00A873, UnicodeCategory::Lo},
+    {0x00A874, 0x00A877, UnicodeCategory::Po}, {0x00A880, 0x00A881, UnicodeCategory::Mc},
+    {0x00A882, 0x00A8B3, UnicodeCategory::Lo}, {0x00A8B4, 0x00A8C3, UnicodeCategory::Mc},
+    {0x00A8C4, 0x00A8C5, UnicodeCategory::Mn}, {0x00A8CE, 0x00A8CF, UnicodeCategory::Po},
+    {0x00A8D0, 0x00A8D9, UnicodeCategory::Nd}, {0x00A8E0, 0x00A8F1, UnicodeCategory::Mn},
+    {0x00A8F2, 0x00A8F7, UnicodeCategory::Lo}, {0x00A8F8, 0x00A8FA, UnicodeCategory::Po},
+    {0x00A8FB, 0x00A8FB, UnicodeCategory::Lo}, {0x00A8FC, 0x00A8FC, UnicodeCategory::Po},
+    {0x00A8FD, 0x00A8FE, UnicodeCategory::Lo}, {0x00A8FF, 0x00A8FF, UnicodeCategory::Mn},
+    {0x00A900, 0x00A909, UnicodeCategory::Nd}, {0x00A90A, 0x00A925, UnicodeCategory::Lo},
+    {0x00A926, 0x00A92D, UnicodeCategory::Mn}, {0x00A92E, 0x00A92F, UnicodeCategory::Po},
+    {0x00A930, 0x00A946, UnicodeCategory::Lo}, {0x00A947, 0x00A951, UnicodeCategory::Mn},
+    {0x00A952, 0x00A953, UnicodeCategory::Mc}, {0x00A95F, 0x00A95F, UnicodeCategory::Po},
+    {0x00A960, 0x00A97C, UnicodeCategory::Lo}, {0x00A980, 0x00A982, UnicodeCategory::Mn},
+    {0x00A983, 0x00A983, UnicodeCategory::Mc}, {0x00A984, 0x00A9B2, UnicodeCategory::Lo},
+    {0x00A9B3, 0x00A9B3, UnicodeCategory::Mn}, {0x00A9B4, 0x00A9B5, UnicodeCategory::Mc},
+    {0x00A9B6, 0x00A9B9, UnicodeCategory::Mn}, {0x00A9BA, 0x00A9BB, UnicodeCategory::Mc},
+    {0x00A9BC, 0x00A9BD, UnicodeCategory::Mn}, {0x00A9BE, 0x00A9C0, UnicodeCategory::Mc},
+    {0x00A9C1, 0x00A9CD, UnicodeCategory::Po}, {0x00A9CF, 0x00A9CF, UnicodeCategory::Lm},
+    {0x00A9D0, 0x00A9D9, UnicodeCategory::Nd}, {0x00A9DE, 0x00A9DF, UnicodeCategory::Po},
+    {0x00A9E0, 0x00A9E4, UnicodeCategory::Lo}, {0x00A9E5, 0x00A9E5, UnicodeCategory::Mn},
+    {0x00A9E6, 0x00A9E6, UnicodeCategory::Lm}, {0x00A9E7, 0x00A9EF, UnicodeCategory::Lo},
+    {0x00A9F0, 0x00A9F9, UnicodeCategory::Nd}, {0x00A9FA, 0x00A9FE, UnicodeCategory::Lo},
+    {0x00AA00, 0x00AA28, UnicodeCategory::Lo}, {0x00AA29, 0x00AA2E, UnicodeCategory::Mn},
+    {0x00AA2F, 0x00AA30, UnicodeCategory::Mc}, {0x00AA31, 0x00AA32, UnicodeCategory::Mn},
+    {0x00AA33, 0x00AA34, UnicodeCategory::Mc}, {0x00AA35, 0x00AA36, UnicodeCategory::Mn},
+    {0x00AA40, 0x00AA42, UnicodeCategory::Lo}, {0x00AA43, 0x00AA43, UnicodeCategory::Mn},
+    {0x00AA44, 0x00AA4B, UnicodeCategory::Lo}, {0x00AA4C, 0x00AA4C, UnicodeCategory::Mn},
+    {0x00AA4D, 0x00AA4D, UnicodeCategory::Mc}, {0x00AA50, 0x00AA59, UnicodeCategory::Nd},
+    {0x00AA5C, 0x00AA5F, UnicodeCategory::Po}, {0x00AA60, 0x00AA6F, UnicodeCategory::Lo},
+    {0x00AA70, 0x00AA70, UnicodeCategory::Lm}, {0x00AA71, 0x00AA76, UnicodeCategory::Lo},
+    {0x00AA77, 0x00AA79, UnicodeCategory::So}, {0x00AA7A, 0x00AA7A, UnicodeCategory::Lo},
+    {0x00AA7B, 0x00AA7B, UnicodeCategory::Mc}, {0x00AA7C, 0x00AA7C, UnicodeCategory::Mn},
+    {0x00AA7D, 0x00AA7D, UnicodeCategory::Mc}, {0x00AA7E, 0x00AAAF, UnicodeCategory::Lo},
+    {0x00AAB0, 0x00AAB0, UnicodeCategory::Mn}, {0x00AAB1, 0x00AAB1, UnicodeCategory::Lo},
+    {0x00AAB2, 0x00AAB4, UnicodeCategory::Mn}, {0x00AAB5, 0x00AAB6, UnicodeCategory::Lo},
+    {0x00AAB7, 0x00AAB8, UnicodeCategory::Mn}, {0x00AAB9, 0x00AABD, UnicodeCategory::Lo},
+    {0x00AABE, 0x00AABF, UnicodeCategory::Mn}, {0x00AAC0, 0x00AAC0, UnicodeCategory::Lo},
+    {0x00AAC1, 0x00AAC1, UnicodeCategory::Mn}, {0x00AAC2, 0x00AAC2, UnicodeCategory::Lo},
+    {0x00AADB, 0x00AADC, UnicodeCategory::Lo}, {0x00AADD, 0x00AADD, UnicodeCategory::Lm},
+    {0x00AADE, 0x00AADF, UnicodeCategory::Po}, {0x00AAE0, 0x00AAEA, UnicodeCategory::Lo},
+    {0x00AAEB, 0x00AAEB, UnicodeCategory::Mc}, {0x00AAEC, 0x00AAED, UnicodeCategory::Mn},
+    {0x00AAEE, 0x00AAEF, UnicodeCategory::Mc}, {0x00AAF0, 0x00AAF1, UnicodeCategory::Po},
+    {0x00AAF2, 0x00AAF2, UnicodeCategory::Lo}, {0x00AAF3, 0x00AAF4, UnicodeCategory::Lm},
+    {0x00AAF5, 0x00AAF5, UnicodeCategory::Mc}, {0x00AAF6, 0x00AAF6, UnicodeCategory::Mn},
+    {0x00AB01, 0x00AB06, UnicodeCategory::Lo}, {0x00AB09, 0x00AB0E, UnicodeCategory::Lo},
+    {0x00AB11, 0x00AB16, UnicodeCategory::Lo}, {0x00AB20, 0x00AB26, UnicodeCategory::Lo},
+    {0x00AB28, 0x00AB2E, UnicodeCategory::Lo}, {0x00AB30, 0x00AB5A, UnicodeCategory::Ll},
+    {0x00AB5B, 0x00AB5B, UnicodeCategory::Sk}, {0x00AB5C, 0x00AB5F, UnicodeCategory::Lm},
+    {0x00AB60, 0x00AB68, UnicodeCategory::Ll}, {0x00AB69, 0x00AB69, UnicodeCategory::Lm},
+    {0x00AB6A, 0x00AB6B, UnicodeCategory::Sk}, {0x00AB70, 0x00ABBF, UnicodeCategory::Ll},
+    {0x00ABC0, 0x00ABE2, UnicodeCategory::Lo}, {0x00ABE3, 0x00ABE4, UnicodeCategory::Mc},
+    {0x00ABE5, 0x00ABE5, UnicodeCategory::Mn}, {0x00ABE6, 0x00ABE7, UnicodeCategory::Mc},
+    {0x00ABE8, 0x00ABE8, UnicodeCategory::Mn}, {0x00ABE9, 0x00ABEA, UnicodeCategory::Mc},
+    {0x00ABEB, 0x00ABEB, UnicodeCategory::Po}, {0x00ABEC, 0x00ABEC, UnicodeCategory::Mc},
+    {0x00ABED, 0x00ABED, UnicodeCategory::Mn}, {0x00ABF0, 0x00ABF9, UnicodeCategory::Nd},
+    {0x00AC00, 0x00D7A3, UnicodeCategory::Lo}, {0x00D7B0, 0x00D7C6, UnicodeCategory::Lo},
+    {0x00D7CB, 0x00D7FB, UnicodeCategory::Lo}, {0x00D800, 0x00DFFF, UnicodeCategory::Cs},
+    {0x00E000, 0x00F8FF, UnicodeCategory::Co}, {0x00F900, 0x00FA6D, UnicodeCategory::Lo},
+    {0x00FA70, 0x00FAD9, UnicodeCategory::Lo}, {0x00FB00, 0x00FB06, UnicodeCategory::Ll},
+    {0x00FB13, 0x00FB17, UnicodeCategory::Ll}, {0x00FB1D, 0x00FB1D, UnicodeCategory::Lo},
+    {0x00FB1E, 0x00FB1E, UnicodeCategory::Mn}, {0x00FB1F, 0x00FB28, UnicodeCategory::Lo},
+    {0x00FB29, 0x00FB29, UnicodeCategory::Sm}, {0x00FB2A, 0x00FB36, UnicodeCategory::Lo},
+    {0x00FB38, 0x00FB3C, UnicodeCategory::Lo}, {0x00FB3E, 0x00FB3E, UnicodeCategory::Lo},
+    {0x00FB40, 0x00FB41, UnicodeCategory::Lo}, {0x00FB43, 0x00FB44, UnicodeCategory::Lo},
+    {0x00FB46, 0x00FBB1, UnicodeCategory::Lo}, {0x00FBB2, 0x00FBC2, UnicodeCategory::Sk},
+    {0x00FBD3, 0x00FD3D, UnicodeCategory::Lo}, {0x00FD3E, 0x00FD3E, UnicodeCategory::Pe},
+    {0x00FD3F, 0x00FD3F, UnicodeCategory::Ps}, {0x00FD40, 0x00FD4F, UnicodeCategory::So},
+    {0x00FD50, 0x00FD8F, UnicodeCategory::Lo}, {0x00FD92, 0x00FDC7, UnicodeCategory::Lo},
+    {0x00FDCF, 0x00FDCF, UnicodeCategory::So}, {0x00FDF0, 0x00FDFB, UnicodeCategory::Lo},
+    {0x00FDFC, 0x00FDFC, UnicodeCategory::Sc}, {0x00FDFD, 0x00FDFF, UnicodeCategory::So},
+    {0x00FE00, 0x00FE0F, UnicodeCategory::Mn}, {0x00FE10, 0x00FE16, UnicodeCategory::Po},
+    {0x00FE17, 0x00FE17, UnicodeCategory::Ps}, {0x00FE18, 0x00FE18, UnicodeCategory::Pe},
+    {0x00FE19, 0x00FE19, UnicodeCategory::Po}, {0x00FE20, 0x00FE2F, UnicodeCategory::Mn},
+    {0x00FE30, 0x00FE30, UnicodeCategory::Po}, {0x00FE31, 0x00FE32, UnicodeCategory::Pd},
+    {0x00FE33, 0x00FE34, UnicodeCategory::Pc}, {0x00FE35, 0x00FE35, UnicodeCategory::Ps},
+    {0x00FE36, 0x00FE36, UnicodeCategory::Pe}, {0x00FE37, 0x00FE37, UnicodeCategory::Ps},
+    {0x00FE38, 0x00FE38, UnicodeCategory::Pe}, {0x00FE39, 0x00FE39, UnicodeCategory::Ps},
+    {0x00FE3A, 0x00FE3A, UnicodeCategory::Pe}, {0x00FE3B, 0x00FE3B, UnicodeCategory::Ps},
+    {0x00FE3C, 0x00FE3C, UnicodeCategory::Pe}, {0x00FE3D, 0x00FE3D, UnicodeCategory::Ps},
+    {0x00FE3E, 0x00FE3E, UnicodeCategory::Pe}, {0x00FE3F, 0x00FE3F, UnicodeCategory::Ps},
+    {0x00FE40, 0x00FE40, UnicodeCategory::Pe}, {0x00FE41, 0x00FE41, UnicodeCategory::Ps},
+    {0x00FE42, 0x00FE42, UnicodeCategory::Pe}, {0x00FE43, 0x00FE43, UnicodeCategory::Ps},
+    {0x00FE44, 0x00FE44, UnicodeCategory::Pe}, {0x00FE45, 0x00FE46, UnicodeCategory::Po},
+    {0x00FE47, 0x00FE47, UnicodeCategory::Ps}, {0x00FE48, 0x00FE48, UnicodeCategory::Pe},
+    {0x00FE49, 0x00FE4C, UnicodeCategory::Po}, {0x00FE4D, 0x00FE4F, UnicodeCategory::Pc},
+    {0x00FE50, 0x00FE52, UnicodeCategory::Po}, {0x00FE54, 0x00FE57, UnicodeCategory::Po},
+    {0x00FE58, 0x00FE58, UnicodeCategory::Pd}, {0x00FE59, 0x00FE59, UnicodeCategory::Ps},
+    {0x00FE5A, 0x00FE5A, UnicodeCategory::Pe}, {0x00FE5B, 0x00FE5B, UnicodeCategory::Ps},
+    {0x00FE5C, 0x00FE5C, UnicodeCategory::Pe}, {0x00FE5D, 0x00FE5D, UnicodeCategory::Ps},
+    {0x00FE5E, 0x00FE5E, UnicodeCategory::Pe}, {0x00FE5F, 0x00FE61, UnicodeCategory::Po},
+    {0x00FE62, 0x00FE62, UnicodeCategory::Sm}, {0x00FE63, 0x00FE63, UnicodeCategory::Pd},
+    {0x00FE64, 0x00FE66, UnicodeCategory::Sm}, {0x00FE68, 0x00FE68, UnicodeCategory::Po},
+    {0x00FE69, 0x00FE69, UnicodeCategory::Sc}, {0x00FE6A, 0x00FE6B, UnicodeCategory::Po},
+    {0x00FE70, 0x00FE74, UnicodeCategory::Lo}, {0x00FE76, 0x00FEFC, UnicodeCategory::Lo},
+    {0x00FEFF, 0x00FEFF, UnicodeCategory::Cf}, {0x00FF01, 0x00FF03, UnicodeCategory::Po},
+    {0x00FF04, 0x00FF04, UnicodeCategory::Sc}, {0x00FF05, 0x00FF07, UnicodeCategory::Po},
+    {0x00FF08, 0x00FF08, UnicodeCategory::Ps}, {0x00FF09, 0x00FF09, UnicodeCategory::Pe},
+    {0x00FF0A, 0x00FF0A, UnicodeCategory::Po}, {0x00FF0B, 0x00FF0B, UnicodeCategory::Sm},
+    {0x00FF0C, 0x00FF0C, UnicodeCategory::Po}, {0x00FF0D, 0x00FF0D, UnicodeCategory::Pd},
+    {0x00FF0E, 0x00FF0F, UnicodeCategory::Po}, {0x00FF10, 0x00FF19, UnicodeCategory::Nd},
+    {0x00FF1A, 0x00FF1B, UnicodeCategory::Po}, {0x00FF1C, 0x00FF1E, UnicodeCategory::Sm},
+    {0x00FF1F, 0x00FF20, UnicodeCategory::Po}, {0x00FF21, 0x00FF3A, UnicodeCategory::Lu},
+    {0x00FF3B, 0x00FF3B, UnicodeCategory::Ps}, {0x00FF3C, 0x00FF3C, UnicodeCategory::Po},
+    {0x00FF3D, 0x00FF3D, UnicodeCategory::Pe}, {0x00FF3E, 0x00FF3E, UnicodeCategory::Sk},
+    {0x00FF3F, 0x00FF3F, UnicodeCategory::Pc}, {0x00FF40, 0x00FF40, UnicodeCategory::Sk},
+    {0x00FF41, 0x00FF5A, UnicodeCategory::Ll}, {0x00FF5B, 0x00FF5B, UnicodeCategory::Ps},
+    {0x00FF5C, 0x00FF5C, UnicodeCategory::Sm}, {0x00FF5D, 0x00FF5D, UnicodeCategory::Pe},
+    {0x00FF5E, 0x00FF5E, UnicodeCategory::Sm}, {0x00FF5F, 0x00FF5F, UnicodeCategory::Ps},
+    {0x00FF60, 0x00FF60, UnicodeCategory::Pe}, {0x00FF61, 0x00FF61, UnicodeCategory::Po},
+    {0x00FF62, 0x00FF62, UnicodeCategory::Ps}, {0x00FF63, 0x00FF63, UnicodeCategory::Pe},
+    {0x00FF64, 0x00FF65, UnicodeCategory::Po}, {0x00FF66, 0x00FF6F, UnicodeCategory::Lo},
+    {0x00FF70, 0x00FF70, UnicodeCategory::Lm}, {0x00FF71, 0x00FF9D, UnicodeCategory::Lo},
+    {0x00FF9E, 0x00FF9F, UnicodeCategory::Lm}, {0x00FFA0, 0x00FFBE, UnicodeCategory::Lo},
+    {0x00FFC2, 0x00FFC7, UnicodeCategory::Lo}, {0x00FFCA, 0x00FFCF, UnicodeCategory::Lo},
+    {0x00FFD2, 0x00FFD7, UnicodeCategory::Lo}, {0x00FFDA, 0x00FFDC, UnicodeCategory::Lo},
+    {0x00FFE0, 0x00FFE1, UnicodeCategory::Sc}, {0x00FFE2, 0x00FFE2, UnicodeCategory::Sm},
+    {0x00FFE3, 0x00FFE3, UnicodeCategory::Sk}, {0x00FFE4, 0x00FFE4, UnicodeCategory::So},
+    {0x00FFE5, 0x00FFE6, UnicodeCategory::Sc}, {0x00FFE8, 0x00FFE8, UnicodeCategory::So},
+    {0x00FFE9, 0x00FFEC, UnicodeCategory::Sm}, {0x00FFED, 0x00FFEE, UnicodeCategory::So},
+    {0x00FFF9, 0x00FFFB, UnicodeCategory::Cf}, {0x00FFFC, 0x00FFFD, UnicodeCategory::So},
+    {0x010000, 0x01000B, UnicodeCategory::Lo}, {0x01000D, 0x010026, UnicodeCategory::Lo},
+    {0x010028, 0x01003A, UnicodeCategory::Lo}, {0x01003C, 0x01003D, UnicodeCategory::Lo},
+    {0x01003F, 0x01004D, UnicodeCategory::Lo}, {0x010050, 0x01005D, UnicodeCategory::Lo},
+    {0x010080, 0x0100FA, UnicodeCategory::Lo}, {0x010100, 0x010102, UnicodeCategory::Po},
+    {0x010107, 0x010133, UnicodeCategory::No}, {0x010137, 0x01013F, UnicodeCategory::So},
+    {0x010140, 0x010174, UnicodeCategory::Nl}, {0x010175, 0x010178, UnicodeCategory::No},
+    {0x010179, 0x010189, UnicodeCategory::So}, {0x01018A, 0x01018B, UnicodeCategory::No},
+    {0x01018C, 0x01018E, UnicodeCategory::So}, {0x010190, 0x01019C, UnicodeCategory::So},
+    {0x0101A0, 0x0101A0, UnicodeCategory::So}, {0x0101D0, 0x0101FC, UnicodeCategory::So},
+    {0x0101FD, 0x0101FD, UnicodeCategory::Mn}, {0x010280, 0x01029C, UnicodeCategory::Lo},
+    {0x0102A0, 0x0102D0, UnicodeCategory::Lo}, {0x0102E0, 0x0102E0, UnicodeCategory::Mn},
+    {0x0102E1, 0x0102FB, UnicodeCategory::No}, {0x010300, 0x01031F, UnicodeCategory::Lo},
+    {0x010320, 0x010323, UnicodeCategory::No}, {0x01032D, 0x010340, UnicodeCategory::Lo},
+    {0x010341, 0x010341, UnicodeCategory::Nl}, {0x010342, 0x010349, UnicodeCategory::Lo},
+    {0x01034A, 0x01034A, UnicodeCategory::Nl}, {0x010350, 0x010375, UnicodeCategory::Lo},
+    {0x010376, 0x01037A, UnicodeCategory::Mn}, {0x010380, 0x01039D, UnicodeCategory::Lo},
+    {0x01039F, 0x01039F, UnicodeCategory::Po}, {0x0103A0, 0x0103C3, UnicodeCategory::Lo},
+    {0x0103C8, 0x0103CF, UnicodeCategory::Lo}, {0x0103D0, 0x0103D0, UnicodeCategory::Po},
+    {0x0103D1, 0x0103D5, UnicodeCategory::Nl}, {0x010400, 0x010427, UnicodeCategory::Lu},
+    {0x010428, 0x01044F, UnicodeCategory::Ll}, {0x010450, 0x01049D, UnicodeCategory::Lo},
+    {0x0104A0, 0x0104A9, UnicodeCategory::Nd}, {0x0104B0, 0x0104D3, UnicodeCategory::Lu},
+    {0x0104D8, 0x0104FB, UnicodeCategory::Ll}, {0x010500, 0x010527, UnicodeCategory::Lo},
+    {0x010530, 0x010563, UnicodeCategory::Lo}, {0x01056F, 0x01056F, UnicodeCategory::Po},
+    {0x010570, 0x01057A, UnicodeCategory::Lu}, {0x01057C, 0x01058A, UnicodeCategory::Lu},
+    {0x01058C, 0x010592, UnicodeCategory::Lu}, {0x010594, 0x010595, UnicodeCategory::Lu},
+    {0x010597, 0x0105A1, UnicodeCategory::Ll}, {0x0105A3, 0x0105B1, UnicodeCategory::Ll},
+    {0x0105B3, 0x0105B9, UnicodeCategory::Ll}, {0x0105BB, 0x0105BC, UnicodeCategory::Ll},
+    {0x010600, 0x010736, UnicodeCategory::Lo}, {0x010740, 0x010755, UnicodeCategory::Lo},
+    {0x010760, 0x010767, UnicodeCategory::Lo}, {0x010780, 0x010785, UnicodeCategory::Lm},
+    {0x010787, 0x0107B0, UnicodeCategory::Lm}, {0x0107B2, 0x0107BA, UnicodeCategory::Lm},
+    {0x010800, 0x010805, UnicodeCategory::Lo}, {0x010808, 0x010808, UnicodeCategory::Lo},
+    {0x01080A, 0x010835, UnicodeCategory::Lo}, {0x010837, 0x010838, UnicodeCategory::Lo},
+    {0x01083C, 0x01083C, UnicodeCategory::Lo}, {0x01083F, 0x010855, UnicodeCategory::Lo},
+    {0x010857, 0x010857, UnicodeCategory::Po}, {0x010858, 0x01085F, UnicodeCategory::No},
+    {0x010860, 0x010876, UnicodeCategory::Lo}, {0x010877, 0x010878, UnicodeCategory::So},
+    {0x010879, 0x01087F, UnicodeCategory::No}, {0x010880, 0x01089E, UnicodeCategory::Lo},
+    {0x0108A7, 0x0108AF, UnicodeCategory::No}, {0x0108E0, 0x0108F2, UnicodeCategory::Lo},
+    {0x0108F4, 0x0108F5, UnicodeCategory::Lo}, {0x0108FB, 0x0108FF, UnicodeCategory::No},
+    {0x010900, 0x010915, UnicodeCategory::Lo}, {0x010916, 0x01091B, UnicodeCategory::No},
+    {0x01091F, 0x01091F, UnicodeCategory::Po}, {0x010920, 0x010939, UnicodeCategory::Lo},
+    {0x01093F, 0x01093F, UnicodeCategory::Po}, {0x010980, 0x0109B7, UnicodeCategory::Lo},
+    {0x0109BC, 0x0109BD, UnicodeCategory::No}, {0x0109BE, 0x0109BF, UnicodeCategory::Lo},
+    {0x0109C0, 0x0109CF, UnicodeCategory::No}, {0x0109D2, 0x0109FF, UnicodeCategory::No},
+    {0x010A00, 0x010A00, UnicodeCategory::Lo}, {0x010A01, 0x010A03, UnicodeCategory::Mn},
+    {0x010A05, 0x010A06, UnicodeCategory::Mn}, {0x010A0C, 0x010A0F, UnicodeCategory::Mn},
+    {0x010A10, 0x010A13, UnicodeCategory::Lo}, {0x010A15, 0x010A17, UnicodeCategory::Lo},
+    {0x010A19, 0x010A35, UnicodeCategory::Lo}, {0x010A38, 0x010A3A, UnicodeCategory::Mn},
+    {0x010A3F, 0x010A3F, UnicodeCategory::Mn}, {0x010A40, 0x010A48, UnicodeCategory::No},
+    {0x010A50, 0x010A58, UnicodeCategory::Po}, {0x010A60, 0x010A7C, UnicodeCategory::Lo},
+    {0x010A7D, 0x010A7E, UnicodeCategory::No}, {0x010A7F, 0x010A7F, UnicodeCategory::Po},
+    {0x010A80, 0x010A9C, UnicodeCategory::Lo}, {0x010A9D, 0x010A9F, UnicodeCategory::No},
+    {0x010AC0, 0x010AC7, UnicodeCategory::Lo}, {0x010AC8, 0x010AC8, UnicodeCategory::So},
+    {0x010AC9, 0x010AE4, UnicodeCategory::Lo}, {0x010AE5, 0x010AE6, UnicodeCategory::Mn},
+    {0x010AEB, 0x010AEF, UnicodeCategory::No}, {0x010AF0, 0x010AF6, UnicodeCategory::Po},
+    {0x010B00, 0x010B35, UnicodeCategory::Lo}, {0x010B39, 0x010B3F, UnicodeCategory::Po},
+    {0x010B40, 0x010B55, UnicodeCategory::Lo}, {0x010B58, 0x010B5F, UnicodeCategory::No},
+    {0x010B60, 0x010B72, UnicodeCategory::Lo}, {0x010B78, 0x010B7F, UnicodeCategory::No},
+    {0x010B80, 0x010B91, UnicodeCategory::Lo}, {0x010B99, 0x010B9C, UnicodeCategory::Po},
+    {0x010BA9, 0x010BAF, UnicodeCategory::No}, {0x010C00, 0x010C48, UnicodeCategory::Lo},
+    {0x010C80, 0x010CB2, UnicodeCategory::Lu}, {0x010CC0, 0x010CF2, UnicodeCategory::Ll},
+    {0x010CFA, 0x010CFF, UnicodeCategory::No}, {0x010D00, 0x010D23, UnicodeCategory::Lo},
+    {0x010D24, 0x010D27, UnicodeCategory::Mn}, {0x010D30, 0x010D39, UnicodeCategory::Nd},
+    {0x010E60, 0x010E7E, UnicodeCategory::No}, {0x010E80, 0x010EA9, UnicodeCategory::Lo},
+    {0x010EAB, 0x010EAC, UnicodeCategory::Mn}, {0x010EAD, 0x010EAD, UnicodeCategory::Pd},
+    {0x010EB0, 0x010EB1, UnicodeCategory::Lo}, {0x010F00, 0x010F1C, UnicodeCategory::Lo},
+    {0x010F1D, 0x010F26, UnicodeCategory::No}, {0x010F27, 0x010F27, UnicodeCategory::Lo},
+    {0x010F30, 0x010F45, UnicodeCategory::Lo}, {0x010F46, 0x010F50, UnicodeCategory::Mn},
+    {0x010F51, 0x010F54, UnicodeCategory::No}, {0x010F55, 0x010F59, UnicodeCategory::Po},
+    {0x010F70, 0x010F81, UnicodeCategory::Lo}, {0x010F82, 0x010F85, UnicodeCategory::Mn},
+    {0x010F86, 0x010F89, UnicodeCategory::Po}, {0x010FB0, 0x010FC4, UnicodeCategory::Lo},
+    {0x010FC5, 0x010FCB, UnicodeCategory::No}, {0x010FE0, 0x010FF6, UnicodeCategory::Lo},
+    {0x011000, 0x011000, UnicodeCategory::Mc}, {0x011001, 0x011001, UnicodeCategory::Mn},
+    {0x011002, 0x011002, UnicodeCategory::Mc}, {0x011003, 0x011037, UnicodeCategory::Lo},
+    {0x011038, 0x011046, UnicodeCategory::Mn}, {0x011047, 0x01104D, UnicodeCategory::Po},
+    {0x011052, 0x011065, UnicodeCategory::No}, {0x011066, 0x01106F, UnicodeCategory::Nd},
+    {0x011070, 0x011070, UnicodeCategory::Mn}, {0x011071, 0x011072, UnicodeCategory::Lo},
+    {0x011073, 0x011074, UnicodeCategory::Mn}, {0x011075, 0x011075, UnicodeCategory::Lo},
+    {0x01107F, 0x011081, UnicodeCategory::Mn}, {0x011082, 0x011082, UnicodeCategory::Mc},
+    {0x011083, 0x0110AF, UnicodeCategory::Lo}, {0x0110B0, 0x0110B2, UnicodeCategory::Mc},
+    {0x0110B3, 0x0110B6, UnicodeCategory::Mn}, {0x0110B7, 0x0110B8, UnicodeCategory::Mc},
+    {0x0110B9, 0x0110BA, UnicodeCategory::Mn}, {0x0110BB, 0x0110BC, UnicodeCategory::Po},
+    {0x0110BD, 0x0110BD, UnicodeCategory::Cf}, {0x0110BE, 0x0110C1, UnicodeCategory::Po},
+    {0x0110C2, 0x0110C2, UnicodeCategory::Mn}, {0x0110CD, 0x0110CD, UnicodeCategory::Cf},
+    {0x0110D0, 0x0110E8, UnicodeCategory::Lo}, {0x0110F0, 0x0110F9, UnicodeCategory::Nd},
+    {0x011100, 0x011102, UnicodeCategory::Mn}, {0x011103, 0x011126, UnicodeCategory::Lo},
+    {0x011127, 0x01112B, UnicodeCategory::Mn}, {0x01112C, 0x01112C, UnicodeCategory::Mc},
+    {0x01112D, 0x011134, UnicodeCategory::Mn}, {0x011136, 0x01113F, UnicodeCategory::Nd},
+    {0x011140, 0x011143, UnicodeCategory::Po}, {0x011144, 0x011144, UnicodeCategory::Lo},
+    {0x011145, 0x011146, UnicodeCategory::Mc}, {0x011147, 0x011147, UnicodeCategory::Lo},
+    {0x011150, 0x011172, UnicodeCategory::Lo}, {0x011173, 0x011173, UnicodeCategory::Mn},
+    {0x011174, 0x011175, UnicodeCategory::Po}, {0x011176, 0x011176, UnicodeCategory::Lo},
+    {0x011180, 0x011181, UnicodeCategory::Mn}, {0x011182, 0x011182, UnicodeCategory::Mc},
+    {0x011183, 0x0111B2, UnicodeCategory::Lo}, {0x0111B3, 0x0111B5, UnicodeCategory::Mc},
+    {0x0111B6, 0x0111BE, UnicodeCategory::Mn}, {0x0111BF, 0x0111C0, UnicodeCategory::Mc},
+    {0x0111C1, 0x0111C4, UnicodeCategory::Lo}, {0x0111C5, 0x0111C8, UnicodeCategory::Po},
+    {0x0111C9, 0x0111CC, UnicodeCategory::Mn}, {0x0111CD, 0x0111CD, UnicodeCategory::Po},
+    {0x0111CE, 0x0111CE, UnicodeCategory::Mc}, {0x0111CF, 0x0111CF, UnicodeCategory::Mn},
+    {0x0111D0, 0x0111D9, UnicodeCategory::Nd}, {0x0111DA, 0x0111DA, UnicodeCategory::Lo},
+    {0x0111DB, 0x0111DB, UnicodeCategory::Po}, {0x0111DC, 0x0111DC, UnicodeCategory::Lo},
+    {0x0111DD, 0x0111DF, UnicodeCategory::Po}, {0x0111E1, 0x0111F4, UnicodeCategory::No},
+    {0x011200, 0x011211, UnicodeCategory::Lo}, {0x011213, 0x01122B, UnicodeCategory::Lo},
+    {0x01122C, 0x01122E, UnicodeCategory::Mc}, {0x01122F, 0x011231, UnicodeCategory::Mn},
+    {0x011232, 0x011233, UnicodeCategory::Mc}, {0x011234, 0x011234, UnicodeCategory::Mn},
+    {0x011235, 0x011235, UnicodeCategory::Mc}, {0x011236, 0x011237, UnicodeCategory::Mn},
+    {0x011238, 0x01123D, UnicodeCategory::Po}, {0x01123E, 0x01123E, UnicodeCategory::Mn},
+    {0x011280, 0x011286, UnicodeCategory::Lo}, {0x011288, 0x011288, UnicodeCategory::Lo},
+    {0x01128A, 0x01128D, UnicodeCategory::Lo}, {0x01128F, 0x01129D, UnicodeCategory::Lo},
+    {0x01129F, 0x0112A8, UnicodeCategory::Lo}, {0x0112A9, 0x0112A9, UnicodeCategory::Po},
+    {0x0112B0, 0x0112DE, UnicodeCategory::Lo}, {0x0112DF, 0x0112DF, UnicodeCategory::Mn},
+    {0x0112E0, 0x0112E2, UnicodeCategory::Mc}, {0x0112E3, 0x0112EA, UnicodeCategory::Mn},
+    {0x0112F0, 0x0112F9, UnicodeCategory::Nd}, {0x011300, 0x011301, UnicodeCategory::Mn},
+    {0x011302, 0x011303, UnicodeCategory::Mc}, {0x011305, 0x01130C, UnicodeCategory::Lo},
+    {0x01130F, 0x011310, UnicodeCategory::Lo}, {0x011313, 0x011328, UnicodeCategory::Lo},
+    {0x01132A, 0x011330, UnicodeCategory::Lo}, {0x011332, 0x011333, UnicodeCategory::Lo},
+    {0x011335, 0x011339, UnicodeCategory::Lo}, {0x01133B, 0x01133C, UnicodeCategory::Mn},
+    {0x01133D, 0x01133D, UnicodeCategory::Lo}, {0x01133E, 0x01133F, UnicodeCategory::Mc},
+    {0x011340, 0x011340, UnicodeCategory::Mn}, {0x011341, 0x011344, UnicodeCategory::Mc},
+    {0x011347, 0x011348, UnicodeCategory::Mc}, {0x01134B, 0x01134D, UnicodeCategory::Mc},
+    {0x011350, 0x011350, UnicodeCategory::Lo}, {0x011357, 0x011357, UnicodeCategory::Mc},
+    {0x01135D, 0x011361, UnicodeCategory::Lo}, {0x011362, 0x011363, UnicodeCategory::Mc},
+    {0x011366, 0x01136C, UnicodeCategory::Mn}, {0x011370, 0x011374, UnicodeCategory::Mn},
+    {0x011400, 0x011434, UnicodeCategory::Lo}, {0x011435, 0x011437, UnicodeCategory::Mc},
+    {0x011438, 0x01143F, UnicodeCategory::Mn}, {0x011440, 0x011441, UnicodeCategory::Mc},
+    {0x011442, 0x011444, UnicodeCategory::Mn}, {0x011445, 0x011445, UnicodeCategory::Mc},
+    {0x011446, 0x011446, UnicodeCategory::Mn}, {0x011447, 0x01144A, UnicodeCategory::Lo},
+    {0x01144B, 0x01144F, UnicodeCategory::Po}, {0x011450, 0x011459, UnicodeCategory::Nd},
+    {0x01145A, 0x01145B, UnicodeCategory::Po}, {0x01145D, 0x01145D, UnicodeCategory::Po},
+    {0x01145E, 0x01145E, UnicodeCategory::Mn}, {0x01145F, 0x011461, UnicodeCategory::Lo},
+    {0x011480, 0x0114AF, UnicodeCategory::Lo}, {0x0114B0, 0x0114B2, UnicodeCategory::Mc},
+    {0x0114B3, 0x0114B8, UnicodeCategory::Mn}, {0x0114B9, 0x0114B9, UnicodeCategory::Mc},
+    {0x0114BA, 0x0114BA, UnicodeCategory::Mn}, {0x0114BB, 0x0114BE, UnicodeCategory::Mc},
+    {0x0114BF, 0x0114C0, UnicodeCategory::Mn}, {0x0114C1, 0x0114C1, UnicodeCategory::Mc},
+    {0x0114C2, 0x0114C3, UnicodeCategory::Mn}, {0x0114C4, 0x0114C5, UnicodeCategory::Lo},
+    {0x0114C6, 0x0114C6, UnicodeCategory::Po}, {0x0114C7, 0x0114C7, UnicodeCategory::Lo},
+    {0x0114D0, 0x0114D9, UnicodeCategory::Nd}, {0x011580, 0x0115AE, UnicodeCategory::Lo},
+    {0x0115AF, 0x0115B1, UnicodeCategory::Mc}, {0x0115B2, 0x0115B5, UnicodeCategory::Mn},
+    {0x0115B8, 0x0115BB, UnicodeCategory::Mc}, {0x0115BC, 0x0115BD, UnicodeCategory::Mn},
+    {0x0115BE, 0x0115BE, UnicodeCategory::Mc}, {0x0115BF, 0x0115C0, UnicodeCategory::Mn},
+    {0x0115C1, 0x0115D7, UnicodeCategory::Po}, {0x0115D8, 0x0115DB, UnicodeCategory::Lo},
+    {0x0115DC, 0x0115DD, UnicodeCategory::Mn}, {0x011600, 0x01162F, UnicodeCategory::Lo},
+    {0x011630, 0x011632, UnicodeCategory::Mc}, {0x011633, 0x01163A, UnicodeCategory::Mn},
+    {0x01163B, 0x01163C, UnicodeCategory::Mc}, {0x01163D, 0x01163D, UnicodeCategory::Mn},
+    {0x01163E, 0x01163E, UnicodeCategory::Mc}, {0x01163F, 0x011640, UnicodeCategory::Mn},
+    {0x011641, 0x011643, UnicodeCategory::Po}, {0x011644, 0x011644, UnicodeCategory::Lo},
+    {0x011650, 0x011659, UnicodeCategory::Nd}, {0x011660, 0x01166C, UnicodeCategory::Po},
+    {0x011680, 0x0116AA, UnicodeCategory::Lo}, {0x0116AB, 0x0116AB, UnicodeCategory::Mn},
+    {0x0116AC, 0x0116AC, UnicodeCategory::Mc}, {0x0116AD, 0x0116AD, UnicodeCategory::Mn},
+    {0x0116AE, 0x0116AF, UnicodeCategory::Mc}, {0x0116B0, 0x0116B5, UnicodeCategory::Mn},
+    {0x0116B6, 0x0116B6, UnicodeCategory::Mc}, {0x0116B7, 0x0116B7, UnicodeCategory::Mn},
+    {0x0116B8, 0x0116B8, UnicodeCategory::Lo}, {0x0116B9, 0x0116B9, UnicodeCategory::Po},
+    {0x0116C0, 0x0116C9, UnicodeCategory::Nd}, {0x011700, 0x01171A, UnicodeCategory::Lo},
+    {0x01171D, 0x01171F, UnicodeCategory::Mn}, {0x011720, 0x011721, UnicodeCategory::Mc},
+    {0x011722, 0x011725, UnicodeCategory::Mn}, {0x011726, 0x011726, UnicodeCategory::Mc},
+    {0x011727, 0x01172B, UnicodeCategory::Mn}, {0x011730, 0x011739, UnicodeCategory::Nd},
+    {0x01173A, 0x01173B, UnicodeCategory::No}, {0x01173C, 0x01173E, UnicodeCategory::Po},
+    {0x01173F, 0x01173F, UnicodeCategory::So}, {0x011740, 0x011746, UnicodeCategory::Lo},
+    {0x011800, 0x01182B, UnicodeCategory::Lo}, {0x01182C, 0x01182E, UnicodeCategory::Mc},
+    {0x01182F, 0x011837, UnicodeCategory::Mn}, {0x011838, 0x011838, UnicodeCategory::Mc},
+    {0x011839, 0x01183A, UnicodeCategory::Mn}, {0x01183B, 0x01183B, UnicodeCategory::Po},
+    {0x0118A0, 0x0118BF, UnicodeCategory::Lu}, {0x0118C0, 0x0118DF, UnicodeCategory::Ll},
+    {0x0118E0, 0x0118E9, UnicodeCategory::Nd}, {0x0118EA, 0x0118F2, UnicodeCategory::No},
+    {0x0118FF, 0x011906, UnicodeCategory::Lo}, {0x011909, 0x011909, UnicodeCategory::Lo},
+    {0x01190C, 0x011913, UnicodeCategory::Lo}, {0x011915, 0x011916, UnicodeCategory::Lo},
+    {0x011918, 0x01192F, UnicodeCategory::Lo}, {0x011930, 0x011935, UnicodeCategory::Mc},
+    {0x011937, 0x011938, UnicodeCategory::Mc}, {0x01193B, 0x01193C, UnicodeCategory::Mn},
+    {0x01193D, 0x01193D, UnicodeCategory::Mc}, {0x01193E, 0x01193E, UnicodeCategory::Mn},
+    {0x01193F, 0x01193F, UnicodeCategory::Lo}, {0x011940, 0x011940, UnicodeCategory::Mc},
+    {0x011941, 0x011941, UnicodeCategory::Lo}, {0x011942, 0x011942, UnicodeCategory::Mc},
+    {0x011943, 0x011943, UnicodeCategory::Mn}, {0x011944, 0x011946, UnicodeCategory::Po},
+    {0x011950, 0x011959, UnicodeCategory::Nd}, {0x0119A0, 0x0119A7, UnicodeCategory::Lo},
+    {0x0119AA, 0x0119D0, UnicodeCategory::Lo}, {0x0119D1, 0x0119D3, UnicodeCategory::Mc},
+    {0x0119D4, 0x0119D7, UnicodeCategory::Mn}, {0x0119DA, 0x0119DB, UnicodeCategory::Mn},
+    {0x0119DC, 0x0119DF, UnicodeCategory::Mc}, {0x0119E0, 0x0119E0, UnicodeCategory::Mn},
+    {0x0119E1, 0x0119E1, UnicodeCategory::Lo}, {0x0119E2, 0x0119E2, UnicodeCategory::Po},
+    {0x0119E3, 0x0119E3, UnicodeCategory::Lo}, {0x0119E4, 0x0119E4, UnicodeCategory::Mc},
+    {0x011A00, 0x011A00, UnicodeCategory::Lo}, {0x011A01, 0x011A0A, UnicodeCategory::Mn},
+    {0x011A0B, 0x011A32, UnicodeCategory::Lo}, {0x011A33, 0x011A38, UnicodeCategory::Mn},
+    {0x011A39, 0x011A39, UnicodeCategory::Mc}, {0x011A3A, 0x011A3A, UnicodeCategory::Lo},
+    {0x011A3B, 0x011A3E, UnicodeCategory::Mn}, {0x011A3F, 0x011A46, UnicodeCategory::Po},
+    {0x011A47, 0x011A47, UnicodeCategory::Mn}, {0x011A50, 0x011A50, UnicodeCategory::Lo},
+    {0x011A51, 0x011A56, UnicodeCategory::Mn}, {0x011A57, 0x011A58, UnicodeCategory::Mc},
+    {0x011A59, 0x011A5B, UnicodeCategory::Mn}, {0x011A5C, 0x011A89, UnicodeCategory::Lo},
+    {0x011A8A, 0x011A96, UnicodeCategory::Mn}, {0x011A97, 0x011A97, UnicodeCategory::Mc},
+    {0x011A98, 0x011A99, UnicodeCategory::Mn}, {0x011A9A, 0x011A9C, UnicodeCategory::Po},
+    {0x011A9D, 0x011A9D, UnicodeCategory::Lo}, {0x011A9E, 0x011AA2, UnicodeCategory::Po},
+    {0x011AB0, 0x011AF8, UnicodeCategory::Lo}, {0x011C00, 0x011C08, UnicodeCategory::Lo},
+    {0x011C0A, 0x011C2E, UnicodeCategory::Lo}, {0x011C2F, 0x011C2F, UnicodeCategory::Mc},
+    {0x011C30, 0x011C36, UnicodeCategory::Mn}, {0x011C38, 0x011C3D, UnicodeCategory::Mn},
+    {0x011C3E, 0x011C3E, UnicodeCategory::Mc}, {0x011C3F, 0x011C3F, UnicodeCategory::Mn},
+    {0x011C40, 0x011C40, UnicodeCategory::Lo}, {0x011C41, 0x011C45, UnicodeCategory::Po},
+    {0x011C50, 0x011C59, UnicodeCategory::Nd}, {0x011C5A, 0x011C6C, UnicodeCategory::No},
+    {0x011C70, 0x011C71, UnicodeCategory::Po}, {0x011C72, 0x011C8F, UnicodeCategory::Lo},
+    {0x011C92, 0x011CA7, UnicodeCategory::Mn}, {0x011CA9, 0x011CA9, UnicodeCategory::Mc},
+    {0x011CAA, 0x011CB0, UnicodeCategory::Mn}, {0x011CB1, 0x011CB1, UnicodeCategory::Mc},
+    {0x011CB2, 0x011CB3, UnicodeCategory::Mn}, {0x011CB4, 0x011CB4, UnicodeCategory::Mc},
+    {0x011CB5, 0x011CB6, UnicodeCategory::Mn}, {0x011D00, 0x011D06, UnicodeCategory::Lo},
+    {0x011D08, 0x011D09, UnicodeCategory::Lo}, {0x011D0B, 0x011D30, UnicodeCategory::Lo},
+    {0x011D31, 0x011D36, UnicodeCategory::Mn}, {0x011D3A, 0x011D3A, UnicodeCategory::Mn},
+    {0x011D3C, 0x011D3D, UnicodeCategory::Mn}, {0x011D3F, 0x011D45, UnicodeCategory::Mn},
+    {0x011D46, 0x011D46, UnicodeCategory::Lo}, {0x011D47, 0x011D47, UnicodeCategory::Mn},
+    {0x011D50, 0x011D59, UnicodeCategory::Nd}, {0x011D60, 0x011D65, UnicodeCategory::Lo},
+    {0x011D67, 0x011D68, UnicodeCategory::Lo}, {0x011D6A, 0x011D89, UnicodeCategory::Lo},
+    {0x011D8A, 0x011D8E, UnicodeCategory::Mc}, {0x011D90, 0x011D91, UnicodeCategory::Mn},
+    {0x011D93, 0x011D94, UnicodeCategory::Mc}, {0x011D95, 0x011D95, UnicodeCategory::Mn},
+    {0x011D96, 0x011D96, UnicodeCategory::Mc}, {0x011D97, 0x011D97, UnicodeCategory::Mn},
+    {0x011D98, 0x011D98, UnicodeCategory::Lo}, {0x011DA0, 0x011DA9, UnicodeCategory::Nd},
+    {0x011EE0, 0x011EF2, UnicodeCategory::Lo}, {0x011EF3, 0x011EF4, UnicodeCategory::Mn},
+    {0x011EF5, 0x011EF6, UnicodeCategory::Mc}, {0x011EF7, 0x011EF8, UnicodeCategory::Po},
+    {0x011FB0, 0x011FB0, UnicodeCategory::Lo}, {0x011FC0, 0x011FD4, UnicodeCategory::No},
+    {0x011FD5, 0x011FDC, UnicodeCategory::So}, {0x011FDD, 0x011FE0, UnicodeCategory::Sc},
+    {0x011FE1, 0x011FF1, UnicodeCategory::So}, {0x011FFF, 0x011FFF, UnicodeCategory::Po},
+    {0x012000, 0x012399, UnicodeCategory::Lo}, {0x012400, 0x01246E, UnicodeCategory::Nl},
+    {0x012470, 0x012474, UnicodeCategory::Po}, {0x012480, 0x012543, UnicodeCategory::Lo},
+    {0x012F90, 0x012FF0, UnicodeCategory::Lo}, {0x012FF1, 0x012FF2, UnicodeCategory::Po},
+    {0x013000, 0x01342E, UnicodeCategory::Lo}, {0x013430, 0x013438, UnicodeCategory::Cf},
+    {0x014400, 0x014646, UnicodeCategory::Lo}, {0x016800, 0x016A38, UnicodeCategory::Lo},
+    {0x016A40, 0x016A5E, UnicodeCategory::Lo}, {0x016A60, 0x016A69, UnicodeCategory::Nd},
+    {0x016A6E, 0x016A6F, UnicodeCategory::Po}, {0x016A70, 0x016ABE, UnicodeCategory::Lo},
+    {0x016AC0, 0x016AC9, UnicodeCategory::Nd}, {0x016AD0, 0x016AED, UnicodeCategory::Lo},
+    {0x016AF0, 0x016AF4, UnicodeCategory::Mn}, {0x016AF5, 0x016AF5, UnicodeCategory::Po},
+    {0x016B00, 0x016B2F, UnicodeCategory::Lo}, {0x016B30, 0x016B36, UnicodeCategory::Mn},
+    {0x016B37, 0x016B3B, UnicodeCategory::Po}, {0x016B3C, 0x016B3F, UnicodeCategory::So},
+    {0x016B40, 0x016B43, UnicodeCategory::Lm}, {0x016B44, 0x016B44, UnicodeCategory::Po},
+    {0x016B45, 0x016B45, UnicodeCategory::So}, {0x016B50, 0x016B59, UnicodeCategory::Nd},
+    {0x016B5B, 0x016B61, UnicodeCategory::No}, {0x016B63, 0x016B77, UnicodeCategory::Lo},
+    {0x016B7D, 0x016B8F, UnicodeCategory::Lo}, {0x016E40, 0x016E5F, UnicodeCategory::Lu},
+    {0x016E60, 0x016E7F, UnicodeCategory::Ll}, {0x016E80, 0x016E96, UnicodeCategory::No},
+    {0x016E97, 0x016E9A, UnicodeCategory::Po}, {0x016F00, 0x016F4A, UnicodeCategory::Lo},
+    {0x016F4F, 0x016F4F, UnicodeCategory::Mn}, {0x016F50, 0x016F50, UnicodeCategory::Lo},
+    {0x016F51, 0x016F87, UnicodeCategory::Mc}, {0x016F8F, 0x016F92, UnicodeCategory::Mn},
+    {0x016F93, 0x016F9F, UnicodeCategory::Lm}, {0x016FE0, 0x016FE1, UnicodeCategory::Lm},
+    {0x016FE2, 0x016FE2, UnicodeCategory::Po}, {0x016FE3, 0x016FE3, UnicodeCategory::Lm},
+    {0x016FE4, 0x016FE4, UnicodeCategory::Mn}, {0x016FF0, 0x016FF1, UnicodeCategory::Mc},
+    {0x017000, 0x0187F7, UnicodeCategory::Lo}, {0x018800, 0x018CD5, UnicodeCategory::Lo},
+    {0x018D00, 0x018D08, UnicodeCategory::Lo}, {0x01AFF0, 0x01AFF3, UnicodeCategory::Lm},
+    {0x01AFF5, 0x01AFFB, UnicodeCategory::Lm}, {0x01AFFD, 0x01AFFE, UnicodeCategory::Lm},
+    {0x01B000, 0x01B122, UnicodeCategory::Lo}, {0x01B150, 0x01B152, UnicodeCategory::Lo},
+    {0x01B164, 0x01B167, UnicodeCategory::Lo}, {0x01B170, 0x01B2FB, UnicodeCategory::Lo},
+    {0x01BC00, 0x01BC6A, UnicodeCategory::Lo}, {0x01BC70, 0x01BC7C, UnicodeCategory::Lo},
+    {0x01BC80, 0x01BC88, UnicodeCategory::Lo}, {0x01BC90, 0x01BC99, UnicodeCategory::Lo},
+    {0x01BC9C, 0x01BC9C, UnicodeCategory::So}, {0x01BC9D, 0x01BC9E, UnicodeCategory::Mn},
+    {0x01BC9F, 0x01BC9F, UnicodeCategory::Po}, {0x01BCA0, 0x01BCA3, UnicodeCategory::Cf},
+    {0x01CF00, 0x01CF2D, UnicodeCategory::Mn}, {0x01CF30, 0x01CF46, UnicodeCategory::Mn},
+    {0x01CF50, 0x01CFC3, UnicodeCategory::So}, {0x01D000, 0x01D0F5, UnicodeCategory::So},
+    {0x01D100, 0x01D126, UnicodeCategory::So}, {0x01D129, 0x01D164, UnicodeCategory::So},
+    {0x01D165, 0x01D166, UnicodeCategory::Mc}, {0x01D167, 0x01D169, UnicodeCategory::Mn},
+    {0x01D16A, 0x01D16C, UnicodeCategory::So}, {0x01D16D, 0x01D172, UnicodeCategory::Mc},
+    {0x01D173, 0x01D17A, UnicodeCategory::Cf}, {0x01D17B, 0x01D182, UnicodeCategory::Mn},
+    {0x01D183, 0x01D184, UnicodeCategory::So}, {0x01D185, 0x01D18B, UnicodeCategory::Mn},
+    {0x01D18C, 0x01D1A9, UnicodeCategory::So}, {0x01D1AA, 0x01D1AD, UnicodeCategory::Mn},
+    {0x01D1AE, 0x01D1EA, UnicodeCategory::So}, {0x01D200, 0x01D241, UnicodeCategory::So},
+    {0x01D242, 0x01D244, UnicodeCategory::Mn}, {0x01D245, 0x01D245, UnicodeCategory::So},
+    {0x01D2E0, 0x01D2F3, UnicodeCategory::No}, {0x01D300, 0x01D356, UnicodeCategory::So},
+    {0x01D360, 0x01D378, UnicodeCategory::No}, {0x01D400, 0x01D419, UnicodeCategory::Lu},
+    {0x01D41A, 0x01D433, UnicodeCategory::Ll}, {0x01D434, 0x01D44D, UnicodeCategory::Lu},
+    {0x01D44E, 0x01D454, UnicodeCategory::Ll}, {0x01D456, 0x01D467, UnicodeCategory::Ll},
+    {0x01D468, 0x01D481, UnicodeCategory::Lu}, {0x01D482, 0x01D49B, UnicodeCategory::Ll},
+    {0x01D49C, 0x01D49C, UnicodeCategory::Lu}, {0x01D49E, 0x01D49F, UnicodeCategory::Lu},
+    {0x01D4A2, 0x01D4A2, UnicodeCategory::Lu}, {0x01D4A5, 0x01D4A6, UnicodeCategory::Lu},
+    {0x01D4A9, 0x01D4AC, UnicodeCategory::Lu}, {0x01D4AE, 0x01D4B5, UnicodeCategory::Lu},
+    {0x01D4B6, 0x01D4B9, UnicodeCategory::Ll}, {0x01D4BB, 0x01D4BB, UnicodeCategory::Ll},
+    {0x01D4BD, 0x01D4C3, UnicodeCategory::Ll}, {0x01D4C5, 0x01D4CF, UnicodeCategory::Ll},
+    {0x01D4D0, 0x01D4E9, UnicodeCategory::Lu}, {0x01D4EA, 0x01D503, UnicodeCategory::Ll},
+    {0x01D504, 0x01D505, UnicodeCategory::Lu}, {0x01D507, 0x01D50A, UnicodeCategory::Lu},
+    {0x01D50D, 0x01D514, UnicodeCategory::Lu}, {0x01D516, 0x01D51C, UnicodeCategory::Lu},
+    {0x01D51E, 0x01D537, UnicodeCategory::Ll}, {0x01D538, 0x01D539, UnicodeCategory::Lu},
+    {0x01D53B, 0x01D53E, UnicodeCategory::Lu}, {0x01D540, 0x01D544, UnicodeCategory::Lu},
+    {0x01D546, 0x01D546, UnicodeCategory::Lu}, {0x01D54A, 0x01D550, UnicodeCategory::Lu},
+    {0x01D552, 0x01D56B, UnicodeCategory::Ll}, {0x01D56C, 0x01D585, UnicodeCategory::Lu},
+    {0x01D586, 0x01D59F, UnicodeCategory::Ll}, {0x01D5A0, 0x01D5B9, UnicodeCategory::Lu},
+    {0x01D5BA, 0x01D5D3, UnicodeCategory::Ll}, {0x01D5D4, 0x01D5ED, UnicodeCategory::Lu},
+    {0x01D5EE, 0x01D607, UnicodeCategory::Ll}, {0x01D608, 0x01D621, UnicodeCategory::Lu},
+    {0x01D622, 0x01D63B, UnicodeCategory::Ll}, {0x01D63C, 0x01D655, UnicodeCategory::Lu},
+    {0x01D656, 0x01D66F, UnicodeCategory::Ll}, {0x01D670, 0x01D689, UnicodeCategory::Lu},
+    {0x01D68A, 0x01D6A5, UnicodeCategory::Ll}, {0x01D6A8, 0x01D6C0, UnicodeCategory::Lu},
+    {0x01D6C1, 0x01D6C1, UnicodeCategory::Sm}, {0x01D6C2, 0x01D6DA, UnicodeCategory::Ll},
+    {0x01D6DB, 0x01D6DB, UnicodeCategory::Sm}, {0x01D6DC, 0x01D6E1, UnicodeCategory::Ll},
+    {0x01D6E2, 0x01D6FA, UnicodeCategory::Lu}, {0x01D6FB, 0x01D6FB, UnicodeCategory::Sm},
+    {0x01D6FC, 0x01D714, UnicodeCategory::Ll}, {0x01D715, 0x01D715, UnicodeCategory::Sm},
+    {0x01D716, 0x01D71B, UnicodeCategory::Ll}, {0x01D71C, 0x01D734, UnicodeCategory::Lu},
+    {0x01D735, 0x01D735, UnicodeCategory::Sm}, {0x01D736, 0x01D74E, UnicodeCategory::Ll},
+    {0x01D74F, 0x01D74F, UnicodeCategory::Sm}, {0x01D750, 0x01D755, UnicodeCategory::Ll},
+    {0x01D756, 0x01D76E, UnicodeCategory::Lu}, {0x01D76F, 0x01D76F, UnicodeCategory::Sm},
+    {0x01D770, 0x01D788, UnicodeCategory::Ll}, {0x01D789, 0x01D789, UnicodeCategory::Sm},
+    {0x01D78A, 0x01D78F, UnicodeCategory::Ll}, {0x01D790, 0x01D7A8, UnicodeCategory::Lu},
+    {0x01D7A9, 0x01D7A9, UnicodeCategory::Sm}, {0x01D7AA, 0x01D7C2, UnicodeCategory::Ll},
+    {0x01D7C3, 0x01D7C3, UnicodeCategory::Sm}, {0x01D7C4, 0x01D7C9, UnicodeCategory::Ll},
+    {0x01D7CA, 0x01D7CA, UnicodeCategory::Lu}, {0x01D7CB, 0x01D7CB, UnicodeCategory::Ll},
+    {0x01D7CE, 0x01D7FF, UnicodeCategory::Nd}, {0x01D800, 0x01D9FF, UnicodeCategory::So},
+    {0x01DA00, 0x01DA36, UnicodeCategory::Mn}, {0x01DA37, 0x01DA3A, UnicodeCategory::So},
+    {0x01DA3B, 0x01DA6C, UnicodeCategory::Mn}, {0x01DA6D, 0x01DA74, UnicodeCategory::So},
+    {0x01DA75, 0x01DA75, UnicodeCategory::Mn}, {0x01DA76, 0x01DA83, UnicodeCategory::So},
+    {0x01DA84, 0x01DA84, UnicodeCategory::Mn}, {0x01DA85, 0x01DA86, UnicodeCategory::So},
+    {0x01DA87, 0x01DA8B, UnicodeCategory::Po}, {0x01DA9B, 0x01DA9F, UnicodeCategory::Mn},
+    {0x01DAA1, 0x01DAAF, UnicodeCategory::Mn}, {0x01DF00, 0x01DF09, UnicodeCategory::Ll},
+    {0x01DF0A, 0x01DF0A, UnicodeCategory::Lo}, {0x01DF0B, 0x01DF1E, UnicodeCategory::Ll},
+    {0x01E000, 0x01E006, UnicodeCategory::Mn}, {0x01E008, 0x01E018, UnicodeCategory::Mn},
+    {0x01E01B, 0x01E021, UnicodeCategory::Mn}, {0x01E023, 0x01E024, UnicodeCategory::Mn},
+    {0x01E026, 0x01E02A, UnicodeCategory::Mn}, {0x01E100, 0x01E12C, UnicodeCategory::Lo},
+    {0x01E130, 0x01E136, UnicodeCategory::Mn}, {0x01E137, 0x01E13D, UnicodeCategory::Lm},
+    {0x01E140, 0x01E149, UnicodeCategory::Nd}, {0x01E14E, 0x01E14E, UnicodeCategory::Lo},
+    {0x01E14F, 0x01E14F, UnicodeCategory::So}, {0x01E290, 0x01E2AD, UnicodeCategory::Lo},
+    {0x01E2AE, 0x01E2AE, UnicodeCategory::Mn}, {0x01E2C0, 0x01E2EB, UnicodeCategory::Lo},
+    {0x01E2EC, 0x01E2EF, UnicodeCategory::Mn}, {0x01E2F0, 0x01E2F9, UnicodeCategory::Nd},
+    {0x01E2FF, 0x01E2FF, UnicodeCategory::Sc}, {0x01E7E0, 0x01E7E6, UnicodeCategory::Lo},
+    {0x01E7E8, 0x01E7EB, UnicodeCategory::Lo}, {0x01E7ED, 0x01E7EE, UnicodeCategory::Lo},
+    {0x01E7F0, 0x01E7FE, UnicodeCategory::Lo}, {0x01E800, 0x01E8C4, UnicodeCategory::Lo},
+    {0x01E8C7, 0x01E8CF, UnicodeCategory::No}, {0x01E8D0, 0x01E8D6, UnicodeCategory::Mn},
+    {0x01E900, 0x01E921, UnicodeCategory::Lu}, {0x01E922, 0x01E943, UnicodeCategory::Ll},
+    {0x01E944, 0x01E94A, UnicodeCategory::Mn}, {0x01E94B, 0x01E94B, UnicodeCategory::Lm},
+    {0x01E950, 0x01E959, UnicodeCategory::Nd}, {0x01E95E, 0x01E95F, UnicodeCategory::Po},
+    {0x01EC71, 0x01ECAB, UnicodeCategory::No}, {0x01ECAC, 0x01ECAC, UnicodeCategory::So},
+    {0x01ECAD, 0x01ECAF, UnicodeCategory::No}, {0x01ECB0, 0x01ECB0, UnicodeCategory::Sc},
+    {0x01ECB1, 0x01ECB4, UnicodeCategory::No}, {0x01ED01, 0x01ED2D, UnicodeCategory::No},
+    {0x01ED2E, 0x01ED2E, UnicodeCategory::So}, {0x01ED2F, 0x01ED3D, UnicodeCategory::No},
+    {0x01EE00, 0x01EE03, UnicodeCategory::Lo}, {0x01EE05, 0x01EE1F, UnicodeCategory::Lo},
+    {0x01EE21, 0x01EE22, UnicodeCategory::Lo}, {0x01EE24, 0x01EE24, UnicodeCategory::Lo},
+    {0x01EE27, 0x01EE27, UnicodeCategory::Lo}, {0x01EE29, 0x01EE32, UnicodeCategory::Lo},
+    {0x01EE34, 0x01EE37, UnicodeCategory::Lo}, {0x01EE39, 0x01EE39, UnicodeCategory::Lo},
+    {0x01EE3B, 0x01EE3B, UnicodeCategory::Lo}, {0x01EE42, 0x01EE42, UnicodeCategory::Lo},
+    {0x01EE47, 0x01EE47, UnicodeCategory::Lo}, {0x01EE49, 0x01EE49, UnicodeCategory::Lo},
+    {0x01EE4B, 0x01EE4B, UnicodeCategory::Lo}, {0x01EE4D, 0x01EE4F, UnicodeCategory::Lo},
+    {0x01EE51, 0x01EE52, UnicodeCategory::Lo}, {0x01EE54, 0x01EE54, UnicodeCategory::Lo},
+    {0x01EE57, 0x01EE57, UnicodeCategory::Lo}, {0x01EE59, 0x01EE59, UnicodeCategory::Lo},
+    {0x01EE5B, 0x01EE5B, UnicodeCategory::Lo}, {0x01EE5D, 0x01EE5D, UnicodeCategory::Lo},
+    {0x01EE5F, 0x01EE5F, UnicodeCategory::Lo}, {0x01EE61, 0x01EE62, UnicodeCategory::Lo},
+    {0x01EE64, 0x01EE64, UnicodeCategory::Lo}, {0x01EE67, 0x01EE6A, UnicodeCategory::Lo},
+    {0x01EE6C, 0x01EE72, UnicodeCategory::Lo}, {0x01EE74, 0x01EE77, UnicodeCategory::Lo},
+    {0x01EE79, 0x01EE7C, UnicodeCategory::Lo}, {0x01EE7E, 0x01EE7E, UnicodeCategory::Lo},
+    {0x01EE80, 0x01EE89, UnicodeCategory::Lo}, {0x01EE8B, 0x01EE9B, UnicodeCategory::Lo},
+    {0x01EEA1, 0x01EEA3, UnicodeCategory::Lo}, {0x01EEA5, 0x01EEA9, UnicodeCategory::Lo},
+    {0x01EEAB, 0x01EEBB, UnicodeCategory::Lo}, {0x01EEF0, 0x01EEF1, UnicodeCategory::Sm},
+    {0x01F000, 0x01F02B, UnicodeCategory::So}, {0x01F030, 0x01F093, UnicodeCategory::So},
+    {0x01F0A0, 0x01F0AE, UnicodeCategory::So}, {0x01F0B1, 0x01F0BF, UnicodeCategory::So},
+    {0x01F0C1, 0x01F0CF, UnicodeCategory::So}, {0x01F0D1, 0x01F0F5, UnicodeCategory::So},
+    {0x01F100, 0x01F10C, UnicodeCategory::No}, {0x01F10D, 0x01F1AD, UnicodeCategory::So},
+    {0x01F1E6, 0x01F202, UnicodeCategory::So}, {0x01F210, 0x01F23B, UnicodeCategory::So},
+    {0x01F240, 0x01F248, UnicodeCategory::So}, {0x01F250, 0x01F251, UnicodeCategory::So},
+    {0x01F260, 0x01F265, UnicodeCategory::So}, {0x01F300, 0x01F3FA, UnicodeCategory::So},
+    {0x01F3FB, 0x01F3FF, UnicodeCategory::Sk}, {0x01F400, 0x01F6D7, UnicodeCategory::So},
+    {0x01F6DD, 0x01F6EC, UnicodeCategory::So}, {0x01F6F0, 0x01F6FC, UnicodeCategory::So},
+    {0x01F700, 0x01F773, UnicodeCategory::So}, {0x01F780, 0x01F7D8, UnicodeCategory::So},
+    {0x01F7E0, 0x01F7EB, UnicodeCategory::So}, {0x01F7F0, 0x01F7F0, UnicodeCategory::So},
+    {0x01F800, 0x01F80B, UnicodeCategory::So}, {0x01F810, 0x01F847, UnicodeCategory::So},
+    {0x01F850, 0x01F859, UnicodeCategory::So}, {0x01F860, 0x01F887, UnicodeCategory::So},
+    {0x01F890, 0x01F8AD, UnicodeCategory::So}, {0x01F8B0, 0x01F8B1, UnicodeCategory::So},
+    {0x01F900, 0x01FA53, UnicodeCategory::So}, {0x01FA60, 0x01FA6D, UnicodeCategory::So},
+    {0x01FA70, 0x01FA74, UnicodeCategory::So}, {0x01FA78, 0x01FA7C, UnicodeCategory::So},
+    {0x01FA80, 0x01FA86, UnicodeCategory::So}, {0x01FA90, 0x01FAAC, UnicodeCategory::So},
+    {0x01FAB0, 0x01FABA, UnicodeCategory::So}, {0x01FAC0, 0x01FAC5, UnicodeCategory::So},
+    {0x01FAD0, 0x01FAD9, UnicodeCategory::So}, {0x01FAE0, 0x01FAE7, UnicodeCategory::So},
+    {0x01FAF0, 0x01FAF6, UnicodeCategory::So}, {0x01FB00, 0x01FB92, UnicodeCategory::So},
+    {0x01FB94, 0x01FBCA, UnicodeCategory::So}, {0x01FBF0, 0x01FBF9, UnicodeCategory::Nd},
+    {0x020000, 0x02A6DF, UnicodeCategory::Lo}, {0x02A700, 0x02B738, UnicodeCategory::Lo},
+    {0x02B740, 0x02B81D, UnicodeCategory::Lo}, {0x02B820, 0x02CEA1, UnicodeCategory::Lo},
+    {0x02CEB0, 0x02EBE0, UnicodeCategory::Lo}, {0x02F800, 0x02FA1D, UnicodeCategory::Lo},
+    {0x030000, 0x03134A, UnicodeCategory::Lo}, {0x0E0001, 0x0E0001, UnicodeCategory::Cf},
+    {0x0E0020, 0x0E007F, UnicodeCategory::Cf}, {0x0E0100, 0x0E01EF, UnicodeCategory::Mn},
+    {0x0F0000, 0x0FFFFD, UnicodeCategory::Co}, {0x100000, 0x10FFFD, UnicodeCategory::Co},
+};
+
+const int chlex::unicodeCategoryRangeCount = sizeof(unicodeCategoryRanges) / sizeof(unicodeCategoryRanges[0]);
@@ -0,0 +1,63 @@
+/**
+ * @file LexerFactoryTest.cc
+ * @brief 编译并运行 LexerFactory 生成的词法分析程序，检查输出的Token
+ * @date 2026-10-18
+ * @version 0.1
+ * @author Chlamydomonos
+ * @copyright
+ */
+
+#include "ChlexReader.hh"
+#include "Compiler.hh"
+#include "LexerFactory.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace chlex;
+
+/**
+ * @brief 生成词法分析程序，用它处理输入并与期望的输出比较
+ * @param name 用例名称，同时作为临时文件名的前缀
+ * @param spec Chlex文件的内容
+ * @param input 输入
+ * @param expected 期望的输出，即依次输出的Token，每个之后带有一个空格
+ * @return 是否与期望的输出相同
+ */
+static bool check(const std::string &name, const std::string &spec, const std::string &input, const std::string &expected)
+{
+    std::istringstream specIn(spec);
+    std::shared_ptr<RawChlex> raw = ChlexReader::getInstance().read(specIn);
+    auto code = LexerFactory::getInstance().generate(Compiler().compile(raw))->getCode();
+
+    std::ofstream(name + ".cc") << code;
+    std::ofstream(name + ".in", std::ios::binary) << input;
+    auto command = std::string(CHLEX_TEST_CXX) + " -std=c++17 -o " + name + " " + name + ".cc && ./" + name + " " + name + ".in " + name + ".out";
+    if (std::system(command.c_str()) != 0)
+    {
+        std::cout << name << ": cannot build or run the generated lexer" << std::endl;
+        return false;
+    }
+
+    std::string output;
+    std::getline(std::ifstream(name + ".out"), output);
+    if (output != expected)
+    {
+        std::cout << name << ": expected \"" << expected << "\", got \"" << output << "\"" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool passed = true;
+
+    // 起始状态是终止状态且有到自身的转移时，经过这个转移的匹配也要记录动作
+    passed &= check("startSelfLoop", "T\n\"b*\" {return 0;}\n\"[a-c]+\" {return 1;}\n", "b", "0 ");
+    passed &= check("startSelfLoopBacktrack", "T\n\"A*\" {return 0;}\n\"A*C\" {return 1;}\n", "AACAA", "1 0 ");
+
+    return passed ? 0 : 1;
+}